@@ -294,12 +294,25 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* Create TRACE macro for actual printing */
 #ifndef NDEBUG
 
+  #ifdef TRACE_BINARY_ENABLED
+
+    #include <libpsicommon/trace.h>  /* TRACE_BINARY() (for TRACE) */
+
+    /* Record the raw trace and format it later on the host */
+    #ifndef TRACE
+        #define TRACE(...)    TRACE_BINARY(__VA_ARGS__)
+    #endif
+
+  #else
+
     #include <stdio.h>              /* prototype printf() (for TRACE) */
 
     #ifndef TRACE
         #define TRACE(...)    printf(__VA_ARGS__)
     #endif
 
+  #endif
+
 #else
 
     #ifndef TRACE
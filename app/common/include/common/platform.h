@@ -60,5 +60,9 @@ void platform_exit(void);
 
 void platform_msleep(UINT32 msec_p);
 
+#if defined(STREAM_TIMING_ENABLED) || defined(TRACE_BINARY_ENABLED)
+UINT32 platform_getCycleCount(void);
+#endif
+
 #endif /* _INC_common_platform_H_ */
 
@@ -55,11 +55,44 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* typedef                                                                    */
 /*----------------------------------------------------------------------------*/
 
+/**
+ * \brief Full duplex chunk of a scatter-gather transfer
+ *
+ * A buffer of the chunk is NULL if its direction is already exhausted. This
+ * only happens if the consuming and the producing payload differ in size.
+ * Transports which can't send zeros or drop data need to reject such chunks.
+ */
+typedef struct {
+    UINT8*    pRxBase_m;        /**< Receive buffer of the chunk (NULL: Receive direction exhausted) */
+    UINT8*    pTxBase_m;        /**< Transmit buffer of the chunk (NULL: Transmit direction exhausted) */
+    UINT16    size_m;           /**< Size of the chunk in bytes */
+} tTbufpChunk;
+
+/**
+ * \brief Position of one direction inside a segment list
+ */
+typedef struct {
+    tBuffDescriptor*  pSeg_m;       /**< Current segment */
+    UINT8             segLeft_m;    /**< Number of segments left including the current */
+    UINT16            offset_m;     /**< Offset inside the current segment */
+} tTbufpSegPos;
+
+/**
+ * \brief Cursor to split the segment lists into full duplex chunks
+ */
+typedef struct {
+    tTbufpSegPos    rxPos_m;        /**< Position in the consuming segments */
+    tTbufpSegPos    txPos_m;        /**< Position in the producing segments */
+} tTbufpChunkCursor;
+
 /*----------------------------------------------------------------------------*/
 /* function prototypes                                                        */
 /*----------------------------------------------------------------------------*/
 BOOL tbufp_genDescList(UINT8 * pTbufBase_m, UINT16 tbufCount_m, tBuffDescriptor* pBuffDescList_p);
 BOOL tbufp_genTransferParams(UINT8 * pTbufBase_m, tHandlerParam * p_transParam);
 
+void tbufp_initChunkCursor(tHandlerParam* pTransParam_p, tTbufpChunkCursor* pCursor_p);
+BOOL tbufp_getNextChunk(tTbufpChunkCursor* pCursor_p, tTbufpChunk* pChunk_p);
+
 #endif /* _INC_common_tbufparams_H_ */
 
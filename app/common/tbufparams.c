@@ -91,6 +91,9 @@ or by the serial interface.
 /* local function prototypes                                                  */
 /*----------------------------------------------------------------------------*/
 static UINT32 getInitOffset(INT8 isProducer_p, BOOL isFirstAck_p);
+static void initSegPos(tSegmentList* pSegs_p, tTbufpSegPos* pPos_p);
+static UINT16 getSegRemaining(tTbufpSegPos* pPos_p);
+static UINT8* advanceSegPos(tTbufpSegPos* pPos_p, UINT16 size_p);
 
 /*============================================================================*/
 /*            P U B L I C   F U N C T I O N S                                 */
@@ -169,6 +172,64 @@ BOOL tbufp_genTransferParams(UINT8 * pTbufBase_m, tHandlerParam * p_transParam)
     return retVal;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Initialize a cursor to iterate over the transfer segments
+
+\param[in]  pTransParam_p   Transfer parameters with the segment lists
+\param[out] pCursor_p       Cursor to initialize
+*/
+/*----------------------------------------------------------------------------*/
+void tbufp_initChunkCursor(tHandlerParam* pTransParam_p, tTbufpChunkCursor* pCursor_p)
+{
+    initSegPos(&pTransParam_p->consSegs_m, &pCursor_p->rxPos_m);
+    initSegPos(&pTransParam_p->prodSegs_m, &pCursor_p->txPos_m);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get the next full duplex chunk of a scatter-gather transfer
+
+A chunk ends at the next segment border of either direction. This enables a
+transport to carry out the whole transfer as a sequence of contiguous
+accesses without copying the segments to a staging buffer.
+
+\param[in,out] pCursor_p    Cursor of the transfer
+\param[out]    pChunk_p     Next chunk to transfer
+
+\return TRUE if a chunk is returned; FALSE if the transfer is complete */
+/*----------------------------------------------------------------------------*/
+BOOL tbufp_getNextChunk(tTbufpChunkCursor* pCursor_p, tTbufpChunk* pChunk_p)
+{
+    BOOL retVal = FALSE;
+    UINT16 rxSize = getSegRemaining(&pCursor_p->rxPos_m);
+    UINT16 txSize = getSegRemaining(&pCursor_p->txPos_m);
+
+    if(rxSize != 0 || txSize != 0)
+    {
+        /* Chunk ends at the nearest segment border */
+        if(rxSize == 0)
+        {
+            pChunk_p->size_m = txSize;
+        }
+        else if(txSize == 0)
+        {
+            pChunk_p->size_m = rxSize;
+        }
+        else
+        {
+            pChunk_p->size_m = (rxSize < txSize) ? rxSize : txSize;
+        }
+
+        pChunk_p->pRxBase_m = advanceSegPos(&pCursor_p->rxPos_m, pChunk_p->size_m);
+        pChunk_p->pTxBase_m = advanceSegPos(&pCursor_p->txPos_m, pChunk_p->size_m);
+
+        retVal = TRUE;
+    }
+
+    return retVal;
+}
+
 /*============================================================================*/
 /*            P R I V A T E   F U N C T I O N S                               */
 /*============================================================================*/
@@ -216,6 +277,75 @@ static UINT32 getInitOffset(INT8 isProducer_p, BOOL isFirstAck_p)
     return offset;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Initialize the position in a segment list
+
+\param[in]  pSegs_p     Segment list
+\param[out] pPos_p      Position to initialize
+*/
+/*----------------------------------------------------------------------------*/
+static void initSegPos(tSegmentList* pSegs_p, tTbufpSegPos* pPos_p)
+{
+    pPos_p->pSeg_m = pSegs_p->pSegList_m;
+    pPos_p->segLeft_m = (pSegs_p->pSegList_m != NULL) ? pSegs_p->segCount_m : 0;
+    pPos_p->offset_m = 0;
+
+    /* Skip leading empty segments */
+    advanceSegPos(pPos_p, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get the number of bytes left in the current segment
+
+\param[in] pPos_p      Position in the segment list
+
+\return Number of bytes left; zero if the list is exhausted */
+/*----------------------------------------------------------------------------*/
+static UINT16 getSegRemaining(tTbufpSegPos* pPos_p)
+{
+    UINT16 remaining = 0;
+
+    if(pPos_p->segLeft_m != 0)
+    {
+        remaining = pPos_p->pSeg_m->buffSize_m - pPos_p->offset_m;
+    }
+
+    return remaining;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Advance the position in a segment list
+
+\param[in,out] pPos_p      Position in the segment list
+\param[in]     size_p      Number of bytes to advance (Max. to segment end)
+
+\return Address of the data before advancing; NULL if the list is exhausted */
+/*----------------------------------------------------------------------------*/
+static UINT8* advanceSegPos(tTbufpSegPos* pPos_p, UINT16 size_p)
+{
+    UINT8* pData = NULL;
+
+    if(pPos_p->segLeft_m != 0)
+    {
+        pData = pPos_p->pSeg_m->pBuffBase_m + pPos_p->offset_m;
+        pPos_p->offset_m += size_p;
+
+        /* Move to the next segment with payload */
+        while(pPos_p->segLeft_m != 0 &&
+              pPos_p->offset_m >= pPos_p->pSeg_m->buffSize_m)
+        {
+            pPos_p->segLeft_m--;
+            pPos_p->pSeg_m++;
+            pPos_p->offset_m = 0;
+        }
+    }
+
+    return pData;
+}
+
 /**
  * \}
  * \}
@@ -51,6 +51,15 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define CONF_CHAN_NUM_OBJECTS     4     /**< Number of objects in list CCOBJECT_LIST_INIT_VECTOR */
 
+#define CC_REFRESH_CYCLE_COUNT    100   /**< Cycles between the refresh of two unchanged objects (0: no refresh) */
+
+#define CC_RX_BATCH_QUEUE_SIZE    4     /**< Number of received OCC batches queued until cc_process applies them (Power of two) */
+
+/* Detect configuration errors */
+#if (CC_RX_BATCH_QUEUE_SIZE == 0) || ((CC_RX_BATCH_QUEUE_SIZE & (CC_RX_BATCH_QUEUE_SIZE - 1)) != 0) || (CC_RX_BATCH_QUEUE_SIZE > 128)
+#error "CC_RX_BATCH_QUEUE_SIZE needs to be a power of two between 1 and 128"
+#endif
+
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
 /*----------------------------------------------------------------------------*/
@@ -47,6 +47,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*----------------------------------------------------------------------------*/
 #define LOG_STUB_OBJECT_INDEX           0x2403     /**< Object index of the logbook stub (Container needs to be defined in xdd) */
 
+#define LOG_RING_SIZE                   8          /**< Number of logbook entries waiting for transmission (Power of two) */
+
+/* Detect configuration errors */
+#if (LOG_RING_SIZE == 0) || ((LOG_RING_SIZE & (LOG_RING_SIZE - 1)) != 0)
+#error "LOG_RING_SIZE needs to be a power of two"
+#endif
+
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
 /*----------------------------------------------------------------------------*/
@@ -42,15 +42,23 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* includes                                                                   */
 /*----------------------------------------------------------------------------*/
 
-#include <config/rpdo.h>
+#include <libpsicommon/pdomap.h>
 
 /*----------------------------------------------------------------------------*/
 /* const defines                                                              */
 /*----------------------------------------------------------------------------*/
-#define RPDO_NUM_OBJECTS    1       /**< Number of mapped RPDO objects */
-
 #define RX_SPDO0_SIZE       32      /**< Size of the spdo0 receive container */
 
+/**
+ * \brief List of all mapped RPDO objects
+ *
+ * OBJ(member, Name, objIdx, objSubIdx, type, count) (See libpsicommon/pdomap.h)
+ */
+#define RPDO_MAPPED_OBJ_LIST(OBJ) \
+    OBJ(spdo0, Spdo0, 0x4001, 0x01, UINT8, RX_SPDO0_SIZE)     /**< SPDO receive container */
+
+#define RPDO_NUM_OBJECTS    (0 RPDO_MAPPED_OBJ_LIST(PDOMAP_COUNT))     /**< Number of mapped RPDO objects */
+
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
 /*----------------------------------------------------------------------------*/
@@ -59,9 +67,23 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * \brief List of all mappable objects
  */
 typedef struct {
-    UINT8          spdo0[RX_SPDO0_SIZE];       /**< SPDO receive container */
+    RPDO_MAPPED_OBJ_LIST(PDOMAP_MEMBER)
 } PACK_STRUCT tRpdoMappedObj;
 
+PDOMAP_CHECK_SIZE(tRpdoMappedObj, (0 RPDO_MAPPED_OBJ_LIST(PDOMAP_SIZE)))
+
+/**
+ * \brief Number of PDO channel instances
+ *
+ * All channels share the layout of tRpdoMappedObj and tTpdoMappedObj. Each
+ * channel needs its own RPDO and TPDO triple buffer with this layout, which
+ * has to be provided by the PCP. The PCP of this demo provides one image only.
+ */
+typedef enum {
+    kNumPdoChan0     = 0x00,    /**< Id of the first PDO channel */
+    kNumPdoInstCount = 0x01,    /**< Maximum count of PDO channels */
+} tPdoChanNum;
+
 /*----------------------------------------------------------------------------*/
 /* offsetof defines                                                           */
 /*----------------------------------------------------------------------------*/
@@ -72,9 +94,11 @@ typedef struct {
 /* object linking parameters                                                  */
 /*----------------------------------------------------------------------------*/
 
-/* Link between object and buffer address: objIdx | objSubIdx | addressOffset           | objSize */
-#define RPDO_LINKING_LIST_INIT_VECTOR   { {0x4001 , 0x01      , TBUF_RPDO_SPDO0_OFF     , RX_SPDO0_SIZE }  \
-                                        }
+/* Link between object and buffer address: objIdx | objSubIdx | addressOffset | objSize */
+#define RPDO_LINK_ENTRY(member_p, name_p, idx_p, subIdx_p, type_p, count_p) \
+    PDOMAP_LINK(tRpdoMappedObj, member_p, idx_p, subIdx_p, type_p, count_p)
+
+#define RPDO_LINKING_LIST_INIT_VECTOR   { RPDO_MAPPED_OBJ_LIST(RPDO_LINK_ENTRY) }
 
 /*----------------------------------------------------------------------------*/
 /* function prototypes                                                        */
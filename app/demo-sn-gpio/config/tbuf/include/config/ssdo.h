@@ -55,6 +55,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define SSDO_STUB_DATA_DOM_SIZE     0x20      /**< Size of the SSDO stub data object */
 #define TSSDO_TRANSMIT_DATA_SIZE    0x20      /**< Size of the SSDO channel transmit data */
 
+#define SSDO_TX_QUEUE_SIZE          4         /**< Number of frames queued in the SSDO transmit channel (Power of two) */
+#define SSDO_RX_QUEUE_SIZE          4         /**< Number of received frames buffered for the application (Power of two) */
+
+/* Detect configuration errors */
+#if (SSDO_TX_QUEUE_SIZE == 0) || ((SSDO_TX_QUEUE_SIZE & (SSDO_TX_QUEUE_SIZE - 1)) != 0) || (SSDO_TX_QUEUE_SIZE > 128)
+#error "SSDO_TX_QUEUE_SIZE needs to be a power of two between 1 and 128"
+#endif
+
+#if (SSDO_RX_QUEUE_SIZE == 0) || ((SSDO_RX_QUEUE_SIZE & (SSDO_RX_QUEUE_SIZE - 1)) != 0) || (SSDO_RX_QUEUE_SIZE > 128)
+#error "SSDO_RX_QUEUE_SIZE needs to be a power of two between 1 and 128"
+#endif
+
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
 /*----------------------------------------------------------------------------*/
@@ -42,16 +42,24 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* includes                                                                   */
 /*----------------------------------------------------------------------------*/
 
-#include <libpsicommon/global.h>
+#include <libpsicommon/pdomap.h>
 
 /*----------------------------------------------------------------------------*/
 /* const defines                                                              */
 /*----------------------------------------------------------------------------*/
 
-#define TPDO_NUM_OBJECTS    1       /**< Number of mapped TPDO objects */
-
 #define TX_SPDO_SIZE       32       /**< Size of the spdo0 transmit container */
 
+/**
+ * \brief List of all mapped TPDO objects
+ *
+ * OBJ(member, Name, objIdx, objSubIdx, type, count) (See libpsicommon/pdomap.h)
+ */
+#define TPDO_MAPPED_OBJ_LIST(OBJ) \
+    OBJ(spdo0, Spdo0, 0x4000, 0x01, UINT8, TX_SPDO_SIZE)      /**< SPDO transmit container */
+
+#define TPDO_NUM_OBJECTS    (0 TPDO_MAPPED_OBJ_LIST(PDOMAP_COUNT))     /**< Number of mapped TPDO objects */
+
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
 /*----------------------------------------------------------------------------*/
@@ -59,9 +67,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  * \brief List of all mappable objects
  */
 typedef struct {
-    UINT8          spdo0[TX_SPDO_SIZE];       /**< SPDO transmit container */
+    TPDO_MAPPED_OBJ_LIST(PDOMAP_MEMBER)
 } PACK_STRUCT tTpdoMappedObj;
 
+PDOMAP_CHECK_SIZE(tTpdoMappedObj, (0 TPDO_MAPPED_OBJ_LIST(PDOMAP_SIZE)))
+
 /*----------------------------------------------------------------------------*/
 /* offsetof defines                                                           */
 /*----------------------------------------------------------------------------*/
@@ -71,9 +81,11 @@ typedef struct {
 /* object linking parameters                                                  */
 /*----------------------------------------------------------------------------*/
 
-/* Link between object and buffer address: objIdx | objSubIdx | addressOffset            | objSize */
-#define TPDO_LINKING_LIST_INIT_VECTOR   { {0x4000 , 0x01      , TBUF_TPDO_SPDO0_OFF      , TX_SPDO_SIZE  }  \
-                                        }
+/* Link between object and buffer address: objIdx | objSubIdx | addressOffset | objSize */
+#define TPDO_LINK_ENTRY(member_p, name_p, idx_p, subIdx_p, type_p, count_p) \
+    PDOMAP_LINK(tTpdoMappedObj, member_p, idx_p, subIdx_p, type_p, count_p)
+
+#define TPDO_LINKING_LIST_INIT_VECTOR   { TPDO_MAPPED_OBJ_LIST(TPDO_LINK_ENTRY) }
 
 /*----------------------------------------------------------------------------*/
 /* function prototypes                                                        */
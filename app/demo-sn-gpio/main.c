@@ -72,6 +72,10 @@ stack and processes the background task.
 #include <SCFMapi.h>
 #include <SSCapi.h>
 
+#if !defined(NDEBUG) && defined(TRACE_BINARY_ENABLED)
+#include <stdio.h>
+#endif
+
 /*============================================================================*/
 /*            G L O B A L   D E F I N I T I O N S                             */
 /*============================================================================*/
@@ -135,6 +139,10 @@ static BOOLEAN syncCycle(void);
 
 static BOOLEAN processTaskSchedule(void);
 
+#if !defined(NDEBUG) && defined(TRACE_BINARY_ENABLED)
+static void drainTraces(void);
+#endif
+
 static void enterReset(void);
 static void shutdown(void);
 
@@ -168,6 +176,11 @@ int main (void)
     /* Initialize target specific functions */
     platform_init();
 
+#if !defined(NDEBUG) && defined(TRACE_BINARY_ENABLED)
+    /* Record debug traces with the CPU cycle counter as time stamp */
+    trace_init(platform_getCycleCount);
+#endif
+
     DEBUG_TRACE(DEBUG_LVL_ALWAYS, "\n\n********************************************************************\n");
     DEBUG_TRACE(DEBUG_LVL_ALWAYS, "\n\topenSAFETY SafetyNode Demo \n\n ");
     DEBUG_TRACE(DEBUG_LVL_ALWAYS, "\tStack version: \t\t%s\n", EPLS_k_STACK_VERSION );
@@ -405,6 +418,10 @@ static BOOLEAN processAsync(void)
             enterReset();
         }
 
+#if !defined(NDEBUG) && defined(TRACE_BINARY_ENABLED)
+        /* Print the recorded debug traces for the host decoder */
+        drainTraces();
+#endif
     }
 
     return fReturn;
@@ -584,9 +601,52 @@ static void shutdown(void)
 #endif /* #if (defined SYSTEM_PATH) && (SYSTEM_PATH > ID_TARG_SINGLE) */
 
     constime_exit();
+
+#if !defined(NDEBUG) && defined(TRACE_BINARY_ENABLED)
+    drainTraces();
+#endif
+
     platform_exit();
 }
 
+#if !defined(NDEBUG) && defined(TRACE_BINARY_ENABLED)
+/*----------------------------------------------------------------------------*/
+/**
+rief    Print all recorded binary traces
+
+Each record is printed as one line '#TRC <fmtId> <timeStamp> <argCount> <args>'
+with hexadecimal fields. The host tool psitracedec expands these lines to text
+with the format table of the ELF file. Lost records are reported with the line
+'#TRCLOST <count>'.
+*/
+/*----------------------------------------------------------------------------*/
+static void drainTraces(void)
+{
+    static UINT32 lostCount_l = 0;
+    tTraceRecord record;
+    UINT32 lostCount;
+    UINT32 i;
+
+    while(trace_getRecord(&record))
+    {
+        printf("#TRC %lx %lx %lx", (unsigned long)record.fmtId_m,
+               (unsigned long)record.timeStamp_m, (unsigned long)record.argCount_m);
+        for(i = 0; i < record.argCount_m && i < TRACE_MAX_ARGS; i++)
+        {
+            printf(" %lx", (unsigned long)record.arg_m[i]);
+        }
+        printf("\n");
+    }
+
+    lostCount = trace_getLostCount();
+    if(lostCount != lostCount_l)
+    {
+        printf("#TRCLOST %lx\n", (unsigned long)(lostCount - lostCount_l));
+        lostCount_l = lostCount;
+    }
+}
+#endif
+
 /**
  * \}
  * \}
@@ -59,6 +59,7 @@ Provides the interface from the SHNF to the slim interface library.
 #include <common/pcpserial.h>       /* Platform specific functions for the serial */
 #include <common/syncir.h>       /* Platform specific functions for the synchronous interrupt */
 #include <common/benchmark.h>    /* Debug header for performance measurements */
+#include <common/platform.h>     /* Cycle counter for the stream timing statistics */
 
 #include <common/tbufparams.h>
 
@@ -105,8 +106,10 @@ typedef struct
  * \brief The instance structure of the hnf for the PSI interface
  */
 typedef struct {
-    volatile UINT8 tbufMemLayout_m[TBUF_IMAGE_SIZE];        /**< Local copy of the triple buffer memory */
+    volatile UINT8 tbufMemLayout_m[TBUF_IMAGE_SIZE];        /**< Local copy of the triple buffer memory (Working image) */
+    volatile UINT8 tbufTransLayout_m[TBUF_IMAGE_SIZE];      /**< Image of the triple buffer memory used by the serial transfer */
     UINT8 fCcWriteObjTestEnable_m;                          /**< Enable periodic writing of a cc object */
+    tPdoInstance pPdoInstance_m;                            /**< PDO channel instance of the SPDO image */
     tSsdoInstance apSsdoInstance_m[kNumSsdoInstCount];      /**< SSDO channel instance handler array */
     tSsdoRxHandler apfnSsdoRxHandler[kNumSsdoInstCount];    /**< Array of SSDO channel receive callbacks */
     tLogInstance apLogInstance_m[kNumLogInstCount];         /**< Logbook instance handler array */
@@ -361,16 +364,20 @@ BOOLEAN hnf_postLogChannel0(tErrorDesc * pErrDesc_p)
                                &pLogData))
     {
         /* Adapt error message format to special interface type */
-        if(reformatErrorMessage(pErrDesc_p, pLogData))
+        fReturn = reformatErrorMessage(pErrDesc_p, pLogData);
+        if(fReturn == FALSE)
         {
-            /* Post the logging data to the logger module */
-            transState = log_postLogEntry(hnfPsiInstance_l.apLogInstance_m[kNumLogChan0],
-                                          pLogData);
-            if(transState == kLogTxStatusSuccessful)
-            {
-                fReturn = TRUE;
-            }   /* no else: Error will be indicated by the caller of this function*/
+            /* Entry is dropped but the buffer needs to be released anyway */
+            ami_setUint8Le((UINT8 *)&pLogData->level_m, (UINT8)kLogLevelInvalid);
         }
+
+        /* Post the logging data to the logger module */
+        transState = log_postLogEntry(hnfPsiInstance_l.apLogInstance_m[kNumLogChan0],
+                                      pLogData);
+        if(transState != kLogTxStatusSuccessful)
+        {
+            fReturn = FALSE;
+        }   /* no else: Error will be indicated by the caller of this function*/
     }   /* no else: Error will be indicated by the caller of this function */
 
     return fReturn;
@@ -454,14 +461,19 @@ static BOOL initPsi(void)
     BOOL fReturn = FALSE;
     tPsiInitParam initParam;
     tBuffDescriptor buffDescList[kTbufCount];
+    tBuffDescriptor transDescList[kTbufCount];
     tHandlerParam transferParam;
     UINT8 * pTbufMemBase = (UINT8 *)(&hnfPsiInstance_l.tbufMemLayout_m[0]);
+    UINT8 * pTbufTransBase = (UINT8 *)(&hnfPsiInstance_l.tbufTransLayout_m[0]);
 
+    PSI_MEMSET(&initParam, 0, sizeof(tPsiInitParam));
     PSI_MEMSET(&transferParam, 0, sizeof(tHandlerParam));
     PSI_MEMSET(&buffDescList, 0, sizeof(buffDescList));
+    PSI_MEMSET(&transDescList, 0, sizeof(transDescList));
 
-    /* Generate buffer descriptor list */
-    if(tbufp_genDescList(pTbufMemBase, kTbufCount, &buffDescList[0]))
+    /* Generate buffer descriptor list of the working and the transfer image */
+    if(tbufp_genDescList(pTbufMemBase, kTbufCount, &buffDescList[0]) &&
+       tbufp_genDescList(pTbufTransBase, kTbufCount, &transDescList[0])  )
     {
         /* Enable test of configuration channel */
         hnfPsiInstance_l.fCcWriteObjTestEnable_m = TRUE;
@@ -475,6 +487,11 @@ static BOOL initPsi(void)
         initParam.idConsAck_m = kTbufAckRegisterCons;
         initParam.idProdAck_m = kTbufAckRegisterProd;
         initParam.idFirstProdBuffer_m = TBUF_NUM_CON + 1;   /* Add one buffer for the consumer ACK register */
+        initParam.pTransDescList_m = &transDescList[0];     /* Serial transfer works on a separate image */
+        initParam.fAsyncTransfer_m = TRUE;                  /* Serial transfer finishes in the DMA interrupt */
+#ifdef STREAM_TIMING_ENABLED
+        initParam.pfnCycleCount_m = platform_getCycleCount;
+#endif
 
         if(psi_init(&initParam))
         {
@@ -487,11 +504,11 @@ static BOOL initPsi(void)
                 DEBUG_TRACE(DEBUG_LVL_ALWAYS, "SUCCESS!\n");
 
                 /* Set the base address of the PDO image */
-                hnfPsiInstance_l.spdo0TxBuffer_m.pBuffer_m = (UINT8 *)pdo_getTpdoImage();
+                hnfPsiInstance_l.spdo0TxBuffer_m.pBuffer_m = tpdo_getSpdo0Addr(pdo_getTpdoImage(hnfPsiInstance_l.pPdoInstance_m));
                 hnfPsiInstance_l.spdo0TxBuffer_m.buffSize_m = TX_SPDO_SIZE;
 
                 /* Setup consumer/producer transfer parameters with initialization fields */
-                if(tbufp_genTransferParams(pTbufMemBase, &transferParam))
+                if(tbufp_genTransferParams(pTbufTransBase, &transferParam))
                 {
                     /* initialize serial interface*/
                     DEBUG_TRACE(DEBUG_LVL_ALWAYS,"\nInitialize serial device -> ");
@@ -559,11 +576,13 @@ static BOOL initModules(void)
     }
 
 #if(((PSI_MODULE_INTEGRATION) & (PSI_MODULE_PDO)) != 0)
-    /* Initialize the PDO module */
+    /* Initialize the PDO channel of the SPDO image */
     pdoInitParam.buffIdRpdo_m = kTbufNumRpdoImage;
     pdoInitParam.buffIdTpdo_m = kTbufNumTpdoImage;
+    pdoInitParam.fRpdoChangeOnly_m = FALSE;     /* SPDO transmit frame is built in each cycle */
 
-    if(pdo_init(processApp, &pdoInitParam) == FALSE)
+    hnfPsiInstance_l.pPdoInstance_m = pdo_create(kNumPdoChan0, processApp, &pdoInitParam);
+    if(hnfPsiInstance_l.pPdoInstance_m == NULL)
     {
         errh_postFatalError(kErrSourceHnf, kErrorPdoModuleInitFailed, 0);
         return fReturn;
@@ -593,6 +612,7 @@ static BOOL initModules(void)
     for(i=0; i<kNumLogInstCount; i++)
     {
         logInitParam.buffIdTx_m = kTbufNumLogbook0 + i;
+        logInitParam.fBatchMode_m = TRUE;        /* Pack error bursts into as few transfers as possible */
 
         hnfPsiInstance_l.apLogInstance_m[i] = log_create(kNumLogChan0 + i, &logInitParam);
         if(hnfPsiInstance_l.apLogInstance_m[i] == NULL)
@@ -627,7 +647,7 @@ static void exitModules(void)
     status_exit();
 
 #if(((PSI_MODULE_INTEGRATION) & (PSI_MODULE_PDO)) != 0)
-    pdo_exit();
+    pdo_destroy(hnfPsiInstance_l.pPdoInstance_m);
 #endif
 
 #if(((PSI_MODULE_INTEGRATION) & (PSI_MODULE_SSDO)) != 0)
@@ -698,7 +718,7 @@ static BOOL processApp(UINT32 rpdoRelTimeLow_p,
     if(hnfPsiInstance_l.pfnSpdoRxHandler_m != NULL)
     {
         /* Call RSPDO receive handler () */
-        hnfPsiInstance_l.pfnSpdoRxHandler_m(&pRpdoImage_p->spdo0[0], RX_SPDO0_SIZE);
+        hnfPsiInstance_l.pfnSpdoRxHandler_m(rpdo_getSpdo0Addr(pRpdoImage_p), RX_SPDO0_SIZE);
 
         if(hnfPsiInstance_l.pfnSpdoTxCreate_m != NULL)
         {
@@ -769,29 +789,34 @@ This function is called after a serial transfer from the PCP to the application.
 /*----------------------------------------------------------------------------*/
 static void serialTransferFinished(BOOL fError_p)
 {
+    BENCHMARK_MOD_01_SET(0);
+
     if(fError_p == FALSE)
     {
-        BENCHMARK_MOD_01_SET(0);
-
         /* Transfer finished -> Call all post action tasks */
-        if(psi_processPostTransferActions() == FALSE)
+        if(psi_transferFinished(FALSE) == FALSE)
         {
             errh_postFatalError(kErrSourceHnf, kErrorSyncProcessFailed, 0);
         }
-
-        BENCHMARK_MOD_01_RESET(0);
     }
     else
     {
-        /* There was an error during serial transfer */
+        /* There was an error during serial transfer -> Release the stream */
+        psi_transferFinished(TRUE);
+
         errh_postFatalError(kErrSourceHnf, kErrorSerialTransmitFailed, 0);
     }
+
+    BENCHMARK_MOD_01_RESET(0);
 }
 
 /*----------------------------------------------------------------------------*/
 /**
 \brief    Error handler callback function
 
+The psi library calls this function in the background loop. Repeated errors
+are reported once with their number of occurrences.
+
 \param pErrorInfo_p     Provides details about the occurred error
 */
 /*----------------------------------------------------------------------------*/
@@ -809,6 +834,7 @@ static void errorHandler(tPsiErrorInfo* pErrorInfo_p)
     {
         errInfo.unit_m = (UINT8)pErrorInfo_p->srcModule_m;
         errInfo.code_m = (UINT8)pErrorInfo_p->errCode_m;
+        errInfo.addInfo_m = pErrorInfo_p->count_m;     /* Number of occurrences */
     }
     else
     {
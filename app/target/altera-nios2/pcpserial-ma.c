@@ -50,6 +50,7 @@ with the POWERLINK processor. (Target is Altera Nios2)
 /* includes                                                                   */
 /*----------------------------------------------------------------------------*/
 #include <common/pcpserial.h>
+#include <common/tbufparams.h>
 
 #include <system.h>
 #include <string.h>
@@ -104,6 +105,7 @@ static tPcpSerialTransferFin pfnTransfFin_l = NULL;
 /*----------------------------------------------------------------------------*/
 /* local function prototypes                                                  */
 /*----------------------------------------------------------------------------*/
+static int transferSegments(tHandlerParam* pHandlParam_p);
 
 /*============================================================================*/
 /*            P U B L I C   F U N C T I O N S                                 */
@@ -149,7 +151,8 @@ void pcpserial_exit(void)
 \brief  Start an serial transfer
 
 pcpserial_transfer() starts an serial transfer to exchange the process
-image with the PCP.
+image with the PCP. A scattered image is transferred chunk by chunk from the
+segment lists while the slave select is kept active.
 
 \param[in] pHandlParam_p       The parameters of the serial transfer handler
 
@@ -172,13 +175,21 @@ BOOL pcpserial_transfer(tHandlerParam* pHandlParam_p)
             );
     if(spiRet == 0)
     {
-        /* Transfer the actual input and output image */
-        spiRet = avalon_spi_tf(
-                SPI_MASTER_BASE_ADDRESS,
-                0,
-                (tDescriptor *)&pHandlParam_p->consDesc_m,
-                0
-                );
+        if(pHandlParam_p->consDesc_m.pBuffBase_m != NULL &&
+           pHandlParam_p->prodDesc_m.pBuffBase_m != NULL)
+        {
+            /* Transfer the actual input and output image */
+            spiRet = avalon_spi_tf(
+                    SPI_MASTER_BASE_ADDRESS,
+                    0,
+                    (tDescriptor *)&pHandlParam_p->consDesc_m,
+                    0
+                    );
+        }
+        else
+        {
+            spiRet = transferSegments(pHandlParam_p);
+        }
         if(spiRet == 0)
         {
             fReturn = TRUE;
@@ -201,6 +212,51 @@ BOOL pcpserial_transfer(tHandlerParam* pHandlParam_p)
 /** \name Private Functions  */
 /** \{ */
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief  Transfer a scattered image
+
+Each chunk of the segment lists is carried out as a separate SPI access. The
+slave select is held active until the last chunk is transferred.
+
+\param[in] pHandlParam_p       The parameters of the serial transfer handler
+
+\return 0 on success; the SPI driver error otherwise
+*/
+/*----------------------------------------------------------------------------*/
+static int transferSegments(tHandlerParam* pHandlParam_p)
+{
+    int spiRet = 0;
+    tTbufpChunkCursor cursor;
+    tTbufpChunk chunk;
+    tTbufpChunk nextChunk;
+    tDescriptor chunkDesc;
+    BOOL fMoreChunks;
+
+    tbufp_initChunkCursor(pHandlParam_p, &cursor);
+
+    fMoreChunks = tbufp_getNextChunk(&cursor, &nextChunk);
+    while(fMoreChunks != FALSE && spiRet == 0)
+    {
+        chunk = nextChunk;
+        fMoreChunks = tbufp_getNextChunk(&cursor, &nextChunk);
+
+        /* NULL buffers are handled by the driver (Send zeros, drop data) */
+        chunkDesc.pReadBase_m = chunk.pRxBase_m;
+        chunkDesc.readSize_m = chunk.size_m;
+        chunkDesc.pWriteBase_m = chunk.pTxBase_m;
+        chunkDesc.writeSize_m = chunk.size_m;
+
+        spiRet = avalon_spi_tf(
+                SPI_MASTER_BASE_ADDRESS,
+                0,
+                &chunkDesc,
+                (fMoreChunks != FALSE) ? AVALON_SPI_HOLD_SS : 0
+                );
+    }
+
+    return spiRet;
+}
 
 /**
  * \}
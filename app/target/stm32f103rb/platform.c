@@ -95,6 +95,9 @@ static UART_HandleTypeDef UartHandle_l;
 static BOOL systemClockInit(void);
 static BOOL uart2init(void);
 static void initBenchmark(void);
+#if defined(STREAM_TIMING_ENABLED) || defined(TRACE_BINARY_ENABLED)
+static void initCycleCount(void);
+#endif
 
 /*============================================================================*/
 /*            P R I V A T E   D E F I N I T I O N S                           */
@@ -151,6 +154,11 @@ BOOL platform_init(void)
                 /* Initialize the benchmark pins */
                 initBenchmark();
 
+#if defined(STREAM_TIMING_ENABLED) || defined(TRACE_BINARY_ENABLED)
+                /* Start the cycle counter for the stream timing statistics */
+                initCycleCount();
+#endif
+
                 retVal = TRUE;
             }
         }
@@ -193,6 +201,20 @@ void platform_msleep(UINT32 msec_p)
     HAL_Delay(msec_p);
 }
 
+#if defined(STREAM_TIMING_ENABLED) || defined(TRACE_BINARY_ENABLED)
+/*----------------------------------------------------------------------------*/
+/**
+\brief  Get the current value of the CPU cycle counter
+
+\return The cycle counter of the data watchpoint unit
+*/
+/*----------------------------------------------------------------------------*/
+UINT32 platform_getCycleCount(void)
+{
+    return DWT->CYCCNT;
+}
+#endif
+
 /*============================================================================*/
 /*            P R I V A T E   F U N C T I O N S                               */
 /*============================================================================*/
@@ -367,6 +389,20 @@ int __io_getchar(void)
     return ret;
 }
 
+#if defined(STREAM_TIMING_ENABLED) || defined(TRACE_BINARY_ENABLED)
+/*----------------------------------------------------------------------------*/
+/**
+\brief  Enable the cycle counter of the data watchpoint unit
+*/
+/*----------------------------------------------------------------------------*/
+static void initCycleCount(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+#endif
+
 /**
  * \}
  * \}
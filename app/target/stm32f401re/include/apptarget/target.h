@@ -111,11 +111,18 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* Guard standard library functions */
 #define PSI_MEMSET(ptr, bVal, bCnt)  memset(ptr, bVal, bCnt)
 #define PSI_MEMCPY(ptr, bVal, bSize) memcpy(ptr, bVal, bSize)
+#define PSI_MEMCMP(ptr1, ptr2, bSize) memcmp(ptr1, ptr2, bSize)
 
 #define DLLEXPORT
 
 #define PACK_STRUCT __attribute__((packed))
 
+#define PSI_INLINE static inline
+
+/* Atomic operations for lock-free data structures */
+#define PSI_ATOMIC_CAS(pVal, oldVal, newVal) __sync_bool_compare_and_swap(pVal, oldVal, newVal)
+#define PSI_MEMORY_BARRIER()                 __sync_synchronize()
+
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
 /*----------------------------------------------------------------------------*/
@@ -50,6 +50,7 @@ with the POWERLINK processor. (Target is the stm32f401re board)
 /* includes                                                                   */
 /*----------------------------------------------------------------------------*/
 #include <common/pcpserial.h>
+#include <common/tbufparams.h>
 
 #include <stm32f4xx_hal_cortex.h>
 #include <stm32f4xx_hal_def.h>
@@ -127,6 +128,11 @@ static SPI_HandleTypeDef SpiHandle_l;        /**< SPI handle structure */
 static DMA_HandleTypeDef DmaRxHandle_l;      /**< DMA receive handle structure */
 static DMA_HandleTypeDef DmaTxHandle_l;      /**< DMA transmit handle structure */
 
+static BOOL fScatterTrans_l = FALSE;         /**< Scattered transfer in progress */
+static tTbufpChunkCursor chunkCursor_l;      /**< Position in the transfer segments */
+static UINT8 initTx_l[TBUF_INIT_SIZE];       /**< Stream initialization sent with a scattered transfer */
+static UINT8 initRx_l[TBUF_INIT_SIZE];       /**< Stream initialization received with a scattered transfer */
+
 /*----------------------------------------------------------------------------*/
 /* local function prototypes                                                  */
 /*----------------------------------------------------------------------------*/
@@ -134,6 +140,8 @@ static void initGpio(void);
 static BOOL initSpi(void);
 static BOOL initDma(SPI_HandleTypeDef* pSpiHandler_p);
 static void initNvic(void);
+static BOOL startChunk(tTbufpChunk* pChunk_p);
+static void finishTransfer(BOOL fError_p);
 
 /*============================================================================*/
 /*            P U B L I C   F U N C T I O N S                                 */
@@ -203,7 +211,9 @@ void pcpserial_exit(void)
 \brief  Start an serial transfer
 
 pcpserial_transfer() starts an serial transfer to exchange the process
-image with the PCP.
+image with the PCP. A contiguous image is carried out with a single DMA
+transfer. A scattered image is transferred chunk by chunk from the segment
+lists while NSS is kept active.
 
 \param[in] pHandlParam_p       The parameters of the serial transfer handler
 
@@ -222,16 +232,31 @@ BOOL pcpserial_transfer(tHandlerParam* pHandlParam_p)
     {
         if(pHandlParam_p->consDesc_m.buffSize_m == pHandlParam_p->prodDesc_m.buffSize_m)
         {
-            pConsWithInit = pHandlParam_p->consDesc_m.pBuffBase_m - 4;
-            pProdWithInit = pHandlParam_p->prodDesc_m.pBuffBase_m - 4;
-            transLen = pHandlParam_p->consDesc_m.buffSize_m + 4;
-
             /* Wait until SPI is really ready for this transfer */
             while(HAL_SPI_GetState(&SpiHandle_l) == HAL_SPI_STATE_BUSY_TX_RX)
             {
                 /* Busy wait here until transfer is finished! */
             }
 
+            if(pHandlParam_p->consDesc_m.pBuffBase_m != NULL &&
+               pHandlParam_p->prodDesc_m.pBuffBase_m != NULL)
+            {
+                /* Contiguous image -> The stream initialization precedes the buffers */
+                pConsWithInit = pHandlParam_p->consDesc_m.pBuffBase_m - 4;
+                pProdWithInit = pHandlParam_p->prodDesc_m.pBuffBase_m - 4;
+                transLen = pHandlParam_p->consDesc_m.buffSize_m + 4;
+                fScatterTrans_l = FALSE;
+            }
+            else
+            {
+                /* Scattered image -> Send the stream initialization separately */
+                tbufp_initChunkCursor(pHandlParam_p, &chunkCursor_l);
+                pConsWithInit = &initRx_l[0];
+                pProdWithInit = &initTx_l[0];
+                transLen = TBUF_INIT_SIZE;
+                fScatterTrans_l = TRUE;
+            }
+
             /* Set NSS low (active) */
             HAL_GPIO_WritePin(SPIx_SSN_GPIO_PORT, SPIx_SSN_PIN, GPIO_PIN_RESET);
 
@@ -240,6 +265,12 @@ BOOL pcpserial_transfer(tHandlerParam* pHandlParam_p)
             {
                 retVal = TRUE;
             }
+            else
+            {
+                /* Set NSS high (not active) */
+                HAL_GPIO_WritePin(SPIx_SSN_GPIO_PORT, SPIx_SSN_PIN, GPIO_PIN_SET);
+                fScatterTrans_l = FALSE;
+            }
         }
     }
 
@@ -445,6 +476,8 @@ static void initNvic(void)
 /*----------------------------------------------------------------------------*/
 void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *pSpiHandle_p)
 {
+    tTbufpChunk chunk;
+
     if(pSpiHandle_p == &SpiHandle_l)
     {
         while(HAL_SPI_GetState(pSpiHandle_p) == HAL_SPI_STATE_BUSY_TX_RX)
@@ -452,12 +485,18 @@ void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *pSpiHandle_p)
             /* Busy wait here until transfer is finished! */
         }
 
-        /* Reset SPI NSS pin */
-        HAL_GPIO_WritePin(SPIx_SSN_GPIO_PORT, SPIx_SSN_PIN, GPIO_PIN_SET);
-
-        /* Call transfer finished callback function */
-        if(pfnTransfFin_l != NULL)
-            pfnTransfFin_l(FALSE);
+        if(fScatterTrans_l != FALSE && tbufp_getNextChunk(&chunkCursor_l, &chunk))
+        {
+            /* Continue with the next segment chunk */
+            if(startChunk(&chunk) == FALSE)
+            {
+                finishTransfer(TRUE);
+            }
+        }
+        else
+        {
+            finishTransfer(FALSE);
+        }
     }
 }
 
@@ -500,6 +539,55 @@ void SPIx_DMA_TX_IRQHandler(void)
     HAL_DMA_IRQHandler(SpiHandle_l.hdmatx);
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief  Start the DMA transfer of a chunk of a scattered image
+
+The SPI DMA can only transfer full duplex chunks. pcpserial_transfer() only
+starts images with the same size in both directions, so both buffers of a
+chunk are valid. A chunk with a NULL buffer is rejected.
+
+\param pChunk_p     The chunk to transfer
+
+\return TRUE on success; FALSE on error
+*/
+/*----------------------------------------------------------------------------*/
+static BOOL startChunk(tTbufpChunk* pChunk_p)
+{
+    BOOL retVal = FALSE;
+
+    /* Sending zeros or dropping data is not supported by the DMA */
+    if(pChunk_p->pRxBase_m != NULL && pChunk_p->pTxBase_m != NULL)
+    {
+        if(HAL_SPI_TransmitReceive_DMA(&SpiHandle_l, pChunk_p->pTxBase_m,
+                pChunk_p->pRxBase_m, pChunk_p->size_m) == HAL_OK)
+        {
+            retVal = TRUE;
+        }
+    }
+
+    return retVal;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief  Finish the transfer and inform the user
+
+\param fError_p     TRUE if the transfer has failed
+*/
+/*----------------------------------------------------------------------------*/
+static void finishTransfer(BOOL fError_p)
+{
+    fScatterTrans_l = FALSE;
+
+    /* Reset SPI NSS pin */
+    HAL_GPIO_WritePin(SPIx_SSN_GPIO_PORT, SPIx_SSN_PIN, GPIO_PIN_SET);
+
+    /* Call transfer finished callback function */
+    if(pfnTransfFin_l != NULL)
+        pfnTransfFin_l(fError_p);
+}
+
 /**
  * \}
  * \}
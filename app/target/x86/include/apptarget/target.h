@@ -108,6 +108,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* Guard standard library functions */
 #define PSI_MEMSET(ptr, bVal, bCnt)  memset(ptr, bVal, bCnt)
 #define PSI_MEMCPY(ptr, bVal, bSize) memcpy(ptr, bVal, bSize)
+#define PSI_MEMCMP(ptr1, ptr2, bSize) memcmp(ptr1, ptr2, bSize)
 
 /* definitions for DLL export */
 #if _WIN32
@@ -125,6 +126,23 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
     #define PACK_STRUCT            __attribute__((packed))
 #endif
 
+/* define macro for inline functions */
+#ifdef _MSC_VER
+    #define PSI_INLINE static __inline
+#else
+    #define PSI_INLINE static inline
+#endif
+
+/* Atomic operations for lock-free data structures */
+#ifdef _MSC_VER
+    #define PSI_ATOMIC_CAS(pVal, oldVal, newVal) \
+        (InterlockedCompareExchange((volatile LONG *)(pVal), (LONG)(newVal), (LONG)(oldVal)) == (LONG)(oldVal))
+    #define PSI_MEMORY_BARRIER()                 MemoryBarrier()
+#else
+    #define PSI_ATOMIC_CAS(pVal, oldVal, newVal) __sync_bool_compare_and_swap(pVal, oldVal, newVal)
+    #define PSI_MEMORY_BARRIER()                 __sync_synchronize()
+#endif
+
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
 /*----------------------------------------------------------------------------*/
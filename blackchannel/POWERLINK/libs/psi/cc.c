@@ -99,6 +99,15 @@ typedef enum {
     kChanStatusFree      = 0x02,    /**< Channel is free for transmission */
 } tCcChanStatus;
 
+/**
+ * \brief Transmit state of a configuration channel object
+ */
+typedef enum {
+    kCcTxObjStateIdle       = 0x00,    /**< No update of the object outstanding */
+    kCcTxObjStatePending    = 0x01,    /**< Object waits for the next free transmit buffer */
+    kCcTxObjStateInFlight   = 0x02,    /**< Object is transmitted and waits for the acknowledge */
+} tCcTxObjState;
+
 typedef struct {
     UINT8                   isLocked_m;        /**< Is buffer free for filling */
     tTbufCcStructure*       pIccTxPayl_m;      /**< Pointer to the Icc transmit buffer */
@@ -112,6 +121,7 @@ typedef struct {
     tCcTxBuffer        iccTxBuffer_m;      /**< Parameters of the Icc buffer */
     tSeqNrValue        currTxSeqNr_m;      /**< Current transmit sequence number */
     tTimeoutInstance   pTimeoutInst_m;     /**< Timer instance for asynchronous transmissions */
+    tCcTxObjState      objState_m[CONF_CHAN_NUM_OBJECTS];  /**< Transmit state of each object */
 } tCcTxChannel;
 
 /**
@@ -120,6 +130,10 @@ typedef struct {
 typedef struct {
     tTbufNumLayout     idOccRx_m;           /**< Output receive buffer id */
     tTbufCcStructure*  pOccLayout_m;        /**< Pointer to the Occ transmit buffer */
+    UINT8              lastSeqNr_m;         /**< Sequence number of the last received Occ batch */
+    tTbufCcStructure   rxQueue_m[CC_RX_BATCH_QUEUE_SIZE];  /**< Received batches waiting for cc_process */
+    volatile UINT8     queueHead_m;         /**< Running index of the next batch to apply */
+    volatile UINT8     queueTail_m;         /**< Running index of the next free queue slot */
 } tCcRxChannel;
 
 /**
@@ -143,6 +157,9 @@ static BOOL cc_initIccTxBuffer(tTbufNumLayout iccId_p);
 static BOOL cc_initOccRxBuffer(tTbufNumLayout occId_p);
 static void cc_initCcObjects(void);
 static void cc_processTxObject(void);
+static void cc_processRxObjects(void);
+static void cc_finishTxObjects(void);
+static void cc_sendPendingObjects(void);
 static void cc_changeLocalSeqNr(tSeqNrValue* pSeqNr_p);
 static tCcChanStatus cc_checkIccStatus(void);
 static BOOL cc_handleOccRxObjects(UINT8* pBuffer_p, UINT16 bufSize_p,
@@ -200,6 +217,10 @@ BOOL cc_init(tCcInitParam* pCcInitParam_p)
                         ccInstance_l.txChannel_m.idIccTx_m = pCcInitParam_p->iccId_m;
                         ccInstance_l.rxChannel_m.idOccRx_m = pCcInitParam_p->occId_m;
 
+                        /* The PCP increments the Occ sequence number with each
+                           batch starting from the zeroed buffer */
+                        ccInstance_l.rxChannel_m.lastSeqNr_m = 0x00;
+
                         /* Set sequence number init value */
                         ccInstance_l.txChannel_m.currTxSeqNr_m = kSeqNrValueSecond;
 
@@ -237,6 +258,9 @@ void cc_exit(void)
 /**
 \brief    Read a PCP object via the configuration channel
 
+The payload of the object may change while it is accessed by the returned
+pointer. Use \ref cc_copyObject to get a consistent copy.
+
 \param[in]  objIdx_p           Index of the to read object
 \param[in]  objSubIdx_p        Subindex of the to read object
 
@@ -258,20 +282,73 @@ tConfChanObject* cc_readObject(UINT16 objIdx_p, UINT8 objSubIdx_p)
     return pObject;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get a consistent copy of a PCP object
+
+Unlike \ref cc_readObject the payload of the copy can't change while it is
+used. The function can be called from any context.
+
+\param[in]  objIdx_p           Index of the to read object
+\param[in]  objSubIdx_p        Subindex of the to read object
+\param[out] pObject_p          Destination of the copy
+
+\retval TRUE        Object copied
+\retval FALSE       Unable to copy the object
+*/
+/*----------------------------------------------------------------------------*/
+BOOL cc_copyObject(UINT16 objIdx_p, UINT8 objSubIdx_p,
+        tConfChanObject* pObject_p)
+{
+    BOOL fReturn = FALSE;
+    UINT8 objId;
+
+    if(pObject_p == NULL)
+    {
+        error_setError(kPsiModuleCc, kPsiConfChanInvalidParameter);
+    }
+    else
+    {
+        if(ccobject_getObjectId(objIdx_p, objSubIdx_p, &objId) != FALSE)
+        {
+            if(ccobject_copyObject(objId, pObject_p) != FALSE)
+            {
+                fReturn = TRUE;
+            }
+            else
+            {
+                /* Object list is written too often -> Retry later */
+                error_setError(kPsiModuleCc, kPsiConfChanChannelBusy);
+            }
+        }
+        else
+        {
+            error_setError(kPsiModuleCc, kPsiConfChanObjectNotFound);
+        }
+    }
+
+    return fReturn;
+}
+
 /*----------------------------------------------------------------------------*/
 /**
 \brief    Write a PCP object via the configuration channel
 
+The object is updated in the local object list and transmitted to the PCP
+with the next call of \ref cc_process. All objects written in between are
+packed into the same transmit buffer as long as they fit.
+
 \param[in] pObject_p         The object to write
 
 \retval kCcWriteStatusSuccessfull   Writing to the Cc object successful
 \retval kCcWriteStatusError         Error while writing the Cc object
-\retval kCcWriteStatusBusy          Unable to write the Cc object! Channel is busy!
+\retval kCcWriteStatusBusy          Unable to write the Cc object! Last update is still outstanding!
 */
 /*----------------------------------------------------------------------------*/
 tCcWriteStatus cc_writeObject(tConfChanObject* pObject_p)
 {
     tCcWriteStatus stateWrite = kCcWriteStatusError;
+    UINT8 objId;
 
     if(pObject_p == NULL)
     {
@@ -286,39 +363,25 @@ tCcWriteStatus cc_writeObject(tConfChanObject* pObject_p)
         }
         else
         {
-            /* Check if buffer is free for filling */
-            if(ccInstance_l.txChannel_m.iccTxBuffer_m.isLocked_m == FALSE)
+            if(ccobject_getObjectId(pObject_p->objIdx_m, pObject_p->objSubIdx_m, &objId) != FALSE)
             {
-                /* Write object data to local object list */
-                if(ccobject_writeObject(pObject_p) != FALSE)
+                /* Only one update of an object can be outstanding */
+                if(ccInstance_l.txChannel_m.objState_m[objId] != kCcTxObjStateIdle)
                 {
-                    /* Fill transmit buffer */
-                    PSI_MEMCPY(&ccInstance_l.txChannel_m.iccTxBuffer_m.pIccTxPayl_m->objPayloadLow_m,
-                            &pObject_p->objPayloadLow_m, pObject_p->objSize_m);
-
-                    /* Set object index and subindex */
-                    ami_setUint16Le((UINT8*)&ccInstance_l.txChannel_m.iccTxBuffer_m.pIccTxPayl_m->objIdx_m,
-                            pObject_p->objIdx_m);
-                    ami_setUint8Le((UINT8*)&ccInstance_l.txChannel_m.iccTxBuffer_m.pIccTxPayl_m->objSubIdx_m,
-                            pObject_p->objSubIdx_m);
-
-                    /* Set sequence number in tx buffer */
-                    ami_setUint8Le((UINT8*)&ccInstance_l.txChannel_m.iccTxBuffer_m.pIccTxPayl_m->seqNr_m,
-                            ccInstance_l.txChannel_m.currTxSeqNr_m);
-
-                    /* Lock buffer for transmission */
-                    ccInstance_l.txChannel_m.iccTxBuffer_m.isLocked_m = TRUE;
-
-                    /* Enable transmit timer */
-                    timeout_startTimer(ccInstance_l.txChannel_m.pTimeoutInst_m);
+                    stateWrite = kCcWriteStatusBusy;
+                }
+                else
+                {
+                    /* Write object data to local object list */
+                    if(ccobject_writeObject(pObject_p) != FALSE)
+                    {
+                        /* Transmit object with the next batch */
+                        ccInstance_l.txChannel_m.objState_m[objId] = kCcTxObjStatePending;
 
-                    stateWrite = kCcWriteStatusSuccessful;
+                        stateWrite = kCcWriteStatusSuccessful;
+                    }
                 }
             }
-            else
-            {
-                stateWrite = kCcWriteStatusBusy;
-            }
         }
     }
 
@@ -328,12 +391,25 @@ tCcWriteStatus cc_writeObject(tConfChanObject* pObject_p)
 /*----------------------------------------------------------------------------*/
 /**
 \brief    Process configuration channel module
+
+Applies the received objects of the PCP to the local object list. All writes
+of the object list are done in the context of this function and
+\ref cc_writeObject.
 */
 /*----------------------------------------------------------------------------*/
 void cc_process(void)
 {
+    /* Process receive channel objects */
+    cc_processRxObjects();
+
     /* Process transmit channel objects */
     cc_processTxObject();
+
+    if(ccInstance_l.txChannel_m.iccTxBuffer_m.isLocked_m == FALSE)
+    {
+        /* Forward all pending objects to the PCP */
+        cc_sendPendingObjects();
+    }
 }
 
 
@@ -347,8 +423,7 @@ void cc_process(void)
 /**
 \brief    Process the transmit objects
 
-Forward the object to the ICC buffer to update the object dictionary of the
-PCP.
+Check if the objects in the ICC buffer are acknowledged by the PCP.
 */
 /*----------------------------------------------------------------------------*/
 static void cc_processTxObject(void)
@@ -370,6 +445,8 @@ static void cc_processTxObject(void)
 
             /* Stop the timer for this message */
             timeout_stopTimer(ccInstance_l.txChannel_m.pTimeoutInst_m);
+
+            cc_finishTxObjects();
         }
         else
         {
@@ -383,9 +460,106 @@ static void cc_processTxObject(void)
 
                 /* Unlock channel anyway! */
                 ccInstance_l.txChannel_m.iccTxBuffer_m.isLocked_m = FALSE;
+
+                cc_finishTxObjects();
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Apply the received batches of objects
+
+Forwards the batches queued by \ref cc_handleOccRxObjects to the local object
+list in the order of their reception and releases their queue slots.
+*/
+/*----------------------------------------------------------------------------*/
+static void cc_processRxObjects(void)
+{
+    tCcRxChannel* pRxChan = &ccInstance_l.rxChannel_m;
+    tTbufCcStructure* pRxBatch;
+    UINT8 objCount;
+
+    while(pRxChan->queueHead_m != pRxChan->queueTail_m)
+    {
+        pRxBatch = &pRxChan->rxQueue_m[pRxChan->queueHead_m & (CC_RX_BATCH_QUEUE_SIZE - 1)];
+        objCount = ami_getUint8Le((UINT8*)&pRxBatch->objCount_m);
+
+        /* Forward the received batch of objects to the local list
+           (An invalid batch doesn't update any object and is dropped) */
+        ccobject_writeObjectBatch(pRxBatch->objData_m, CC_OBJDATA_SIZE,
+                objCount, NULL);
+
+        PSI_MEMORY_BARRIER();
+
+        pRxChan->queueHead_m++;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Release all objects of the finished transmission
+*/
+/*----------------------------------------------------------------------------*/
+static void cc_finishTxObjects(void)
+{
+    UINT8 i;
+
+    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    {
+        if(ccInstance_l.txChannel_m.objState_m[i] == kCcTxObjStateInFlight)
+        {
+            ccInstance_l.txChannel_m.objState_m[i] = kCcTxObjStateIdle;
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Pack all pending objects into the Icc transmit buffer
+
+Objects which don't fit into the buffer anymore stay pending for the next
+transmission.
+*/
+/*----------------------------------------------------------------------------*/
+static void cc_sendPendingObjects(void)
+{
+    tTbufCcStructure* pIccTxPayl = ccInstance_l.txChannel_m.iccTxBuffer_m.pIccTxPayl_m;
+    UINT8 offset = 0;
+    UINT8 objCount = 0;
+    UINT8 entrySize;
+    UINT8 i;
+
+    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    {
+        if(ccInstance_l.txChannel_m.objState_m[i] == kCcTxObjStatePending)
+        {
+            entrySize = ccobject_packObject(i, &pIccTxPayl->objData_m[offset],
+                    CC_OBJDATA_SIZE - offset);
+            if(entrySize != 0)
+            {
+                offset += entrySize;
+                objCount++;
+
+                ccInstance_l.txChannel_m.objState_m[i] = kCcTxObjStateInFlight;
             }
         }
     }
+
+    if(objCount > 0)
+    {
+        /* Set number of objects and sequence number in tx buffer */
+        ami_setUint8Le((UINT8*)&pIccTxPayl->objCount_m, objCount);
+        ami_setUint8Le((UINT8*)&pIccTxPayl->seqNr_m,
+                ccInstance_l.txChannel_m.currTxSeqNr_m);
+
+        /* Lock buffer for transmission */
+        ccInstance_l.txChannel_m.iccTxBuffer_m.isLocked_m = TRUE;
+
+        /* Enable transmit timer */
+        timeout_startTimer(ccInstance_l.txChannel_m.pTimeoutInst_m);
+    }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -463,7 +637,8 @@ static BOOL cc_initOccRxBuffer(tTbufNumLayout occId_p)
 
             /* Register object receive post action */
             if(stream_registerAction(kStreamActionPost, occId_p,
-                    cc_handleOccRxObjects, NULL) != FALSE)
+                    cc_handleOccRxObjects, NULL, kStreamActionPrioAsync,
+                    kStreamActionCondAlways) != FALSE)
             {
                 fReturn = TRUE;
             }
@@ -562,20 +737,28 @@ static tCcChanStatus cc_checkIccStatus(void)
 /**
 \brief    Handle incoming objects from the occ buffer
 
+The PCP leaves the last batch in the buffer until it has new objects to send.
+A batch is therefore only taken when its sequence number changed. It is copied
+to the receive queue and applied later by \ref cc_processRxObjects, so the
+object list is only written in the context of \ref cc_process. The queue
+keeps the batches which arrive before cc_process runs. Only if it is full the
+new batch stays in the buffer and is taken in one of the next cycles.
+
 \param[in] pBuffer_p        Pointer to the base address of the buffer
 \param[in] bufSize_p        Size of the buffer
 \param[in] pUserArg_p       The user argument
 
-\retval TRUE        Successfully written to object list
-\retval FALSE       Error while writing to object list
+\retval TRUE        Successfully handled the buffer
+\retval FALSE       Error while handling the buffer
 */
 /*----------------------------------------------------------------------------*/
 static BOOL cc_handleOccRxObjects(UINT8* pBuffer_p, UINT16 bufSize_p,
         void* pUserArg_p)
 {
     BOOL fReturn = FALSE;
-    tCcWriteState  writeState;
+    tCcRxChannel* pRxChan = &ccInstance_l.rxChannel_m;
     tTbufCcStructure*  pOccBuff;
+    UINT8 seqNr;
 
     UNUSED_PARAMETER(bufSize_p);
     UNUSED_PARAMETER(pUserArg_p);
@@ -583,25 +766,25 @@ static BOOL cc_handleOccRxObjects(UINT8* pBuffer_p, UINT16 bufSize_p,
     /* Convert to configuration channel buffer structure */
     pOccBuff = (tTbufCcStructure*) pBuffer_p;
 
-    /* Increment transmit timer cycle count */
-    timeout_incrementCounter(ccInstance_l.txChannel_m.pTimeoutInst_m);
-
-    /* Forward receive objects to local list */
-    writeState = ccobject_writeCurrObject(pOccBuff->objIdx_m, pOccBuff->objSubIdx_m,
-                 (UINT8*)&pOccBuff->objPayloadLow_m);
-    if(writeState == kCcWriteStateSuccessful)
+    seqNr = ami_getUint8Le((UINT8*)&pOccBuff->seqNr_m);
+    if(seqNr != pRxChan->lastSeqNr_m &&
+       (UINT8)(pRxChan->queueTail_m - pRxChan->queueHead_m) < CC_RX_BATCH_QUEUE_SIZE)
     {
-        /* Increment local object write pointer */
-        ccobject_incObjWritePointer();
+        /* New batch -> Take it only once, otherwise it would overwrite
+           objects the application has written in the meantime */
+        pRxChan->lastSeqNr_m = seqNr;
 
-        fReturn = TRUE;
-    }
-    else
-    {
-        /* Don't update object and wait for sync again */
-        fReturn = TRUE;
+        PSI_MEMCPY(&pRxChan->rxQueue_m[pRxChan->queueTail_m & (CC_RX_BATCH_QUEUE_SIZE - 1)],
+                pOccBuff, sizeof(tTbufCcStructure));
+
+        PSI_MEMORY_BARRIER();
+
+        /* Apply the batch in the background */
+        pRxChan->queueTail_m++;
     }
 
+    fReturn = TRUE;
+
     return fReturn;
 }
 
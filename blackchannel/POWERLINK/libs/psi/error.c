@@ -7,8 +7,11 @@
 
 \brief  Library internal error handler
 
-Application interface error handler module. Handles each occurred error and
-forwards a trace to the user layer.
+Application interface error handler module. Each occurred error is pushed to
+a fixed size ring from whatever context raised it (e.g. the synchronous
+interrupt). Repeated errors are coalesced into one entry with a counter. The
+ring is drained in the background loop which forwards the errors to the user
+layer. If the ring is full the number of lost errors is reported instead.
 
 \ingroup group_libpsi
 *******************************************************************************/
@@ -77,16 +80,35 @@ forwards a trace to the user layer.
 /* const defines                                                              */
 /*----------------------------------------------------------------------------*/
 
+#define ERROR_RING_MASK         (ERROR_RING_SIZE - 1)
+
+/* Layout of an error entry: Source module, error code and occurrence count */
+#define ERROR_COUNT_MASK        0x0000FFFFUL
+#define ERROR_KEY_SHIFT         16
+#define ERROR_CODE_MASK         0x03FFU
+#define ERROR_MODULE_SHIFT      10
+
+#define ERROR_MAKE_KEY(module_p, code_p)    \
+    (((((UINT32)(module_p)) << ERROR_MODULE_SHIFT) | (((UINT32)(code_p)) & ERROR_CODE_MASK)) << ERROR_KEY_SHIFT)
+
 /*----------------------------------------------------------------------------*/
 /* local types                                                                */
 /*----------------------------------------------------------------------------*/
 
 /**
 * \brief Error handler user instance type
+*
+* The ring has multiple producers (All contexts which call error_setError())
+* and the background loop as single consumer. An entry is one word which holds
+* the error and the occurrence count. (0: Entry is free or not written yet)
 */
 typedef struct
 {
-    tErrorHandler   pfnErrorHandler_m;    /**< Error module error handler */
+    tErrorHandler   pfnErrorHandler_m;              /**< Error module error handler */
+    volatile UINT32 ring_m[ERROR_RING_SIZE];        /**< Ring of the not reported errors */
+    volatile UINT32 writeIdx_m;                     /**< Number of claimed ring entries */
+    volatile UINT32 readIdx_m;                      /**< Number of reported ring entries */
+    volatile UINT32 lostCount_m;                    /**< Errors lost because the ring was full */
 } tErrorInstance;
 
 /*----------------------------------------------------------------------------*/
@@ -98,6 +120,8 @@ static tErrorInstance        errorInstance_l;
 /*----------------------------------------------------------------------------*/
 /* local function prototypes                                                  */
 /*----------------------------------------------------------------------------*/
+static BOOL coalesceError(UINT32 key_p);
+static void reportError(UINT32 entry_p);
 
 
 /*============================================================================*/
@@ -133,34 +157,113 @@ BOOL error_init(tErrorHandler pfnErrorHandler_p)
 /*----------------------------------------------------------------------------*/
 /**
 \brief    Destroy the error handler module
+
+All errors which are still buffered are reported to the error handler.
 */
 /*----------------------------------------------------------------------------*/
 void error_exit(void)
 {
-
+    error_process();
 }
 
 /*----------------------------------------------------------------------------*/
 /**
 \brief    Set error to error handler module
 
+The error is buffered until the next call of error_process(). This function
+is safe to be called from any context and has a bounded runtime.
+
 \param  srcModule_p     Module source of the error
 \param  errCode_p       Code of the error
 */
 /*----------------------------------------------------------------------------*/
 void error_setError(tPsiModules srcModule_p, tPsiStatus errCode_p)
 {
-    tPsiErrorInfo errInfo;
+    UINT32 key = ERROR_MAKE_KEY(srcModule_p, errCode_p);
+    UINT32 writeIdx;
+    UINT32 lostCount;
 
     if(errorInstance_l.pfnErrorHandler_m != NULL)
     {
-        errInfo.srcModule_m = srcModule_p;
-        errInfo.errCode_m = errCode_p;
+        if(coalesceError(key) == FALSE)
+        {
+            /* Claim a new entry */
+            do
+            {
+                writeIdx = errorInstance_l.writeIdx_m;
+            } while((UINT32)(writeIdx - errorInstance_l.readIdx_m) < ERROR_RING_SIZE &&
+                    !PSI_ATOMIC_CAS(&errorInstance_l.writeIdx_m, writeIdx, writeIdx + 1));
+
+            if((UINT32)(writeIdx - errorInstance_l.readIdx_m) < ERROR_RING_SIZE)
+            {
+                /* Publish the entry with a single store */
+                errorInstance_l.ring_m[writeIdx & ERROR_RING_MASK] = key | 1;
+            }
+            else
+            {
+                /* Ring is full -> Count the lost error */
+                do
+                {
+                    lostCount = errorInstance_l.lostCount_m;
+                } while(!PSI_ATOMIC_CAS(&errorInstance_l.lostCount_m, lostCount, lostCount + 1));
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Report all buffered errors to the error handler
+
+Call this function in the background loop. The error handler is called once
+for each buffered entry and once for the lost errors if the ring was full.
+*/
+/*----------------------------------------------------------------------------*/
+void error_process(void)
+{
+    UINT32 readIdx = errorInstance_l.readIdx_m;
+    UINT32 entry;
+    UINT32 lostCount;
+    volatile UINT32* pEntry;
+
+    while(readIdx != errorInstance_l.writeIdx_m)
+    {
+        pEntry = &errorInstance_l.ring_m[readIdx & ERROR_RING_MASK];
+
+        entry = *pEntry;
+        if(entry == 0)
+        {
+            /* Entry is claimed but not written yet -> Report it next time */
+            break;
+        }
 
-        /* Call error handler to inform application */
-        errorInstance_l.pfnErrorHandler_m(&errInfo);
+        /* Take the entry and the current occurrence count */
+        while(!PSI_ATOMIC_CAS(pEntry, entry, 0))
+        {
+            entry = *pEntry;
+        }
+
+        readIdx++;
+        errorInstance_l.readIdx_m = readIdx;
+
+        reportError(entry);
     }
 
+    lostCount = errorInstance_l.lostCount_m;
+    if(lostCount != 0)
+    {
+        while(!PSI_ATOMIC_CAS(&errorInstance_l.lostCount_m, lostCount, 0))
+        {
+            lostCount = errorInstance_l.lostCount_m;
+        }
+
+        if(lostCount > ERROR_COUNT_MASK)
+        {
+            lostCount = ERROR_COUNT_MASK;
+        }
+
+        reportError(ERROR_MAKE_KEY(kPsiModuleInternal, kPsiErrorRingOverflow) | lostCount);
+    }
 }
 
 /*============================================================================*/
@@ -169,6 +272,64 @@ void error_setError(tPsiModules srcModule_p, tPsiStatus errCode_p)
 /** \name Private Functions */
 /** \{ */
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Count an error in the newest not reported entry
+
+\param  key_p           Source module and code of the error
+
+\retval TRUE     Error is counted in the newest entry
+\retval FALSE    The newest entry holds a different error or is reported
+*/
+/*----------------------------------------------------------------------------*/
+static BOOL coalesceError(UINT32 key_p)
+{
+    BOOL fReturn = FALSE;
+    UINT32 writeIdx = errorInstance_l.writeIdx_m;
+    volatile UINT32* pEntry;
+    UINT32 entry;
+
+    if(writeIdx != errorInstance_l.readIdx_m)
+    {
+        pEntry = &errorInstance_l.ring_m[(writeIdx - 1) & ERROR_RING_MASK];
+
+        entry = *pEntry;
+        while((entry & ~ERROR_COUNT_MASK) == key_p && (entry & ERROR_COUNT_MASK) != 0)
+        {
+            if((entry & ERROR_COUNT_MASK) == ERROR_COUNT_MASK ||
+               PSI_ATOMIC_CAS(pEntry, entry, entry + 1))
+            {
+                /* Counted (The count saturates) */
+                fReturn = TRUE;
+                break;
+            }
+
+            entry = *pEntry;
+        }
+    }
+
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Forward one error entry to the error handler
+
+\param  entry_p         The error entry
+*/
+/*----------------------------------------------------------------------------*/
+static void reportError(UINT32 entry_p)
+{
+    tPsiErrorInfo errInfo;
+
+    errInfo.srcModule_m = (tPsiModules)(entry_p >> (ERROR_KEY_SHIFT + ERROR_MODULE_SHIFT));
+    errInfo.errCode_m = (tPsiStatus)((entry_p >> ERROR_KEY_SHIFT) & ERROR_CODE_MASK);
+    errInfo.count_m = (UINT16)(entry_p & ERROR_COUNT_MASK);
+
+    /* Call error handler to inform application */
+    errorInstance_l.pfnErrorHandler_m(&errInfo);
+}
+
 /**
  * \}
  * \}
@@ -83,5 +83,7 @@ DLLEXPORT void cc_exit(void);
 
 DLLEXPORT tCcWriteStatus cc_writeObject(tConfChanObject* pObject_p);
 DLLEXPORT tConfChanObject* cc_readObject(UINT16 objIdx_p, UINT8 objSubIdx_p);
+DLLEXPORT BOOL cc_copyObject(UINT16 objIdx_p, UINT8 objSubIdx_p,
+        tConfChanObject* pObject_p);
 
 #endif /* _INC_libpsi_cc_H_ */
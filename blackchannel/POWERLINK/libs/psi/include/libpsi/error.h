@@ -60,6 +60,7 @@ typedef struct
 {
     tPsiModules  srcModule_m;       /**< Source module of the error */
     tPsiStatus   errCode_m;         /**< Code of the error */
+    UINT16       count_m;           /**< Number of occurrences (Repeated errors are reported once) */
 } tPsiErrorInfo;
 
 /**
@@ -4,8 +4,8 @@
 
 \brief  Library internal header for the error handler module
 
-Application interface error handler module. Handles each occurred error and
-forwards a trace to the user layer.
+Application interface error handler module. Buffers each occurred error and
+forwards it to the user layer in the background loop.
 
 *******************************************************************************/
 
@@ -48,6 +48,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*----------------------------------------------------------------------------*/
 /* const defines                                                              */
 /*----------------------------------------------------------------------------*/
+#define ERROR_RING_SIZE         16      /**< Number of errors buffered until the background loop reports them (Power of two) */
+
+/* Detect configuration errors */
+#if (ERROR_RING_SIZE == 0) || ((ERROR_RING_SIZE & (ERROR_RING_SIZE - 1)) != 0)
+#error "ERROR_RING_SIZE needs to be a power of two"
+#endif
 
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
@@ -60,5 +66,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 BOOL error_init(tErrorHandler pfnErrorHandler_p);
 void error_exit(void);
 
+void error_process(void);
+
 
 #endif /* _INC_libpsi_internal_error_H_ */
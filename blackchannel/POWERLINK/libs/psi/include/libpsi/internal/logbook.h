@@ -48,6 +48,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* const defines                                                              */
 /*----------------------------------------------------------------------------*/
 #define LOG_TX_TIMEOUT_CYCLE_COUNT        400     /**< Number of cycles after a transmit has a timeout */
+#define LOG_TX_MIN_TIMEOUT_CYCLE_COUNT    100     /**< Lowest timeout the measured round trip time can select */
 
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
@@ -61,6 +61,23 @@ typedef struct {
     tTbufLogStructure*      pLogTxPayl_m;      /**< Pointer to transmit buffer */
 } tTbufLogBuffer;
 
+/**
+ * \brief Slot of the logbook entry ring
+ */
+typedef struct {
+    tLogFormat              logData_m;         /**< The logbook entry */
+    volatile UINT32         seq_m;             /**< Ring position for which the slot is free (pos) or committed (pos + 1) */
+} tLogRingSlot;
+
+/**
+ * \brief Multi producer single consumer ring of logbook entries
+ */
+typedef struct {
+    tLogRingSlot            slot_m[LOG_RING_SIZE];   /**< The entry slots */
+    volatile UINT32         reservePos_m;      /**< Ring position of the next slot to reserve (All producers) */
+    UINT32                  drainPos_m;        /**< Ring position of the next slot to drain (Consumer only) */
+} tLogRing;
+
 /**
 \brief Logbook channel user instance
 
@@ -75,6 +92,12 @@ struct eLogInstance
     tSeqNrValue           currTxSeqNr_m;        /**< Current transmit sequence number */
     UINT8                 currTxBuffer_m;       /**< Current active transmit buffer */
     tTimeoutInstance      pTimeoutInst_m;       /**< Timer instance for a logbook transmissions */
+    UINT8                 fBatchMode_m;         /**< Several compact entries are packed into one transfer */
+    tLogRing              entryRing_m;          /**< Posted entries waiting for the drain */
+    tLogFormat            stageEntry_m;         /**< Single entry waiting for transmission */
+    tLogBatchFormat       stageBatch_m;         /**< Compact entries waiting for transmission */
+    UINT8                 stageCount_m;         /**< Number of entries waiting for transmission */
+    UINT8                 fStageBatch_m;        /**< Waiting entries are compact entries */
 };
 
 /*----------------------------------------------------------------------------*/
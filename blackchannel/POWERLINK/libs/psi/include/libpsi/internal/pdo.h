@@ -58,4 +58,6 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* function prototypes                                                        */
 /*----------------------------------------------------------------------------*/
 
+void pdo_init(void);
+
 #endif /* _INC_libpsi_internal_pdo_H_ */
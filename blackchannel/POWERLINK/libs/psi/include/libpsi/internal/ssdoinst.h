@@ -56,22 +56,36 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* typedef                                                                    */
 /*----------------------------------------------------------------------------*/
 
+/**
+ * \brief Frame slot of the transmit queue
+ */
 typedef struct {
-    UINT8                   isLocked_m;        /**< Is buffer free for filling */
-    tTbufSsdoTxStructure*   pSsdoTxPayl_m;    /**< Pointer to transmit buffer */
-} tTbufSsdoTxBuffer;
+    UINT16                  paylSize_m;                             /**< Size of the queued payload */
+    UINT8                   payload_m[TSSDO_TRANSMIT_DATA_SIZE];    /**< Payload of the queued frame */
+} tSsdoTxSlot;
 
 /**
  * \brief Parameter type of the transmit buffer
  */
 typedef struct {
-    tTbufNumLayout        idTxBuff_m;           /**< Id of the transmit buffer */
-    tTbufSsdoTxBuffer     ssdoTxBuffer_m;       /**< SSDO transmit buffer copy */
-    tSeqNrValue           currTxSeqNr_m;        /**< Current transmit sequence number */
-    UINT8                 currTxBuffer_m;       /**< Current active transmit buffer */
-    tTimeoutInstance      pTimeoutInst_m;       /**< Timer instance for SSDO transmissions */
+    tTbufNumLayout          idTxBuff_m;           /**< Id of the transmit buffer */
+    tTbufSsdoTxStructure*   pSsdoTxPayl_m;        /**< Pointer to transmit buffer */
+    tSsdoTxSlot             txQueue_m[SSDO_TX_QUEUE_SIZE];      /**< Frames waiting for acknowledge */
+    UINT8                   queueHead_m;          /**< Running index of the oldest unacknowledged frame */
+    UINT8                   queueTail_m;          /**< Running index of the next free queue slot */
+    UINT8                   fFrameInFlight_m;     /**< Oldest frame is posted to the transmit buffer */
+    tSeqNrValue             currTxSeqNr_m;        /**< Current transmit sequence number */
+    tTimeoutInstance        pTimeoutInst_m;       /**< Timer instance for SSDO transmissions */
 } tSsdoTxChannel;
 
+/**
+ * \brief Frame in the receive queue
+ */
+typedef struct {
+    UINT16                  paylSize_m;                             /**< Size of the received payload */
+    UINT8                   payload_m[SSDO_STUB_DATA_DOM_SIZE];     /**< Payload of the received frame */
+} tSsdoRxSlot;
+
 /**
  * \brief Parameter type of the receive buffer
  */
@@ -80,7 +94,9 @@ typedef struct {
     tSsdoRxHandler         pfnRxHandler_m;      /**< SSDO module receive handler */
     tTbufSsdoRxStructure*  pSsdoRxBuffer_m;     /**< Pointer to receive buffer */
     tSeqNrValue            currRxSeqNr_m;       /**< Current receive sequence number */
-    UINT8                  fRxFrameIncoming_m;  /**< Receive buffer incoming flag */
+    tSsdoRxSlot            rxQueue_m[SSDO_RX_QUEUE_SIZE];   /**< Received frames waiting for the user */
+    UINT8                  queueHead_m;         /**< Running index of the frame forwarded to the user */
+    UINT8                  queueTail_m;         /**< Running index of the next free queue slot */
 } tSsdoRxChannel;
 
 /**
@@ -51,6 +51,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*----------------------------------------------------------------------------*/
 #define PDO_CHANNEL_DEACTIVATED     0xFF    /**< Id of an deactivated PDO channel */
 
+#define STREAM_TRANS_TIMEOUT_CYCLE_COUNT    2   /**< Default number of cycles an asynchronous transfer may be in progress */
+
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
 /*----------------------------------------------------------------------------*/
@@ -64,6 +66,25 @@ typedef enum {
     kStreamActionPost     = 0x02,
 } tActionType;
 
+/**
+ * \brief  Priority of a buffer action -> Lower values are triggered first!
+ */
+typedef enum {
+    kStreamActionPrioStatus   = 0x00,   /**< Status register handling */
+    kStreamActionPrioPdo      = 0x01,   /**< Process data handling */
+    kStreamActionPrioAsync    = 0x02,   /**< Asynchronous channels (SSDO, logbook, cc) */
+    kStreamActionPrioCount    = 0x03,
+} tActionPrio;
+
+/**
+ * \brief  Condition to trigger a buffer action
+ */
+typedef enum {
+    kStreamActionCondAlways   = 0x00,   /**< Trigger action in each cycle */
+    kStreamActionCondChanged  = 0x01,   /**< Trigger action only if the buffer content changed (Only consuming buffers in double buffered mode) */
+    kStreamActionCondCount    = 0x02,
+} tActionCond;
+
 /**
  * \brief Callback for stream buffer action. Called to inform module about new data.
  */
@@ -84,6 +105,10 @@ typedef struct {
     tTbufNumLayout   idConsAck_m;          /**< Id of the consumer ack register */
     tTbufNumLayout   idFirstProdBuffer_m;  /**< Id of the first producing buffer */
     tStreamHandler   pfnStreamHandler_m;   /**< Stream receive and transmit handler */
+    tBuffDescriptor* pTransDescList_m;     /**< Descriptor list of the transfer image (NULL: single buffered) */
+    tStreamCycleCount pfnCycleCount_m;     /**< Cycle counter for the timing statistics (NULL: not measured) */
+    BOOL             fAsyncTransfer_m;     /**< TRUE: Transfer is finished with stream_transferFinished() */
+    UINT8            transTimeoutCycles_m; /**< Cycles an asynchronous transfer may be in progress (0: STREAM_TRANS_TIMEOUT_CYCLE_COUNT) */
 } tStreamInitParam;
 
 /*----------------------------------------------------------------------------*/
@@ -94,9 +119,15 @@ void stream_exit(void);
 
 tBuffDescriptor* stream_getBufferParam(tTbufNumLayout buffId_p);
 BOOL stream_registerAction(tActionType actType_p, UINT8 buffId_p,
+        tBuffAction pfnBuffAct_p, void * pUserArg_p, tActionPrio prio_p,
+        tActionCond cond_p);
+BOOL stream_unregisterAction(tActionType actType_p, UINT8 buffId_p,
         tBuffAction pfnBuffAct_p, void * pUserArg_p);
+BOOL stream_setActionRate(tActionType actType_p, UINT8 buffId_p,
+        UINT8 cycleDiv_p, UINT8 cyclePhase_p);
 void stream_registerSyncCb(tBuffSyncCb pfnSyncCb_p);
 BOOL stream_processSync(void);
 BOOL stream_processPostActions(void);
+BOOL stream_transferFinished(BOOL fError_p);
 
 #endif /* _INC_libpsi_intenal_stream_H_ */
@@ -72,6 +72,7 @@ typedef struct eLogInstance *tLogInstance;
  */
 typedef struct {
     tTbufNumLayout         buffIdTx_m;      /**< Id of the transmit buffer */
+    BOOL                   fBatchMode_m;    /**< TRUE: Pack several compact entries into one transfer */
 } tLogInitParam;
 
 
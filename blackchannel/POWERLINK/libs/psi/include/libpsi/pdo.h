@@ -61,21 +61,25 @@ typedef BOOL (* tPsiPdoCb) ( UINT32 rpdoRelTimeLow_p,
         tRpdoMappedObj* pRpdoImage_p,
         tTpdoMappedObj* pTpdoImage_p );  /**< Pdo user callback function */
 
+typedef struct ePdoInstance *tPdoInstance;
+
 /**
  * \brief  Pdo module initialization structure
  */
 typedef struct {
     tTbufNumLayout     buffIdRpdo_m;      /**< Id of the rpdo buffer */
     tTbufNumLayout     buffIdTpdo_m;      /**< Id of the tpdo buffer */
+    BOOL               fRpdoChangeOnly_m; /**< TRUE: Call the user callback only if the rpdo objects changed */
 } tPdoInitParam;
 
 /*----------------------------------------------------------------------------*/
 /* function prototypes                                                        */
 /*----------------------------------------------------------------------------*/
-DLLEXPORT BOOL pdo_init(tPsiPdoCb pfnPdoCb_p, tPdoInitParam* pPdoInitParam_p);
-DLLEXPORT void pdo_exit(void);
+DLLEXPORT tPdoInstance pdo_create(tPdoChanNum chanId_p, tPsiPdoCb pfnPdoCb_p,
+                                  tPdoInitParam* pPdoInitParam_p);
+DLLEXPORT void pdo_destroy(tPdoInstance pInstance_p);
 
-DLLEXPORT tTpdoMappedObj * pdo_getTpdoImage(void);
-DLLEXPORT tRpdoMappedObj * pdo_getRpdoImage(void);
+DLLEXPORT tTpdoMappedObj * pdo_getTpdoImage(tPdoInstance pInstance_p);
+DLLEXPORT tRpdoMappedObj * pdo_getRpdoImage(tPdoInstance pInstance_p);
 
 #endif /* _INC_libpsi_pdo_H_ */
@@ -74,6 +74,10 @@ typedef struct {
     tTbufNumLayout      idConsAck_m;          /**< Id of the consumer acknowledge register */
     tTbufNumLayout      idProdAck_m;          /**< Id of the producer acknowledge register */
     tTbufNumLayout      idFirstProdBuffer_m;  /**< Id of the first producing buffer */
+    tBuffDescriptor*    pTransDescList_m;     /**< Descriptor list of the transfer image (NULL: single buffered) */
+    tStreamCycleCount   pfnCycleCount_m;      /**< Cycle counter for the stream timing statistics (NULL: not measured) */
+    BOOL                fAsyncTransfer_m;     /**< TRUE: Stream handler finishes the transfer with psi_transferFinished() */
+    UINT8               transTimeoutCycles_m; /**< Cycles an asynchronous transfer may be in progress (0: Default of the stream module) */
 } tPsiInitParam;
 
 /*----------------------------------------------------------------------------*/
@@ -85,6 +89,7 @@ DLLEXPORT void psi_exit(void);
 DLLEXPORT BOOL psi_processSync(void);
 
 DLLEXPORT BOOL psi_processPostTransferActions(void);
+DLLEXPORT BOOL psi_transferFinished(BOOL fError_p);
 
 DLLEXPORT BOOL psi_processAsync(void);
 
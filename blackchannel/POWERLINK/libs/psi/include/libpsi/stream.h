@@ -48,7 +48,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*----------------------------------------------------------------------------*/
 /* const defines                                                              */
 /*----------------------------------------------------------------------------*/
+#ifdef STREAM_TIMING_ENABLED
 
+#ifndef STREAM_TIMING_HIST_BINS
+  #define STREAM_TIMING_HIST_BINS   8    /**< Number of histogram bins of a timing statistic */
+#endif
+
+#ifndef STREAM_TIMING_HIST_SHIFT
+  #define STREAM_TIMING_HIST_SHIFT  6    /**< Upper limit of the first histogram bin (2^x cycles) */
+#endif
+
+#endif /* #ifdef STREAM_TIMING_ENABLED */
 
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
@@ -61,12 +71,27 @@ typedef struct {
     UINT16     buffSize_m;     /**< Size of the buffer */
 } tBuffDescriptor;
 
+/**
+ * \brief List of payload segments of one transfer direction
+ */
+typedef struct {
+    tBuffDescriptor* pSegList_m;     /**< Segments in the order of the transfer */
+    UINT8            segCount_m;     /**< Number of segments in the list */
+} tSegmentList;
+
 /**
  * \brief Parameters of the stream handler callback function
+ *
+ * The segment lists describe the payload buffer by buffer and are always
+ * valid. The contiguous descriptors are only valid if all buffers of one
+ * direction are located back to back in memory. Otherwise the base address
+ * of the contiguous descriptor is NULL.
  */
 typedef struct {
     tBuffDescriptor consDesc_m;      /**< Descriptor of the incoming consuming payload */
     tBuffDescriptor prodDesc_m;      /**< Descriptor of the outgoing producing payload */
+    tSegmentList    consSegs_m;      /**< Segments of the incoming consuming payload */
+    tSegmentList    prodSegs_m;      /**< Segments of the outgoing producing payload */
 } tHandlerParam;
 
 /**
@@ -74,9 +99,46 @@ typedef struct {
  */
 typedef BOOL (*tStreamHandler) (tHandlerParam* pHandlParam_p);
 
+/**
+ * \brief Target specific free running cycle counter
+ */
+typedef UINT32 (*tStreamCycleCount) (void);
+
+#ifdef STREAM_TIMING_ENABLED
+
+/**
+ * \brief Source of a timing statistic
+ */
+typedef enum {
+    kStreamTimingPreAction    = 0x00,   /**< Action before the stream handler */
+    kStreamTimingPostAction   = 0x01,   /**< Action after the stream handler */
+    kStreamTimingHandler      = 0x02,   /**< Call of the stream handler */
+} tStreamTimingSrc;
+
+/**
+ * \brief Execution time statistic of an action in cycles of the cycle counter
+ *
+ * Bin 0 of the histogram counts all durations below 2^STREAM_TIMING_HIST_SHIFT
+ * cycles. Each further bin doubles the upper limit and the last bin counts
+ * all longer durations.
+ */
+typedef struct {
+    UINT32    count_m;                              /**< Number of measurements */
+    UINT32    min_m;                                /**< Shortest duration */
+    UINT32    max_m;                                /**< Longest duration */
+    UINT32    mean_m;                               /**< Mean duration */
+    UINT16    hist_m[STREAM_TIMING_HIST_BINS];      /**< Histogram of the durations (Saturating) */
+} tStreamTiming;
+
+#endif /* #ifdef STREAM_TIMING_ENABLED */
+
 /*----------------------------------------------------------------------------*/
 /* function prototypes                                                        */
 /*----------------------------------------------------------------------------*/
-
+#ifdef STREAM_TIMING_ENABLED
+DLLEXPORT BOOL stream_getTiming(tStreamTimingSrc src_p, UINT8 buffId_p,
+        tStreamTiming* pTiming_p);
+DLLEXPORT void stream_resetTiming(void);
+#endif
 
 #endif /* _INC_libpsi_stream_H_ */
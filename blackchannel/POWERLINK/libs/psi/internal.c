@@ -53,6 +53,7 @@ processes the synchronous and asynchronous task.
 #include <libpsi/psi.h>
 
 #include <libpsi/internal/stream.h>
+#include <libpsi/internal/pdo.h>
 #include <libpsi/internal/ssdo.h>
 #include <libpsi/internal/logbook.h>
 #include <libpsi/internal/cc.h>
@@ -183,6 +184,9 @@ BOOL psi_init(tPsiInitParam* pInitParam_p)
         }
     }
 
+    /* Report the errors of the initialization */
+    error_process();
+
     return fReturn;
 }
 
@@ -243,10 +247,38 @@ BOOL psi_processPostTransferActions(void)
     return fReturn;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Finish an asynchronous transfer of the input/output image
+
+This function is the completion event of a stream handler which carries out
+the transfer in the background. On a successful transfer all post transfer
+actions are processed.
+
+\param[in]  fError_p      TRUE if the transfer has failed
+
+\retval TRUE      Successfully processed the post transfer actions
+\retval FALSE     Transfer failed, unexpected event or post actions failed
+*/
+/*----------------------------------------------------------------------------*/
+BOOL psi_transferFinished(BOOL fError_p)
+{
+    BOOL fReturn = FALSE;
+
+    if(stream_transferFinished(fError_p) != FALSE)
+    {
+        fReturn = TRUE;
+    }
+
+    return fReturn;
+}
+
 /*----------------------------------------------------------------------------*/
 /**
 \brief    Process slim interface asynchronous task
 
+The errors of the library are reported to the error handler in this task.
+
 \retval  TRUE         Async processing successful
 \retval  FALSE        Error while processing async
 */
@@ -258,6 +290,9 @@ BOOL psi_processAsync(void)
     cc_process();
 #endif
 
+    /* Report the errors of the synchronous and asynchronous tasks */
+    error_process();
+
     return TRUE;
 }
 
@@ -282,6 +317,11 @@ static BOOL psi_initIntModules(tPsiInitParam* pInitParam_p)
     BOOL fReturn = FALSE;
     tStreamInitParam streamInitParam;
 
+#if(((PSI_MODULE_INTEGRATION) & (PSI_MODULE_PDO)) != 0)
+    /* Initialize the PDO module */
+    pdo_init();
+#endif
+
 #if(((PSI_MODULE_INTEGRATION) & (PSI_MODULE_SSDO)) != 0)
     /* Initialize the SSDO module */
     ssdo_init();
@@ -303,6 +343,10 @@ static BOOL psi_initIntModules(tPsiInitParam* pInitParam_p)
     streamInitParam.pfnStreamHandler_m = pInitParam_p->pfnStreamHandler_m;
     streamInitParam.idConsAck_m = pInitParam_p->idConsAck_m;
     streamInitParam.idFirstProdBuffer_m = pInitParam_p->idFirstProdBuffer_m;
+    streamInitParam.pTransDescList_m = pInitParam_p->pTransDescList_m;
+    streamInitParam.pfnCycleCount_m = pInitParam_p->pfnCycleCount_m;
+    streamInitParam.fAsyncTransfer_m = pInitParam_p->fAsyncTransfer_m;
+    streamInitParam.transTimeoutCycles_m = pInitParam_p->transTimeoutCycles_m;
 
     if(stream_init(&streamInitParam) != FALSE)
     {
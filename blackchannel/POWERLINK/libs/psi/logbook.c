@@ -110,10 +110,14 @@ static struct eLogInstance          logInstance_l[kNumLogInstCount];
 static BOOL log_initTransmitBuffer(tLogChanNum chanId_p,
         tTbufNumLayout txBuffId_p);
 static void log_handleTxFrame(tLogInstance pInstance_p);
-static BOOL log_incrTimeout(UINT8* pBuffer_p, UINT16 bufSize_p,
-                            void* pUserArg_p);
 static void log_changeLocalSeqNr(tSeqNrValue* pSeqNr_p);
 static tLogChanStatus log_checkChannelStatus(tLogInstance pInstance_p);
+static tLogTxStatus log_stageEntry(tLogInstance pInstance_p, tLogFormat* pLogData_p);
+static void log_sendStagedEntries(tLogInstance pInstance_p);
+static void log_initRing(tLogRing* pRing_p);
+static tLogFormat* log_peekRing(tLogRing* pRing_p);
+static void log_popRing(tLogRing* pRing_p);
+static void log_drainRing(tLogInstance pInstance_p);
 
 /*============================================================================*/
 /*            P U B L I C   F U N C T I O N S                                 */
@@ -172,6 +176,12 @@ tLogInstance log_create(tLogChanNum chanId_p, tLogInitParam* pInitParam_p)
                 /* Set sequence number init value */
                 logInstance_l[chanId_p].currTxSeqNr_m = kSeqNrValueSecond;
 
+                /* Remember if entries are batched */
+                logInstance_l[chanId_p].fBatchMode_m = (pInitParam_p->fBatchMode_m != FALSE) ? TRUE : FALSE;
+
+                /* All ring slots are free */
+                log_initRing(&logInstance_l[chanId_p].entryRing_m);
+
                 /* Set valid instance id */
                 pInstance = &logInstance_l[chanId_p];
             }
@@ -200,25 +210,53 @@ void log_destroy(tLogInstance pInstance_p)
 
 /*----------------------------------------------------------------------------*/
 /**
-\brief    Returns the address of the current logbook buffer
+\brief    Reserve a logbook buffer for a new entry
+
+Reserves a free slot of the entry ring without locking. This function can be
+called from interrupt and background context at the same time. Each reserved
+buffer needs to be handed back with log_postLogEntry().
 
 \param[in]  pInstance_p      Logbook module instance
 \param[out] ppLogData_p      Pointer to the result address of the payload
 
 \retval TRUE    Success on getting the buffer
-\retval FALSE   Invalid parameter passed to function
+\retval FALSE   Invalid parameter or all buffers are in use
 */
 /*----------------------------------------------------------------------------*/
 BOOL log_getCurrentLogBuffer(tLogInstance pInstance_p, tLogFormat ** ppLogData_p)
 {
     BOOL fReturn = FALSE;
+    tLogRing* pRing;
+    tLogRingSlot* pSlot;
+    UINT32 pos;
+    INT32 diff;
 
     if(pInstance_p != NULL && ppLogData_p != NULL)
     {
-        if(pInstance_p->logTxBuffer_m.isLocked_m == FALSE)
+        pRing = &pInstance_p->entryRing_m;
+
+        for(;;)
         {
-            *ppLogData_p = &pInstance_p->logTxBuffer_m.pLogTxPayl_m->logData_m;
-            fReturn = TRUE;
+            pos = pRing->reservePos_m;
+            pSlot = &pRing->slot_m[pos & (LOG_RING_SIZE - 1)];
+            diff = (INT32)(pSlot->seq_m - pos);
+
+            if(diff == 0)
+            {
+                /* Slot is free -> Try to claim it against other producers */
+                if(PSI_ATOMIC_CAS(&pRing->reservePos_m, pos, pos + 1))
+                {
+                    *ppLogData_p = &pSlot->logData_m;
+                    fReturn = TRUE;
+                    break;
+                }
+            }
+            else if(diff < 0)
+            {
+                /* Slot still holds an entry of the last round -> Ring is full */
+                break;
+            }
+            /* no else: Another producer was faster -> Retry with the next position */
         }
     }
 
@@ -229,44 +267,54 @@ BOOL log_getCurrentLogBuffer(tLogInstance pInstance_p, tLogFormat ** ppLogData_p
 /**
 \brief    Post a frame for transmission over the logbook channel
 
+Commits the buffer reserved by log_getCurrentLogBuffer(). The entry is sent by
+log_process() as soon as all older entries are committed and the channel is
+free. An entry with level kLogLevelInvalid only releases the buffer.
+
 \param[in]  pInstance_p     Logbook module instance
 \param[in]  pLogData_p      Pointer to the logger data to send
 
 \retval kLogTxStatusSuccessful      Successfully posted payload to buffer
-\retval tLogTxStatusBusy            Unable to post payload to the logbook channel
 \retval kLogTxStatusError           Error while posting payload to the logbook channel
 */
 /*----------------------------------------------------------------------------*/
 tLogTxStatus log_postLogEntry(tLogInstance pInstance_p, tLogFormat* pLogData_p)
 {
     tLogTxStatus chanState = kLogTxStatusError;
+    tLogRingSlot* pSlot = NULL;
+    tLogRing* pRing;
+    UINT8* pFirstData;
+    UINT32 offset;
 
-    if(pInstance_p == NULL  ||
-       pLogData_p == NULL    )
+    if(pInstance_p != NULL && pLogData_p != NULL)
+    {
+        pRing = &pInstance_p->entryRing_m;
+        pFirstData = (UINT8*)&pRing->slot_m[0].logData_m;
+
+        /* Derive the slot from the offset of the buffer in the ring */
+        if((UINT8*)pLogData_p >= pFirstData                                         &&
+           (UINT8*)pLogData_p <= (UINT8*)&pRing->slot_m[LOG_RING_SIZE - 1].logData_m  )
+        {
+            offset = (UINT32)((UINT8*)pLogData_p - pFirstData);
+            if((offset % sizeof(tLogRingSlot)) == 0)
+            {
+                pSlot = &pRing->slot_m[offset / sizeof(tLogRingSlot)];
+            }
+        }
+    }
+
+    if(pSlot == NULL)
     {
         error_setError(kPsiModuleLogbook, kPsiLogSendError);
     }
     else
     {
-        /* Check if buffer is free for filling */
-        if(pInstance_p->logTxBuffer_m.isLocked_m == FALSE)
-        {
-            /* Set sequence number in next tx buffer */
-            ami_setUint8Le((UINT8*)&pInstance_p->logTxBuffer_m.pLogTxPayl_m->seqNr_m,
-                    pInstance_p->currTxSeqNr_m);
-
-            /* Lock buffer for transmission */
-            pInstance_p->logTxBuffer_m.isLocked_m = TRUE;
+        /* Entry is written completely before it is visible to the drain */
+        PSI_MEMORY_BARRIER();
 
-            /* Enable transmit timer */
-            timeout_startTimer(pInstance_p->pTimeoutInst_m);
+        pSlot->seq_m = pSlot->seq_m + 1;
 
-            chanState = kLogTxStatusSuccessful;
-        }
-        else
-        {
-            chanState = kLogTxStatusBusy;
-        }
+        chanState = kLogTxStatusSuccessful;
     }
 
     return chanState;
@@ -319,25 +367,25 @@ static BOOL log_initTransmitBuffer(tLogChanNum chanId_p,
     {
         if(pDescLogTrans->buffSize_m == sizeof(tTbufLogStructure))
         {
-            if(stream_registerAction(kStreamActionPost, txBuffId_p, log_incrTimeout,
-                                     (void *)&logInstance_l[chanId_p]) != FALSE)
+            /* Remember buffer address for later usage */
+            logInstance_l[chanId_p].logTxBuffer_m.pLogTxPayl_m =
+                    (tTbufLogStructure *)pDescLogTrans->pBuffBase_m;
+
+            /* Initialize logbook transmit timeout instance */
+            logInstance_l[chanId_p].pTimeoutInst_m = timeout_create(
+                                    LOG_TX_TIMEOUT_CYCLE_COUNT);
+            if(logInstance_l[chanId_p].pTimeoutInst_m != NULL)
             {
-                /* Remember buffer address for later usage */
-                logInstance_l[chanId_p].logTxBuffer_m.pLogTxPayl_m =
-                        (tTbufLogStructure *)pDescLogTrans->pBuffBase_m;
-
-                /* Initialize logbook transmit timeout instance */
-                logInstance_l[chanId_p].pTimeoutInst_m = timeout_create(
-                                        LOG_TX_TIMEOUT_CYCLE_COUNT);
-                if(logInstance_l[chanId_p].pTimeoutInst_m != NULL)
-                {
-                    fReturn = TRUE;
-                }
-                else
-                {
-                    error_setError(kPsiModuleLogbook, kPsiLogInitError);
-                }
-            }   /* no else: Error already reported in register action function */
+                /* Let the round trip time lower the timeout down to the floor */
+                timeout_setMinCycleLimit(logInstance_l[chanId_p].pTimeoutInst_m,
+                        LOG_TX_MIN_TIMEOUT_CYCLE_COUNT);
+
+                fReturn = TRUE;
+            }
+            else
+            {
+                error_setError(kPsiModuleLogbook, kPsiLogInitError);
+            }
         }
         else
         {
@@ -376,7 +424,8 @@ static void log_handleTxFrame(tLogInstance pInstance_p)
             /* Increment local sequence number */
             log_changeLocalSeqNr(&pInstance_p->currTxSeqNr_m);
 
-            /* Message was acknowledged -> Stop timer if running! */
+            /* Message was acknowledged -> Adapt timeout and stop timer if running! */
+            timeout_updateRtt(pInstance_p->pTimeoutInst_m);
             timeout_stopTimer(pInstance_p->pTimeoutInst_m);
         }
         else
@@ -393,34 +442,12 @@ static void log_handleTxFrame(tLogInstance pInstance_p)
             }
         }
     }
-}
 
-/*----------------------------------------------------------------------------*/
-/**
-\brief    Increment logbook transmit timeout
-
-\param[in] pBuffer_p        Pointer to the base address of the buffer
-\param[in] bufSize_p        Size of the buffer
-\param[in] pUserArg_p       The user argument
-
-\return Always returns success
-*/
-/*----------------------------------------------------------------------------*/
-static BOOL log_incrTimeout(UINT8* pBuffer_p, UINT16 bufSize_p,
-                            void* pUserArg_p)
-{
-    tLogInstance pInstance;
-
-    UNUSED_PARAMETER(bufSize_p);
-    UNUSED_PARAMETER(pBuffer_p);
-
-    /* Get pointer to current instance */
-    pInstance = (tLogInstance) pUserArg_p;
-
-    /* Increment transmit timer cycle count */
-    timeout_incrementCounter(pInstance->pTimeoutInst_m);
-
-    return TRUE;
+    if(pInstance_p->logTxBuffer_m.isLocked_m == FALSE)
+    {
+        /* Channel is free -> Send entries posted in the meantime */
+        log_drainRing(pInstance_p);
+    }
 }
 
 /*----------------------------------------------------------------------------*/
@@ -474,6 +501,215 @@ static tLogChanStatus log_checkChannelStatus(tLogInstance pInstance_p)
     return chanStatus;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Add an entry to the staging buffer
+
+In batch mode entries with a source, code and additional info which fit into
+the compact format are appended to the pending batch. All other entries are
+sent alone.
+
+\param[in]  pInstance_p     Logbook module instance
+\param[in]  pLogData_p      Pointer to the entry to add
+
+\retval kLogTxStatusSuccessful      Entry is staged for transmission
+\retval kLogTxStatusBusy            Staging buffer can't take the entry
+*/
+/*----------------------------------------------------------------------------*/
+static tLogTxStatus log_stageEntry(tLogInstance pInstance_p, tLogFormat* pLogData_p)
+{
+    tLogTxStatus chanState = kLogTxStatusBusy;
+    tLogCompactFormat* pCompact;
+    UINT8  level;
+    UINT16 source;
+    UINT32 code;
+    UINT32 addInfo;
+    BOOL   fCompact;
+
+    level = ami_getUint8Le((UINT8 *)&pLogData_p->level_m);
+    source = ami_getUint16Le((UINT8 *)&pLogData_p->source_m);
+    code = ami_getUint32Le((UINT8 *)&pLogData_p->code_m);
+    addInfo = ami_getUint32Le((UINT8 *)&pLogData_p->addInfo_m);
+
+    fCompact = (pInstance_p->fBatchMode_m != FALSE  &&
+                level <= kLogLevelFatal             &&
+                source <= LOG_COMPACT_SOURCE_MASK &&
+                code <= LOG_COMPACT_VALUE_MAX      &&
+                addInfo <= LOG_COMPACT_VALUE_MAX     ) ? TRUE : FALSE;
+
+    if(pInstance_p->stageCount_m == 0 && fCompact == FALSE)
+    {
+        /* Entry is sent alone in the original format */
+        PSI_MEMCPY(&pInstance_p->stageEntry_m, pLogData_p, sizeof(tLogFormat));
+        pInstance_p->fStageBatch_m = FALSE;
+        pInstance_p->stageCount_m = 1;
+
+        chanState = kLogTxStatusSuccessful;
+    }
+    else if(fCompact != FALSE                                    &&
+            (pInstance_p->stageCount_m == 0 ||
+             pInstance_p->fStageBatch_m != FALSE)                &&
+            pInstance_p->stageCount_m < LOG_BATCH_MAX_ENTRIES      )
+    {
+        /* Append entry to the pending batch */
+        pCompact = &pInstance_p->stageBatch_m.entry_m[pInstance_p->stageCount_m];
+
+        ami_setUint8Le((UINT8 *)&pCompact->levelSource_m,
+                (UINT8)((level << LOG_COMPACT_LEVEL_SHIFT) | source));
+        ami_setUint16Le((UINT8 *)&pCompact->code_m, (UINT16)code);
+        ami_setUint16Le((UINT8 *)&pCompact->addInfo_m, (UINT16)addInfo);
+
+        pInstance_p->fStageBatch_m = TRUE;
+        pInstance_p->stageCount_m++;
+
+        chanState = kLogTxStatusSuccessful;
+    }
+
+    return chanState;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Send the staged entries over the free logbook channel
+
+\param[in]  pInstance_p     Logbook module instance
+*/
+/*----------------------------------------------------------------------------*/
+static void log_sendStagedEntries(tLogInstance pInstance_p)
+{
+    tLogFormat* pLogData = &pInstance_p->logTxBuffer_m.pLogTxPayl_m->logData_m;
+
+    if(pInstance_p->stageCount_m > 0)
+    {
+        if(pInstance_p->fStageBatch_m != FALSE)
+        {
+            ami_setUint8Le((UINT8 *)&pInstance_p->stageBatch_m.header_m,
+                    (UINT8)(LOG_BATCH_FLAG | pInstance_p->stageCount_m));
+
+            PSI_MEMCPY(pLogData, &pInstance_p->stageBatch_m, sizeof(tLogBatchFormat));
+        }
+        else
+        {
+            PSI_MEMCPY(pLogData, &pInstance_p->stageEntry_m, sizeof(tLogFormat));
+        }
+
+        pInstance_p->stageCount_m = 0;
+
+        /* Set sequence number in next tx buffer */
+        ami_setUint8Le((UINT8*)&pInstance_p->logTxBuffer_m.pLogTxPayl_m->seqNr_m,
+                pInstance_p->currTxSeqNr_m);
+
+        /* Lock buffer for transmission */
+        pInstance_p->logTxBuffer_m.isLocked_m = TRUE;
+
+        /* Enable transmit timer */
+        timeout_startTimer(pInstance_p->pTimeoutInst_m);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Mark all slots of the entry ring as free
+
+\param[in]  pRing_p     The entry ring
+*/
+/*----------------------------------------------------------------------------*/
+static void log_initRing(tLogRing* pRing_p)
+{
+    UINT32 i;
+
+    for(i=0; i < LOG_RING_SIZE; i++)
+    {
+        pRing_p->slot_m[i].seq_m = i;
+    }
+
+    pRing_p->reservePos_m = 0;
+    pRing_p->drainPos_m = 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get the oldest committed entry of the ring
+
+\param[in]  pRing_p     The entry ring
+
+\return Pointer to the entry or NULL if the oldest entry is not committed yet
+*/
+/*----------------------------------------------------------------------------*/
+static tLogFormat* log_peekRing(tLogRing* pRing_p)
+{
+    tLogFormat* pLogData = NULL;
+    tLogRingSlot* pSlot;
+
+    pSlot = &pRing_p->slot_m[pRing_p->drainPos_m & (LOG_RING_SIZE - 1)];
+
+    if(pSlot->seq_m == pRing_p->drainPos_m + 1)
+    {
+        /* Read the entry only after the commit is visible */
+        PSI_MEMORY_BARRIER();
+
+        pLogData = &pSlot->logData_m;
+    }
+
+    return pLogData;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Release the oldest entry of the ring for the next round
+
+\param[in]  pRing_p     The entry ring
+*/
+/*----------------------------------------------------------------------------*/
+static void log_popRing(tLogRing* pRing_p)
+{
+    tLogRingSlot* pSlot;
+
+    pSlot = &pRing_p->slot_m[pRing_p->drainPos_m & (LOG_RING_SIZE - 1)];
+
+    /* Entry is consumed before the slot can be reserved again */
+    PSI_MEMORY_BARRIER();
+
+    pSlot->seq_m = pRing_p->drainPos_m + LOG_RING_SIZE;
+    pRing_p->drainPos_m++;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Move committed entries from the ring to the free logbook channel
+
+As many entries as fit into one transfer are taken from the ring.
+
+\param[in]  pInstance_p     Logbook module instance
+*/
+/*----------------------------------------------------------------------------*/
+static void log_drainRing(tLogInstance pInstance_p)
+{
+    tLogFormat* pLogData;
+
+    for(;;)
+    {
+        pLogData = log_peekRing(&pInstance_p->entryRing_m);
+        if(pLogData == NULL)
+        {
+            break;
+        }
+
+        if(ami_getUint8Le((UINT8 *)&pLogData->level_m) != kLogLevelInvalid)
+        {
+            if(log_stageEntry(pInstance_p, pLogData) != kLogTxStatusSuccessful)
+            {
+                /* Transfer is full -> Entry is sent with the next one */
+                break;
+            }
+        }   /* no else: Released entry is dropped */
+
+        log_popRing(&pInstance_p->entryRing_m);
+    }
+
+    log_sendStagedEntries(pInstance_p);
+}
+
 /**
  * \}
  */
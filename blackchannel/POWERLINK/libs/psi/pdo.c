@@ -86,31 +86,38 @@ application and back.
 /*----------------------------------------------------------------------------*/
 
 /**
-* \brief PDO user instance type
+\brief PDO channel user instance
+
+The PDO instance holds the buffers and the user callback of each PDO channel.
 */
-typedef struct
+struct ePdoInstance
 {
+    tPdoChanNum     chanId_m;           /**< Id of the PDO channel */
     UINT8           rpdoId_m;           /**< Id of the rpdo buffer */
     tTbufRpdoImage* pRpdoLayout_m;      /**< Pointer to the rpdo triple buffer */
     UINT32          rpdoRelTimeLow_m;   /**< Low value of the relative time */
     UINT8           tpdoId_m;           /**< Id of the tpdo buffer */
     tTbufTpdoImage* pTpdoLayout_m;      /**< Pointer to the tpdo triple buffer */
     tPsiPdoCb       pfnPdoCb_m;         /**< Process PDO user callback function */
-} tPdoInstance;
+    BOOL            fRpdoChangeOnly_m;  /**< Call the user callback only on changed rpdo objects */
+    BOOL            fRpdoChanged_m;     /**< Rpdo objects changed since the last callback */
+    tRpdoMappedObj  rpdoShadow_m;       /**< Rpdo objects of the last callback */
+};
 
 /*----------------------------------------------------------------------------*/
 /* local vars                                                                 */
 /*----------------------------------------------------------------------------*/
 
-static tPdoInstance          pdoInstance_l;
+static struct ePdoInstance          pdoInstance_l[kNumPdoInstCount];
 
 /*----------------------------------------------------------------------------*/
 /* local function prototypes                                                  */
 /*----------------------------------------------------------------------------*/
 
 static BOOL pdo_process(void);
-static BOOL pdo_initRpdoBuffer(tTbufNumLayout rpdoId_p);
-static BOOL pdo_initTpdoBuffer(tTbufNumLayout tpdoId_p);
+static BOOL pdo_processChannel(tPdoInstance pInstance_p);
+static BOOL pdo_initRpdoBuffer(tPdoInstance pInstance_p, tTbufNumLayout rpdoId_p);
+static BOOL pdo_initTpdoBuffer(tPdoInstance pInstance_p, tTbufNumLayout tpdoId_p);
 static BOOL pdo_processRpdo(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_p);
 
 /*============================================================================*/
@@ -119,23 +126,45 @@ static BOOL pdo_processRpdo(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_
 
 /*----------------------------------------------------------------------------*/
 /**
-\brief    Initialize the PDO module
+\brief    Initialize the PDO channel module
+*/
+/*----------------------------------------------------------------------------*/
+void pdo_init(void)
+{
+    PSI_MEMSET(&pdoInstance_l, 0 , sizeof(struct ePdoInstance) * kNumPdoInstCount);
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Create a PDO channel instance
+
+Instantiate a new PDO channel which forwards its RPDO and TPDO image to the
+user callback of the channel. Each channel is processed independently in
+the order of the channel id. All channels use the same image layout
+(tTbufRpdoImage and tTbufTpdoImage), therefore the buffers of each channel
+need to have the size of these images.
+
+If fRpdoChangeOnly_m is set the callback is skipped in all cycles where
+the mapped RPDO objects are equal to the last cycle. The relative time is
+not compared as it changes in each cycle.
 
+\param[in]  chanId_p            Id of the PDO channel
 \param[in]  pfnPdoCb_p          PDO process user callback function
 \param[in]  pPdoInitParam_p     Initialization structure of the PDO buffers
 
-\retval  TRUE       Successfully initialized the PDO module
-\retval  FALSE      Error while initializing the PDO module
+\retval Address              Pointer to the instance of the channel
+\retval Null                 Unable to allocate instance
 */
 /*----------------------------------------------------------------------------*/
-BOOL pdo_init(tPsiPdoCb pfnPdoCb_p, tPdoInitParam* pPdoInitParam_p)
+tPdoInstance pdo_create(tPdoChanNum chanId_p, tPsiPdoCb pfnPdoCb_p,
+                        tPdoInitParam* pPdoInitParam_p)
 {
-    BOOL fReturn = FALSE, fError = FALSE;
+    tPdoInstance pInstance = NULL;
+    BOOL fError = FALSE;
 
-    PSI_MEMSET(&pdoInstance_l, 0 , sizeof(tPdoInstance));
-
-    if(pfnPdoCb_p == NULL      ||
-       pPdoInitParam_p == NULL  )
+    if(chanId_p >= kNumPdoInstCount ||
+       pfnPdoCb_p == NULL           ||
+       pPdoInitParam_p == NULL       )
     {
         /* Wrong parameters passed to module */
         error_setError(kPsiModulePdo, kPsiPdoInitError);
@@ -151,35 +180,39 @@ BOOL pdo_init(tPsiPdoCb pfnPdoCb_p, tPdoInitParam* pPdoInitParam_p)
         }
         else
         {
+            PSI_MEMSET(&pdoInstance_l[chanId_p], 0, sizeof(struct ePdoInstance));
+
             if(pPdoInitParam_p->buffIdRpdo_m < kTbufCount)
             {
                 /* Initialize the Rpdo buffer */
-                if(pdo_initRpdoBuffer(pPdoInitParam_p->buffIdRpdo_m) == FALSE)
+                if(pdo_initRpdoBuffer(&pdoInstance_l[chanId_p],
+                        pPdoInitParam_p->buffIdRpdo_m) == FALSE)
                 {
                     fError = TRUE;
                 }
 
-                pdoInstance_l.rpdoId_m = pPdoInitParam_p->buffIdRpdo_m;
+                pdoInstance_l[chanId_p].rpdoId_m = pPdoInitParam_p->buffIdRpdo_m;
             }
             else
             {
-                pdoInstance_l.rpdoId_m = PDO_CHANNEL_DEACTIVATED;
+                pdoInstance_l[chanId_p].rpdoId_m = PDO_CHANNEL_DEACTIVATED;
             }
 
             if(pPdoInitParam_p->buffIdTpdo_m < kTbufCount &&
                !fError                                     )
             {
                 /* Initialize the Tpdo buffer */
-                if(pdo_initTpdoBuffer(pPdoInitParam_p->buffIdTpdo_m) == FALSE)
+                if(pdo_initTpdoBuffer(&pdoInstance_l[chanId_p],
+                        pPdoInitParam_p->buffIdTpdo_m) == FALSE)
                 {
                     fError = TRUE;
                 }
 
-                pdoInstance_l.tpdoId_m = pPdoInitParam_p->buffIdTpdo_m;
+                pdoInstance_l[chanId_p].tpdoId_m = pPdoInitParam_p->buffIdTpdo_m;
             }
             else
             {
-                pdoInstance_l.tpdoId_m = PDO_CHANNEL_DEACTIVATED;
+                pdoInstance_l[chanId_p].tpdoId_m = PDO_CHANNEL_DEACTIVATED;
             }
 
             if(fError == FALSE)
@@ -187,50 +220,95 @@ BOOL pdo_init(tPsiPdoCb pfnPdoCb_p, tPdoInitParam* pPdoInitParam_p)
                 /* Register PDO process function */
                 stream_registerSyncCb(pdo_process);
 
+                /* Save channel Id */
+                pdoInstance_l[chanId_p].chanId_m = chanId_p;
+
                 /* Remember process PDO user callback */
-                pdoInstance_l.pfnPdoCb_m = pfnPdoCb_p;
+                pdoInstance_l[chanId_p].pfnPdoCb_m = pfnPdoCb_p;
 
-                fReturn = TRUE;
+                /* The first cycle always calls the user callback */
+                pdoInstance_l[chanId_p].fRpdoChangeOnly_m = pPdoInitParam_p->fRpdoChangeOnly_m;
+                pdoInstance_l[chanId_p].fRpdoChanged_m = TRUE;
+
+                /* Set valid instance id */
+                pInstance = &pdoInstance_l[chanId_p];
+            }
+            else
+            {
+                /* Remove the already registered Rpdo action */
+                pdo_destroy(&pdoInstance_l[chanId_p]);
             }
         }
     }
 
-
-    return fReturn;
+    return pInstance;
 }
 
 /*----------------------------------------------------------------------------*/
 /**
-\brief    Cleanup pdo module
+\brief    Destroy a PDO channel
+
+The user callback of the channel is not called anymore and the RPDO action
+of the channel is removed from the stream module.
+
+\param[in]  pInstance_p       The instance to destroy
 */
 /*----------------------------------------------------------------------------*/
-void pdo_exit(void)
+void pdo_destroy(tPdoInstance pInstance_p)
 {
-    /* Free module internals */
+    if(pInstance_p != NULL)
+    {
+        if(pInstance_p->rpdoId_m != PDO_CHANNEL_DEACTIVATED &&
+           pInstance_p->pRpdoLayout_m != NULL                 )
+        {
+            stream_unregisterAction(kStreamActionPost, pInstance_p->rpdoId_m,
+                    pdo_processRpdo, (void *)pInstance_p);
+        }
+
+        PSI_MEMSET(pInstance_p, 0, sizeof(struct ePdoInstance));
+    }
 }
 
 /*----------------------------------------------------------------------------*/
 /**
 \brief    Get the base address of the Tpdo image
 
+\param[in]  pInstance_p       Pointer to the PDO channel instance
+
 \return Base address of the Tpdo image
 */
 /*----------------------------------------------------------------------------*/
-tTpdoMappedObj * pdo_getTpdoImage(void)
+tTpdoMappedObj * pdo_getTpdoImage(tPdoInstance pInstance_p)
 {
-    return &pdoInstance_l.pTpdoLayout_m->mappedObjList_m;
+    tTpdoMappedObj* pImage = NULL;
+
+    if(pInstance_p != NULL && pInstance_p->pTpdoLayout_m != NULL)
+    {
+        pImage = &pInstance_p->pTpdoLayout_m->mappedObjList_m;
+    }
+
+    return pImage;
 }
 
 /*----------------------------------------------------------------------------*/
 /**
 \brief    Get the base address of the Rpdo image
 
+\param[in]  pInstance_p       Pointer to the PDO channel instance
+
 \return Base address of the Rpdo image
 */
 /*----------------------------------------------------------------------------*/
-tRpdoMappedObj * pdo_getRpdoImage(void)
+tRpdoMappedObj * pdo_getRpdoImage(tPdoInstance pInstance_p)
 {
-    return &pdoInstance_l.pRpdoLayout_m->mappedObjList_m;
+    tRpdoMappedObj* pImage = NULL;
+
+    if(pInstance_p != NULL && pInstance_p->pRpdoLayout_m != NULL)
+    {
+        pImage = &pInstance_p->pRpdoLayout_m->mappedObjList_m;
+    }
+
+    return pImage;
 }
 
 /*============================================================================*/
@@ -243,13 +321,14 @@ tRpdoMappedObj * pdo_getRpdoImage(void)
 /**
 \brief    Initialize the RPDO buffer image
 
+\param[in] pInstance_p            Pointer to the PDO channel instance
 \param[in] rpdoId_p               Id of the RPDO buffer
 
 \retval TRUE        Successfully initializing the rpdo buffer
 \retval FALSE       Error while initializing the rpdo buffer
 */
 /*----------------------------------------------------------------------------*/
-static BOOL pdo_initRpdoBuffer(tTbufNumLayout rpdoId_p)
+static BOOL pdo_initRpdoBuffer(tPdoInstance pInstance_p, tTbufNumLayout rpdoId_p)
 {
     BOOL fReturn = FALSE;
     tBuffDescriptor* pDescRpdo;
@@ -260,11 +339,12 @@ static BOOL pdo_initRpdoBuffer(tTbufNumLayout rpdoId_p)
         if(pDescRpdo->buffSize_m == sizeof(tTbufRpdoImage))
         {
             /* Remember buffer address for later usage */
-            pdoInstance_l.pRpdoLayout_m = (tTbufRpdoImage *)pDescRpdo->pBuffBase_m;
+            pInstance_p->pRpdoLayout_m = (tTbufRpdoImage *)pDescRpdo->pBuffBase_m;
 
             /* Register rpdo acknowledge action */
             if(stream_registerAction(kStreamActionPost, rpdoId_p,
-                    pdo_processRpdo, NULL) != FALSE)
+                    pdo_processRpdo, (void *)pInstance_p, kStreamActionPrioPdo,
+                    kStreamActionCondAlways) != FALSE)
             {
                 fReturn = TRUE;
             }
@@ -286,13 +366,14 @@ static BOOL pdo_initRpdoBuffer(tTbufNumLayout rpdoId_p)
 /**
 \brief    Initialize the TPDO buffer image
 
+\param[in] pInstance_p            Pointer to the PDO channel instance
 \param[in] tpdoId_p               Id of the TPDO buffer
 
 \retval TRUE        Successfully initializing the tpdo buffer
 \retval FALSE       Error while initializing the tpdo buffer
 */
 /*----------------------------------------------------------------------------*/
-static BOOL pdo_initTpdoBuffer(tTbufNumLayout tpdoId_p)
+static BOOL pdo_initTpdoBuffer(tPdoInstance pInstance_p, tTbufNumLayout tpdoId_p)
 {
     BOOL fReturn = FALSE;
     tBuffDescriptor* pDescTpdo;
@@ -303,7 +384,7 @@ static BOOL pdo_initTpdoBuffer(tTbufNumLayout tpdoId_p)
         if(pDescTpdo->buffSize_m == sizeof(tTbufTpdoImage))
         {
             /* Remember buffer address for later usage */
-            pdoInstance_l.pTpdoLayout_m = (tTbufTpdoImage *)pDescTpdo->pBuffBase_m;
+            pInstance_p->pTpdoLayout_m = (tTbufTpdoImage *)pDescTpdo->pBuffBase_m;
 
             fReturn = TRUE;
         }
@@ -322,7 +403,7 @@ static BOOL pdo_initTpdoBuffer(tTbufNumLayout tpdoId_p)
 
 /*----------------------------------------------------------------------------*/
 /**
-\brief    Process the PDO user callback function
+\brief    Process the user callback functions of all PDO channels
 
 \retval TRUE        Successfully processed synchronous task
 \retval FALSE       Error while processing the synchronous task
@@ -330,43 +411,65 @@ static BOOL pdo_initTpdoBuffer(tTbufNumLayout tpdoId_p)
 /*----------------------------------------------------------------------------*/
 static BOOL pdo_process(void)
 {
-    BOOL fReturn = FALSE;
+    BOOL fReturn = TRUE;
+    UINT8 i;
 
-    /* Call the PDO user callback function */
-    if(pdoInstance_l.rpdoId_m == PDO_CHANNEL_DEACTIVATED)
+    for(i = 0; i < kNumPdoInstCount; i++)
     {
-        /* The Rpdo buffer is not initialized */
-        if(pdoInstance_l.pfnPdoCb_m(pdoInstance_l.rpdoRelTimeLow_m,
-                    NULL,
-                    &pdoInstance_l.pTpdoLayout_m->mappedObjList_m) != FALSE)
-        {
-            fReturn = TRUE;
-        }
-        else
+        /* Skip channels which are not created */
+        if(pdoInstance_l[i].pfnPdoCb_m != NULL)
         {
-            error_setError(kPsiModulePdo, kPsiPdoProcessSyncFailed);
+            if(pdo_processChannel(&pdoInstance_l[i]) == FALSE)
+            {
+                fReturn = FALSE;
+                break;
+            }
         }
     }
-    else if(pdoInstance_l.tpdoId_m == PDO_CHANNEL_DEACTIVATED)
+
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Process the PDO user callback function of one channel
+
+\param[in] pInstance_p            Pointer to the PDO channel instance
+
+\retval TRUE        Successfully processed the channel
+\retval FALSE       Error while processing the channel
+*/
+/*----------------------------------------------------------------------------*/
+static BOOL pdo_processChannel(tPdoInstance pInstance_p)
+{
+    BOOL fReturn = FALSE;
+    tRpdoMappedObj* pRpdoImage = NULL;
+    tTpdoMappedObj* pTpdoImage = NULL;
+
+    /* Only pass the images of the initialized buffers */
+    if(pInstance_p->rpdoId_m != PDO_CHANNEL_DEACTIVATED)
     {
-        /* The Tpdo buffer is not initialized */
-        if(pdoInstance_l.pfnPdoCb_m(pdoInstance_l.rpdoRelTimeLow_m,
-                    &pdoInstance_l.pRpdoLayout_m->mappedObjList_m,
-                    NULL) != FALSE)
-        {
-            fReturn = TRUE;
-        }
-        else
-        {
-            error_setError(kPsiModulePdo, kPsiPdoProcessSyncFailed);
-        }
+        pRpdoImage = &pInstance_p->pRpdoLayout_m->mappedObjList_m;
+    }
+
+    if(pInstance_p->tpdoId_m != PDO_CHANNEL_DEACTIVATED)
+    {
+        pTpdoImage = &pInstance_p->pTpdoLayout_m->mappedObjList_m;
+    }
+
+    if(pInstance_p->fRpdoChangeOnly_m != FALSE &&
+       pRpdoImage != NULL                      &&
+       pInstance_p->fRpdoChanged_m == FALSE     )
+    {
+        /* No new rpdo data -> Skip the user callback */
+        fReturn = TRUE;
     }
     else
     {
-        /* Both PDO buffers are initialized */
-        if(pdoInstance_l.pfnPdoCb_m(pdoInstance_l.rpdoRelTimeLow_m,
-                    &pdoInstance_l.pRpdoLayout_m->mappedObjList_m,
-                    &pdoInstance_l.pTpdoLayout_m->mappedObjList_m) != FALSE)
+        pInstance_p->fRpdoChanged_m = FALSE;
+
+        if(pInstance_p->pfnPdoCb_m(pInstance_p->rpdoRelTimeLow_m,
+                    pRpdoImage, pTpdoImage) != FALSE)
         {
             fReturn = TRUE;
         }
@@ -385,7 +488,7 @@ static BOOL pdo_process(void)
 
 \param[in] pBuffer_p        Pointer to the base address of the buffer
 \param[in] bufSize_p        Size of the buffer
-\param[in] pUserArg_p       User defined argument
+\param[in] pUserArg_p       Pointer to the PDO channel instance
 
 \retval TRUE     Processing of RPDO buffer successful
 \retval FALSE    On error
@@ -394,15 +497,29 @@ static BOOL pdo_process(void)
 static BOOL pdo_processRpdo(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_p)
 {
     tTbufRpdoImage*  pRpdoImage;
+    tPdoInstance     pInstance;
 
     UNUSED_PARAMETER(bufSize_p);
-    UNUSED_PARAMETER(pUserArg_p);
 
     /* Convert to configuration channel buffer structure */
     pRpdoImage = (tTbufRpdoImage*) pBuffer_p;
+    pInstance = (tPdoInstance) pUserArg_p;
 
-    /* Write relative time to local structure */
-    pdoInstance_l.rpdoRelTimeLow_m = ami_getUint32Le((UINT8 *)&pRpdoImage->relativeTimeLow_m);
+    /* Write relative time to the channel instance */
+    pInstance->rpdoRelTimeLow_m = ami_getUint32Le((UINT8 *)&pRpdoImage->relativeTimeLow_m);
+
+    if(pInstance->fRpdoChangeOnly_m != FALSE)
+    {
+        /* Compare the rpdo objects with the last cycle */
+        if(PSI_MEMCMP(&pInstance->rpdoShadow_m, &pRpdoImage->mappedObjList_m,
+                sizeof(tRpdoMappedObj)) != 0)
+        {
+            PSI_MEMCPY(&pInstance->rpdoShadow_m, &pRpdoImage->mappedObjList_m,
+                    sizeof(tRpdoMappedObj));
+
+            pInstance->fRpdoChanged_m = TRUE;
+        }
+    }
 
     return TRUE;
 }
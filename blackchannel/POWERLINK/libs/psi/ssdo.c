@@ -114,6 +114,10 @@ static BOOL ssdo_initTransmitBuffer(tSsdoChanNum chanId_p,
 static BOOL ssdo_handleRxFrame(tSsdoInstance pInstance_p);
 static void ssdo_freeRxChannel(tSsdoInstance pInstance_p);
 static void ssdo_handleTxFrame(tSsdoInstance pInstance_p);
+static void ssdo_sendNextFrame(tSsdoInstance pInstance_p);
+static BOOL ssdo_isQueueFull(tSsdoTxChannel* pTxChan_p);
+static void ssdo_queueFrame(tSsdoInstance pInstance_p, UINT8* pPayload_p,
+        UINT16 paylSize_p);
 static BOOL ssdo_receiveFrame(UINT8* pBuffer_p, UINT16 bufSize_p,
         void* pUserArg_p);
 static void ssdo_changeLocalSeqNr(tSeqNrValue* pSeqNr_p);
@@ -214,7 +218,7 @@ void ssdo_destroy(tSsdoInstance pInstance_p)
 
 /*----------------------------------------------------------------------------*/
 /**
-\brief    Returns the address of the current active transmit buffers
+\brief    Returns the address of the next free transmit queue slot
 
 \param[in]  pInstance_p     SSDO module instance
 \param[out] ppPayload_p     Pointer to the result address of the payload
@@ -228,12 +232,17 @@ BOOL ssdo_getCurrentTxBuffer(tSsdoInstance pInstance_p, UINT8 ** ppPayload_p, UI
 {
     BOOL fReturn = FALSE;
 
+    tSsdoTxChannel* pTxChan;
+
     if(pInstance_p != NULL && ppPayload_p != NULL && pPaylLen_p != NULL)
     {
-        if(pInstance_p->txBuffParam_m.ssdoTxBuffer_m.isLocked_m == FALSE)
+        pTxChan = &pInstance_p->txBuffParam_m;
+
+        if(ssdo_isQueueFull(pTxChan) == FALSE)
         {
-            *ppPayload_p = pInstance_p->txBuffParam_m.ssdoTxBuffer_m.pSsdoTxPayl_m->tssdoTransmitData_m;
+            *ppPayload_p = pTxChan->txQueue_m[pTxChan->queueTail_m & (SSDO_TX_QUEUE_SIZE - 1)].payload_m;
             *pPaylLen_p = TSSDO_TRANSMIT_DATA_SIZE;
+
             fReturn = TRUE;
         }
     }
@@ -245,6 +254,13 @@ BOOL ssdo_getCurrentTxBuffer(tSsdoInstance pInstance_p, UINT8 ** ppPayload_p, UI
 /**
 \brief    Post a frame for transmission over the SSDO channel
 
+The frame is added to the transmit queue. Up to SSDO_TX_QUEUE_SIZE frames
+can be queued before the channel reports busy. Only the oldest frame is
+posted to the transmit buffer. The PCP acknowledges it after the frame is
+forwarded to the target node, so the queue doesn't raise the throughput. It
+only decouples the application from the handshake. The payload can be
+prepared in place with ssdo_getCurrentTxBuffer() to avoid the copy.
+
 \param[in]  pInstance_p     SSDO module instance
 \param[in]  pPayload_p      Pointer to the payload to send
 \param[in]  paylSize_p      Size of the payload to send
@@ -258,6 +274,7 @@ tSsdoTxStatus ssdo_postPayload(tSsdoInstance pInstance_p, UINT8* pPayload_p,
         UINT16 paylSize_p)
 {
     tSsdoTxStatus chanState = kSsdoTxStatusError;
+    tSsdoTxChannel* pTxChan;
 
     if(pInstance_p == NULL  ||
        pPayload_p == NULL    )
@@ -266,29 +283,20 @@ tSsdoTxStatus ssdo_postPayload(tSsdoInstance pInstance_p, UINT8* pPayload_p,
     }
     else
     {
+        pTxChan = &pInstance_p->txBuffParam_m;
+
         /* Check if payload fits inside the buffer */
-        if(paylSize_p > sizeof(pInstance_p->txBuffParam_m.ssdoTxBuffer_m.pSsdoTxPayl_m->tssdoTransmitData_m) ||
-           paylSize_p == 0                             )
+        if(paylSize_p > sizeof(pTxChan->pSsdoTxPayl_m->tssdoTransmitData_m) ||
+           paylSize_p == 0           )
         {
             error_setError(kPsiModuleSsdo, kPsiSsdoTxConsSizeInvalid);
         }
         else
         {
-            /* Check if buffer is free for filling */
-            if(pInstance_p->txBuffParam_m.ssdoTxBuffer_m.isLocked_m == FALSE)
+            /* Check if the queue has a free slot */
+            if(ssdo_isQueueFull(pTxChan) == FALSE)
             {
-                /* Set transmit size */
-                ami_setUint16Le((UINT8*)&pInstance_p->txBuffParam_m.ssdoTxBuffer_m.pSsdoTxPayl_m->paylSize_m, paylSize_p);
-
-                /* Set sequence number in next tx buffer */
-                ami_setUint8Le((UINT8*)&pInstance_p->txBuffParam_m.ssdoTxBuffer_m.pSsdoTxPayl_m->seqNr_m,
-                        pInstance_p->txBuffParam_m.currTxSeqNr_m);
-
-                /* Lock buffer for transmission */
-                pInstance_p->txBuffParam_m.ssdoTxBuffer_m.isLocked_m = TRUE;
-
-                /* Enable transmit timer */
-                timeout_startTimer(pInstance_p->txBuffParam_m.pTimeoutInst_m);
+                ssdo_queueFrame(pInstance_p, pPayload_p, paylSize_p);
 
                 chanState = kSsdoTxStatusSuccessful;
             }
@@ -374,7 +382,8 @@ static BOOL ssdo_initReceiveBuffer(tSsdoChanNum chanId_p,
 
             /* Register frame receive post action */
             if(stream_registerAction(kStreamActionPost, rxBuffId_p,
-                    ssdo_receiveFrame, (void *)&ssdoInstance_l[chanId_p]) != FALSE)
+                    ssdo_receiveFrame, (void *)&ssdoInstance_l[chanId_p],
+                    kStreamActionPrioAsync, kStreamActionCondAlways) != FALSE)
             {
                 fReturn = TRUE;
             }
@@ -415,7 +424,7 @@ static BOOL ssdo_initTransmitBuffer(tSsdoChanNum chanId_p,
         if(pDescSsdoTrans->buffSize_m == sizeof(tTbufSsdoTxStructure))
         {
             /* Remember buffer address for later usage */
-            ssdoInstance_l[chanId_p].txBuffParam_m.ssdoTxBuffer_m.pSsdoTxPayl_m =
+            ssdoInstance_l[chanId_p].txBuffParam_m.pSsdoTxPayl_m =
                     (tTbufSsdoTxStructure *)pDescSsdoTrans->pBuffBase_m;
 
             /* Initialize SSDO transmit timeout instance */
@@ -423,6 +432,10 @@ static BOOL ssdo_initTransmitBuffer(tSsdoChanNum chanId_p,
                     SSDO_TX_TIMEOUT_CYCLE_COUNT);
             if(ssdoInstance_l[chanId_p].txBuffParam_m.pTimeoutInst_m != NULL)
             {
+                /* Let the round trip time lower the timeout down to the floor */
+                timeout_setMinCycleLimit(ssdoInstance_l[chanId_p].txBuffParam_m.pTimeoutInst_m,
+                        SSDO_TX_MIN_TIMEOUT_CYCLE_COUNT);
+
                 fReturn = TRUE;
             }
             else
@@ -456,17 +469,15 @@ static BOOL ssdo_initTransmitBuffer(tSsdoChanNum chanId_p,
 static BOOL ssdo_handleRxFrame(tSsdoInstance pInstance_p)
 {
     BOOL fReturn = FALSE;
-    UINT8*  pRxBuffer;
-    UINT16  rxBuffSize;
+    tSsdoRxChannel* pRxChan = &pInstance_p->rxBuffParam_m;
+    tSsdoRxSlot* pRxSlot;
 
-    if(pInstance_p->rxBuffParam_m.fRxFrameIncoming_m != FALSE)
+    if(pRxChan->queueHead_m != pRxChan->queueTail_m)
     {
-        /* Frame incoming -> forward to the user */
-        pRxBuffer = &pInstance_p->rxBuffParam_m.pSsdoRxBuffer_m->ssdoStubDataDom_m[0];
-        rxBuffSize = ami_getUint16Le((UINT8 *)&pInstance_p->rxBuffParam_m.pSsdoRxBuffer_m->paylSize_m);
+        pRxSlot = &pRxChan->rxQueue_m[pRxChan->queueHead_m & (SSDO_RX_QUEUE_SIZE - 1)];
 
-        /* Call SSDO user handler */
-        if(pInstance_p->rxBuffParam_m.pfnRxHandler_m(pRxBuffer, rxBuffSize))
+        /* Frame queued -> forward to the user */
+        if(pRxChan->pfnRxHandler_m(&pRxSlot->payload_m[0], pRxSlot->paylSize_m))
         {
             /* Return true but don't free the channel! Frame will be retried later */
             fReturn = TRUE;
@@ -490,67 +501,172 @@ static BOOL ssdo_handleRxFrame(tSsdoInstance pInstance_p)
 
 /*----------------------------------------------------------------------------*/
 /**
-\brief    Free the receive channel to enable transmission of the next frame
+\brief    Release the oldest frame of the receive queue
+
+The frame is already acknowledged to the PCP when it is queued. Releasing
+it only frees the queue slot for the next incoming frame.
 
 \param[in]  pInstance_p     SSDO module instance
 */
 /*----------------------------------------------------------------------------*/
 static void ssdo_freeRxChannel(tSsdoInstance pInstance_p)
 {
-    /* Access finished -> Unblock channel by writing current sequence number to status field! */
-    status_setSsdoRxChanFlag(pInstance_p->chanId_m,
-            pInstance_p->rxBuffParam_m.currRxSeqNr_m);
-
-    pInstance_p->rxBuffParam_m.fRxFrameIncoming_m = FALSE;
+    if(pInstance_p->rxBuffParam_m.queueHead_m != pInstance_p->rxBuffParam_m.queueTail_m)
+    {
+        pInstance_p->rxBuffParam_m.queueHead_m++;
+    }
 }
 
 /*----------------------------------------------------------------------------*/
 /**
 \brief    Process SSDO transmit frames
 
+Releases the oldest frame of the transmit queue when it is acknowledged (or
+timed out) and posts the next queued frame to the transmit buffer.
+
 \param[in]  pInstance_p     SSDO module instance
 */
 /*----------------------------------------------------------------------------*/
 static void ssdo_handleTxFrame(tSsdoInstance pInstance_p)
 {
+    tSsdoTxChannel*  pTxChan = &pInstance_p->txBuffParam_m;
     tSsdoChanStatus  txChanState;
     tTimerStatus timerState;
 
-    if(pInstance_p->txBuffParam_m.ssdoTxBuffer_m.isLocked_m != FALSE)
+    if(pTxChan->fFrameInFlight_m != FALSE)
     {
         /* Check if channel is ready for transmission */
         txChanState = ssdo_checkChannelStatus(pInstance_p);
         if(txChanState == kChanStatusFree)
         {
-            /* Ongoing message is acknowledged */
-            pInstance_p->txBuffParam_m.ssdoTxBuffer_m.isLocked_m = FALSE;
+            /* Ongoing message is acknowledged -> Release queue slot */
+            pTxChan->queueHead_m++;
+            pTxChan->fFrameInFlight_m = FALSE;
 
             /* Increment local sequence number */
-            ssdo_changeLocalSeqNr(&pInstance_p->txBuffParam_m.currTxSeqNr_m);
+            ssdo_changeLocalSeqNr(&pTxChan->currTxSeqNr_m);
 
-            /* Message was acknowledged -> Stop timer if running! */
-            timeout_stopTimer(pInstance_p->txBuffParam_m.pTimeoutInst_m);
+            /* Message was acknowledged -> Adapt timeout and stop timer if running! */
+            timeout_updateRtt(pTxChan->pTimeoutInst_m);
+            timeout_stopTimer(pTxChan->pTimeoutInst_m);
         }
         else
         {
             /* Check if timeout counter is expired */
-            timerState = timeout_checkExpire(pInstance_p->txBuffParam_m.pTimeoutInst_m);
+            timerState = timeout_checkExpire(pTxChan->pTimeoutInst_m);
             if(timerState == kTimerStateExpired)
             {
                 /* Timeout occurred -> Increment local sequence number! */
-                ssdo_changeLocalSeqNr(&pInstance_p->txBuffParam_m.currTxSeqNr_m);
+                ssdo_changeLocalSeqNr(&pTxChan->currTxSeqNr_m);
 
-                /* Unlock channel anyway! */
-                pInstance_p->txBuffParam_m.ssdoTxBuffer_m.isLocked_m = FALSE;
+                /* Drop the frame and release the slot anyway! */
+                pTxChan->queueHead_m++;
+                pTxChan->fFrameInFlight_m = FALSE;
             }
         }
     }
+
+    if(pTxChan->fFrameInFlight_m == FALSE &&
+       pTxChan->queueHead_m != pTxChan->queueTail_m)
+    {
+        /* Channel is free -> Post next queued frame */
+        ssdo_sendNextFrame(pInstance_p);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Check if all slots of the transmit queue are in use
+
+\param[in]  pTxChan_p       Transmit channel
+
+\retval TRUE     Queue is full
+\retval FALSE    Queue has a free slot
+*/
+/*----------------------------------------------------------------------------*/
+static BOOL ssdo_isQueueFull(tSsdoTxChannel* pTxChan_p)
+{
+    BOOL fReturn = FALSE;
+
+    if((UINT8)(pTxChan_p->queueTail_m - pTxChan_p->queueHead_m) >= SSDO_TX_QUEUE_SIZE)
+    {
+        fReturn = TRUE;
+    }
+
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Queue a frame to the next free slot of the transmit queue
+
+\param[in]  pInstance_p     SSDO module instance
+\param[in]  pPayload_p      Payload of the frame
+\param[in]  paylSize_p      Size of the payload
+*/
+/*----------------------------------------------------------------------------*/
+static void ssdo_queueFrame(tSsdoInstance pInstance_p, UINT8* pPayload_p,
+        UINT16 paylSize_p)
+{
+    tSsdoTxChannel*  pTxChan = &pInstance_p->txBuffParam_m;
+    tSsdoTxSlot*     pSlot;
+
+    pSlot = &pTxChan->txQueue_m[pTxChan->queueTail_m & (SSDO_TX_QUEUE_SIZE - 1)];
+
+    /* Copy payload if it was not prepared inside the slot */
+    if(pPayload_p != &pSlot->payload_m[0])
+    {
+        PSI_MEMCPY(&pSlot->payload_m[0], pPayload_p, paylSize_p);
+    }
+    pSlot->paylSize_m = paylSize_p;
+
+    /* Queue frame for transmission */
+    pTxChan->queueTail_m++;
+
+    if(pTxChan->fFrameInFlight_m == FALSE)
+    {
+        /* Channel is idle -> Post the frame immediately */
+        ssdo_sendNextFrame(pInstance_p);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Post the oldest frame of the queue to the transmit buffer
+
+\param[in]  pInstance_p     SSDO module instance
+*/
+/*----------------------------------------------------------------------------*/
+static void ssdo_sendNextFrame(tSsdoInstance pInstance_p)
+{
+    tSsdoTxChannel*  pTxChan = &pInstance_p->txBuffParam_m;
+    tSsdoTxSlot*     pSlot;
+
+    pSlot = &pTxChan->txQueue_m[pTxChan->queueHead_m & (SSDO_TX_QUEUE_SIZE - 1)];
+
+    /* Copy payload and set transmit size */
+    PSI_MEMCPY(&pTxChan->pSsdoTxPayl_m->tssdoTransmitData_m[0],
+            &pSlot->payload_m[0], pSlot->paylSize_m);
+    ami_setUint16Le((UINT8*)&pTxChan->pSsdoTxPayl_m->paylSize_m, pSlot->paylSize_m);
+
+    /* Set sequence number in tx buffer */
+    ami_setUint8Le((UINT8*)&pTxChan->pSsdoTxPayl_m->seqNr_m, pTxChan->currTxSeqNr_m);
+
+    pTxChan->fFrameInFlight_m = TRUE;
+
+    /* Enable transmit timer */
+    timeout_startTimer(pTxChan->pTimeoutInst_m);
 }
 
 /*----------------------------------------------------------------------------*/
 /**
 \brief    Check for incoming frame from SSDO channel
 
+A new frame is copied to the receive queue and acknowledged immediately. When
+the queue is full the frame stays unacknowledged in the receive buffer and is
+taken over in a later cycle. A frame which is larger than the receive buffer
+is acknowledged and dropped.
+
 \param[in] pBuffer_p        Pointer to the base address of the buffer
 \param[in] bufSize_p        Size of the buffer
 \param[in] pUserArg_p       The user argument
@@ -562,17 +678,17 @@ static BOOL ssdo_receiveFrame(UINT8* pBuffer_p, UINT16 bufSize_p,
         void* pUserArg_p)
 {
     tSsdoInstance pInstance;
+    tSsdoRxChannel* pRxChan;
+    tSsdoRxSlot* pRxSlot;
     tTbufSsdoRxStructure*  pSsdoRxBuff;
     tSeqNrValue  currSeqNr = kSeqNrValueInvalid;
+    UINT16 paylSize;
 
     UNUSED_PARAMETER(bufSize_p);
 
     /* Get pointer to current instance */
     pInstance = (tSsdoInstance) pUserArg_p;
 
-    /* Increment transmit timer cycle count */
-    timeout_incrementCounter(pInstance->txBuffParam_m.pTimeoutInst_m);
-
     /* Convert to status buffer structure */
     pSsdoRxBuff = (tTbufSsdoRxStructure*) pBuffer_p;
 
@@ -582,14 +698,36 @@ static BOOL ssdo_receiveFrame(UINT8* pBuffer_p, UINT16 bufSize_p,
     if(currSeqNr == kSeqNrValueFirst ||
        currSeqNr == kSeqNrValueSecond  )
     {
+        pRxChan = &pInstance->rxBuffParam_m;
+
         /* Check sequence number against local copy */
-        if(currSeqNr != pInstance->rxBuffParam_m.currRxSeqNr_m)
+        if(currSeqNr != pRxChan->currRxSeqNr_m)
         {
             /* Sequence number changed -> Frame available */
-            pInstance->rxBuffParam_m.fRxFrameIncoming_m = TRUE;
+            if((UINT8)(pRxChan->queueTail_m - pRxChan->queueHead_m) < SSDO_RX_QUEUE_SIZE)
+            {
+                pRxSlot = &pRxChan->rxQueue_m[pRxChan->queueTail_m & (SSDO_RX_QUEUE_SIZE - 1)];
+
+                paylSize = ami_getUint16Le((UINT8 *)&pSsdoRxBuff->paylSize_m);
+                if(paylSize > sizeof(pRxSlot->payload_m))
+                {
+                    /* Invalid size -> Drop the frame but unblock the channel anyway */
+                    error_setError(kPsiModuleSsdo, kPsiSsdoBufferSizeMismatch);
+                }
+                else
+                {
+                    pRxSlot->paylSize_m = paylSize;
+                    PSI_MEMCPY(&pRxSlot->payload_m[0], &pSsdoRxBuff->ssdoStubDataDom_m[0], paylSize);
+
+                    pRxChan->queueTail_m++;
+                }
+
+                /* Increment local receive sequence number */
+                pRxChan->currRxSeqNr_m = currSeqNr;
 
-            /* Increment local receive sequence number */
-            pInstance->rxBuffParam_m.currRxSeqNr_m = currSeqNr;
+                /* Frame is queued -> Unblock channel by writing current sequence number to status field! */
+                status_setSsdoRxChanFlag(pInstance->chanId_m, currSeqNr);
+            }   /* no else: Queue is full -> Frame is taken over later */
         }
     }
 
@@ -311,11 +311,13 @@ static BOOL status_initOutBuffer( tTbufNumLayout statOutId_p)
 
             /* Register status module pre action for sync processing */
             if(stream_registerAction(kStreamActionPre, statOutId_p,
-                    status_processSync, NULL) != FALSE)
+                    status_processSync, NULL, kStreamActionPrioStatus,
+                    kStreamActionCondAlways) != FALSE)
             {
                 /* Register outgoing status module post action for status register update */
                 if(stream_registerAction(kStreamActionPost, statOutId_p,
-                        status_updateOutStatusReg, NULL) != FALSE)
+                        status_updateOutStatusReg, NULL, kStreamActionPrioStatus,
+                        kStreamActionCondAlways) != FALSE)
                 {
                     fReturn = TRUE;
                 }
@@ -359,7 +361,8 @@ static BOOL status_initInBuffer(tTbufNumLayout statInId_p)
 
             /* Register incoming status module post action for status register update */
             if(stream_registerAction(kStreamActionPost, statInId_p,
-                    status_updateInStatusReg, NULL) != FALSE)
+                    status_updateInStatusReg, NULL, kStreamActionPrioStatus,
+                    kStreamActionCondAlways) != FALSE)
             {
                 fReturn = TRUE;
             }
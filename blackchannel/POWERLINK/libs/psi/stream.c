@@ -52,6 +52,8 @@ handler. It enables to insert pre- and post actions before and after transfer.
 
 #include <libpsi/internal/stream.h>
 
+#include <libpsicommon/timeout.h>
+
 /*============================================================================*/
 /*            G L O B A L   D E F I N I T I O N S                             */
 /*============================================================================*/
@@ -78,11 +80,39 @@ handler. It enables to insert pre- and post actions before and after transfer.
 /*----------------------------------------------------------------------------*/
 /* const defines                                                              */
 /*----------------------------------------------------------------------------*/
+#define STREAM_BUFF_ALL_CHANGED     0xFFFFFFFF      /**< Mark all buffers as changed */
+
+#define STREAM_BUFF_MASK(id)        ((UINT32)1 << (id))     /**< Bit of a buffer in the changed mask */
 
 /*----------------------------------------------------------------------------*/
 /* local types                                                                */
 /*----------------------------------------------------------------------------*/
 
+/* Fail to compile if the changed mask has no bit for each buffer */
+typedef char tStreamBuffMaskCheck[(kTbufCount <= 32) ? 1 : -1];
+
+#ifdef STREAM_TIMING_ENABLED
+/**
+ * \brief Accumulated execution time of an action
+ */
+typedef struct {
+    UINT32    count_m;                              /**< Number of measurements in the sum */
+    UINT32    min_m;                                /**< Shortest duration */
+    UINT32    max_m;                                /**< Longest duration */
+    UINT32    sum_m;                                /**< Sum of the durations (Halved with the count on overflow) */
+    UINT16    hist_m[STREAM_TIMING_HIST_BINS];      /**< Histogram of the durations */
+} tStreamTimingStat;
+#endif
+
+/**
+ * \brief State of the input/output image transfer
+ */
+typedef enum {
+    kStreamTransIdle      = 0x00,   /**< No transfer in progress */
+    kStreamTransBusy      = 0x01,   /**< Transfer started by the stream handler */
+    kStreamTransPost      = 0x02,   /**< Transfer finished -> Post actions in progress */
+} tStreamTransState;
+
 /**
  * \brief Element of buffer action list
  */
@@ -90,21 +120,50 @@ typedef struct {
     tTbufNumLayout  buffId_m;          /**< Id of the buffer */
     tBuffAction     pfnBuffAction_m;   /**< Action to trigger */
     void *          pUserArg_m;        /**< User argument of the action */
+    tActionPrio     prio_m;            /**< Priority of the action */
+    tActionCond     cond_m;            /**< Condition which needs to be fulfilled to trigger the action */
+    UINT8           cycleDiv_m;        /**< Action is triggered every n-th cycle */
+    UINT8           cycleCnt_m;        /**< Number of cycles to skip until the next trigger */
+#ifdef STREAM_TIMING_ENABLED
+    tStreamTimingStat timing_m;        /**< Execution time of the action */
+#endif
 } tBuffActionElem;
 
+/**
+ * \brief Dispatch table of one action type sorted by priority
+ */
+typedef struct {
+    tBuffActionElem  actList_m[kTbufCount];     /**< List of actions (Highest priority first) */
+    UINT8            actCount_m;                /**< Number of registered actions */
+} tBuffActionTable;
+
 /**
  * \brief Instance of the stream module
  */
 typedef struct {
     tBuffDescriptor  buffDescList_m[kTbufCount];            /**< List of buffer descriptors */
+    tBuffDescriptor  transDescList_m[kTbufCount];           /**< List of buffer descriptors of the transfer image */
+    BOOL             fDoubleBuffered_m;                     /**< TRUE if the transfer image is separated from the working image */
+    tTbufNumLayout   idConsAck_m;                           /**< Id of the consumer ack register (First consuming buffer) */
+    tTbufNumLayout   idFirstProdBuffer_m;                   /**< Id of the first producing buffer */
 
     tHandlerParam    handlParam_m;                          /**< Parameters of the stream handler */
     tStreamHandler   pfnStreamHandler_m;                    /**< Stream filling handler */
+    BOOL             fAsyncTransfer_m;                      /**< TRUE if the transfer is finished with stream_transferFinished() */
+    volatile tStreamTransState transState_m;                /**< State of the asynchronous transfer */
+    UINT8            transBusyCycles_m;                     /**< Number of cycles the transfer is in progress */
+    UINT8            transTimeoutCycles_m;                  /**< Number of cycles the transfer may be in progress */
 
-    tBuffActionElem  buffPreActList_m[kTbufCount];          /**< List of buffer pre filling actions */
-    tBuffActionElem  buffPostActList_m[kTbufCount];         /**< List of buffer post filling actions */
+    tBuffActionTable buffPreActTable_m;                     /**< Table of buffer pre filling actions */
+    tBuffActionTable buffPostActTable_m;                    /**< Table of buffer post filling actions */
+    UINT32           buffChangedMask_m;                     /**< Buffers changed in the last image exchange (Bit position = buffer id) */
 
     tBuffSyncCb      pfnSyncCb_m;                           /**< Sync callback function */
+
+#ifdef STREAM_TIMING_ENABLED
+    tStreamCycleCount pfnCycleCount_m;                      /**< Cycle counter of the target (NULL: no measurement) */
+    tStreamTimingStat handlerTiming_m;                      /**< Execution time of the stream handler */
+#endif
 } tStreamInstance;
 
 /*----------------------------------------------------------------------------*/
@@ -118,8 +177,20 @@ static tStreamInstance streamInstance_l;
 /*----------------------------------------------------------------------------*/
 static BOOL stream_callActions(tActionType actType_p);
 static UINT16 stream_calcImageSize(tTbufNumLayout firstId_p, tTbufNumLayout lastId_p);
-static tBuffActionElem* stream_getActionList(tActionType actType_p);
+static tBuffActionTable* stream_getActionTable(tActionType actType_p);
 static BOOL stream_callSyncCb(void);
+static BOOL stream_initTransImage(tBuffDescriptor* pTransDescList_p);
+static void stream_initHandlerDesc(tBuffDescriptor* pDesc_p, tSegmentList* pSegs_p,
+        tTbufNumLayout firstId_p, tTbufNumLayout lastId_p);
+static BOOL stream_isImageContiguous(tTbufNumLayout firstId_p, tTbufNumLayout lastId_p);
+static void stream_updateProdImage(void);
+static void stream_updateConsImage(void);
+static BOOL stream_checkTransTimeout(void);
+#ifdef STREAM_TIMING_ENABLED
+static UINT32 stream_startTiming(void);
+static void stream_stopTiming(tStreamTimingStat* pStat_p, UINT32 startCycle_p);
+static tStreamTimingStat* stream_findTiming(tStreamTimingSrc src_p, UINT8 buffId_p);
+#endif
 
 /*============================================================================*/
 /*            P U B L I C   F U N C T I O N S                                 */
@@ -161,19 +232,42 @@ BOOL stream_init(tStreamInitParam* pInitParam_p)
             /* Remember handler of input output stream */
             streamInstance_l.pfnStreamHandler_m = pInitParam_p->pfnStreamHandler_m;
 
-            /* Set consuming buffer handler parameter descriptor to first consuming buffer */
-            streamInstance_l.handlParam_m.consDesc_m.pBuffBase_m =
-                    streamInstance_l.buffDescList_m[pInitParam_p->idConsAck_m].pBuffBase_m;
-            streamInstance_l.handlParam_m.consDesc_m.buffSize_m =
-                    stream_calcImageSize(pInitParam_p->idConsAck_m, pInitParam_p->idFirstProdBuffer_m);
+            streamInstance_l.idConsAck_m = pInitParam_p->idConsAck_m;
+            streamInstance_l.idFirstProdBuffer_m = pInitParam_p->idFirstProdBuffer_m;
 
-            /* Set producing buffer handler parameter descriptor to first producing buffer */
-            streamInstance_l.handlParam_m.prodDesc_m.pBuffBase_m =
-                    streamInstance_l.buffDescList_m[pInitParam_p->idFirstProdBuffer_m].pBuffBase_m;
-            streamInstance_l.handlParam_m.prodDesc_m.buffSize_m =
-                    stream_calcImageSize(pInitParam_p->idFirstProdBuffer_m, kTbufCount);
+            streamInstance_l.fAsyncTransfer_m = pInitParam_p->fAsyncTransfer_m;
+            streamInstance_l.transState_m = kStreamTransIdle;
+            streamInstance_l.transTimeoutCycles_m = pInitParam_p->transTimeoutCycles_m;
+            if(streamInstance_l.transTimeoutCycles_m == 0)
+            {
+                streamInstance_l.transTimeoutCycles_m = STREAM_TRANS_TIMEOUT_CYCLE_COUNT;
+            }
 
-            fReturn = TRUE;
+#ifdef STREAM_TIMING_ENABLED
+            streamInstance_l.pfnCycleCount_m = pInitParam_p->pfnCycleCount_m;
+#endif
+
+            streamInstance_l.buffChangedMask_m = STREAM_BUFF_ALL_CHANGED;
+
+            /* Setup the transfer image (Same as working image if single buffered) */
+            if(stream_initTransImage(pInitParam_p->pTransDescList_m) != FALSE)
+            {
+                /* Set consuming buffer handler parameters to the consuming buffers */
+                stream_initHandlerDesc(&streamInstance_l.handlParam_m.consDesc_m,
+                        &streamInstance_l.handlParam_m.consSegs_m,
+                        pInitParam_p->idConsAck_m, pInitParam_p->idFirstProdBuffer_m);
+
+                /* Set producing buffer handler parameters to the producing buffers */
+                stream_initHandlerDesc(&streamInstance_l.handlParam_m.prodDesc_m,
+                        &streamInstance_l.handlParam_m.prodSegs_m,
+                        pInitParam_p->idFirstProdBuffer_m, kTbufCount);
+
+                fReturn = TRUE;
+            }
+            else
+            {
+                error_setError(kPsiModuleStream, kPsiStreamInitError);
+            }
         }
     }
 
@@ -216,55 +310,188 @@ tBuffDescriptor* stream_getBufferParam(tTbufNumLayout buffId_p)
 /**
 \brief   Register a new action to a buffer
 
+The action is inserted into the dispatch table of its type behind all actions
+with the same or a higher priority. Actions with the condition
+kStreamActionCondChanged are only triggered when the content of the buffer
+changed in the last image exchange. Changes are only detected for consuming
+buffers in double buffered mode. Otherwise the buffer is always treated as
+changed and the condition behaves like kStreamActionCondAlways.
+
 \param[in]  actType_p        Type of action (Pre- or post filling)
 \param[in]  buffId_p         Id of the buffer for the action
 \param[in]  pfnBuffAct_p     Pointer to the action function
 \param[in]  pUserArg_p       User argument to pass to function
+\param[in]  prio_p           Priority of the action
+\param[in]  cond_p           Condition to trigger the action
 
 \retval TRUE         Successfully registered action to buffer
 \retval FALSE        Invalid buffer! Can't register
 */
 /*----------------------------------------------------------------------------*/
 BOOL stream_registerAction(tActionType actType_p, UINT8 buffId_p,
-        tBuffAction pfnBuffAct_p, void * pUserArg_p)
+        tBuffAction pfnBuffAct_p, void * pUserArg_p, tActionPrio prio_p,
+        tActionCond cond_p)
 {
     BOOL fReturn = FALSE;
     UINT8  i;
-    tBuffActionElem* pBuffActElem;
+    tBuffActionTable* pActTable;
+
+    pActTable = stream_getActionTable(actType_p);
 
-    if(pfnBuffAct_p == NULL)
+    if(pfnBuffAct_p == NULL               ||
+       pActTable == NULL                  ||
+       buffId_p >= kTbufCount             ||
+       prio_p >= kStreamActionPrioCount   ||
+       cond_p >= kStreamActionCondCount    )
     {
         error_setError(kPsiModuleStream, kPsiStreamInvalidParameter);
     }
+    else if(pActTable->actCount_m >= kTbufCount)
+    {
+        /* Set error when list is full */
+        error_setError(kPsiModuleStream, kPsiStreamNoFreeElementFound);
+    }
     else
     {
-        pBuffActElem = stream_getActionList(actType_p);
-        if(pBuffActElem == NULL)
+        /* Move all actions with a lower priority one element back */
+        for(i = pActTable->actCount_m; i > 0; i--)
         {
-            error_setError(kPsiModuleStream, kPsiStreamInvalidParameter);
+            if(pActTable->actList_m[i - 1].prio_m <= prio_p)
+            {
+                break;
+            }
+
+            pActTable->actList_m[i] = pActTable->actList_m[i - 1];
         }
-        else
+
+        /* Insert action */
+        pActTable->actList_m[i].buffId_m = (tTbufNumLayout)buffId_p;
+        pActTable->actList_m[i].pfnBuffAction_m = pfnBuffAct_p;
+        pActTable->actList_m[i].pUserArg_m = pUserArg_p;
+        pActTable->actList_m[i].prio_m = prio_p;
+        pActTable->actList_m[i].cond_m = cond_p;
+        pActTable->actList_m[i].cycleDiv_m = 1;
+        pActTable->actList_m[i].cycleCnt_m = 0;
+#ifdef STREAM_TIMING_ENABLED
+        PSI_MEMSET(&pActTable->actList_m[i].timing_m, 0, sizeof(tStreamTimingStat));
+#endif
+
+        pActTable->actCount_m++;
+
+        fReturn = TRUE;
+    }
+
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Remove an action from a buffer
+
+The action is identified by its buffer, function and user argument. All
+following actions move one element forward, so the order of the remaining
+actions is kept.
+
+\param[in]  actType_p        Type of action (Pre- or post filling)
+\param[in]  buffId_p         Id of the buffer of the action
+\param[in]  pfnBuffAct_p     Pointer to the action function
+\param[in]  pUserArg_p       User argument of the action
+
+\retval TRUE         Successfully removed the action
+\retval FALSE        Action is not registered
+*/
+/*----------------------------------------------------------------------------*/
+BOOL stream_unregisterAction(tActionType actType_p, UINT8 buffId_p,
+        tBuffAction pfnBuffAct_p, void * pUserArg_p)
+{
+    BOOL fReturn = FALSE;
+    UINT8  i;
+    tBuffActionTable* pActTable;
+
+    pActTable = stream_getActionTable(actType_p);
+
+    if(pActTable == NULL)
+    {
+        error_setError(kPsiModuleStream, kPsiStreamInvalidParameter);
+    }
+    else
+    {
+        for(i=0; i < pActTable->actCount_m; i++)
         {
-            for(i=0; i < kTbufCount; i++, pBuffActElem++)
+            if(fReturn != FALSE)
             {
-                if(pBuffActElem->pfnBuffAction_m == NULL)
-                {
-                    /* Free element found -> Insert action */
-                    pBuffActElem->buffId_m = buffId_p;
-                    pBuffActElem->pfnBuffAction_m = pfnBuffAct_p;
-                    pBuffActElem->pUserArg_m = pUserArg_p;
-
-                    fReturn = TRUE;
-                    break;
-                }
+                /* Close the gap of the removed action */
+                pActTable->actList_m[i - 1] = pActTable->actList_m[i];
             }
+            else if(pActTable->actList_m[i].buffId_m == buffId_p            &&
+                    pActTable->actList_m[i].pfnBuffAction_m == pfnBuffAct_p &&
+                    pActTable->actList_m[i].pUserArg_m == pUserArg_p         )
+            {
+                fReturn = TRUE;
+            }
+        }
 
-            if(fReturn == FALSE)
+        if(fReturn != FALSE)
+        {
+            pActTable->actCount_m--;
+        }
+    }
+
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Set the rate of the actions of a buffer
+
+Slow actions don't need to be triggered in each cycle. They can be reduced
+to every n-th cycle with the cycle divider. Different phases spread slow
+actions over different cycles to lower the worst case execution time of
+the synchronous interrupt. The phase is counted from the next call of the
+actions. A changed buffer is missed by an action with the condition
+kStreamActionCondChanged if the action is not triggered in this cycle.
+
+\param[in]  actType_p        Type of action (Pre- or post filling)
+\param[in]  buffId_p         Id of the buffer of the actions
+\param[in]  cycleDiv_p       Cycle divider of the actions (1: each cycle)
+\param[in]  cyclePhase_p     First cycle to trigger the actions (Smaller than the divider)
+
+\retval TRUE         Rate of all actions of the buffer changed
+\retval FALSE        Invalid parameter or no action registered to the buffer
+*/
+/*----------------------------------------------------------------------------*/
+BOOL stream_setActionRate(tActionType actType_p, UINT8 buffId_p,
+        UINT8 cycleDiv_p, UINT8 cyclePhase_p)
+{
+    BOOL fReturn = FALSE;
+    UINT8  i;
+    tBuffActionTable* pActTable;
+
+    pActTable = stream_getActionTable(actType_p);
+
+    if(pActTable == NULL           ||
+       cycleDiv_p == 0             ||
+       cyclePhase_p >= cycleDiv_p   )
+    {
+        error_setError(kPsiModuleStream, kPsiStreamInvalidParameter);
+    }
+    else
+    {
+        for(i=0; i < pActTable->actCount_m; i++)
+        {
+            if(pActTable->actList_m[i].buffId_m == buffId_p)
             {
-                /* Set error when list is full */
-                error_setError(kPsiModuleStream, kPsiStreamNoFreeElementFound);
+                pActTable->actList_m[i].cycleDiv_m = cycleDiv_p;
+                pActTable->actList_m[i].cycleCnt_m = cyclePhase_p;
+
+                fReturn = TRUE;
             }
         }
+
+        if(fReturn == FALSE)
+        {
+            error_setError(kPsiModuleStream, kPsiStreamInvalidParameter);
+        }
     }
 
     return fReturn;
@@ -289,6 +516,15 @@ void stream_registerSyncCb(tBuffSyncCb pfnSyncCb_p)
 This procedure starts the transfer of the local buffers and starts pre- or post
 actions for each type of buffer.
 
+In double buffered mode the producing buffers of the working image are copied
+to the transfer image after the pre actions. The working image is therefore
+never touched by the stream handler and can be accessed while the transfer
+is in progress.
+
+With an asynchronous transfer the stream handler only starts the transfer.
+The cycle is skipped if the last transfer is still in progress. After
+the configured number of skipped cycles the transfer is aborted.
+
 \retval TRUE      Successfully processed the synchronous task
 \retval FALSE     Unable to transfer data or call user action
 */
@@ -296,17 +532,43 @@ actions for each type of buffer.
 BOOL stream_processSync(void)
 {
     BOOL fReturn = FALSE;
+    BOOL fHandlerRet;
+#ifdef STREAM_TIMING_ENABLED
+    UINT32 startCycle;
+#endif
 
-    /* Call all pre filling actions */
-    if(stream_callActions(kStreamActionPre) != FALSE)
+    if(streamInstance_l.fAsyncTransfer_m != FALSE &&
+       streamInstance_l.transState_m != kStreamTransIdle)
+    {
+        /* Last transfer not finished -> Skip this cycle */
+        fReturn = stream_checkTransTimeout();
+    }
+    else if(stream_callActions(kStreamActionPre) != FALSE)
     {
+        /* Hand over the producing buffers to the transfer image */
+        stream_updateProdImage();
+
+        /* Set busy before the handler as the transfer can finish in the handler */
+        streamInstance_l.transState_m = kStreamTransBusy;
+        streamInstance_l.transBusyCycles_m = 0;
+
         /* Transfer stream input/output data */
-        if(streamInstance_l.pfnStreamHandler_m(&streamInstance_l.handlParam_m) != FALSE)
+#ifdef STREAM_TIMING_ENABLED
+        startCycle = stream_startTiming();
+        fHandlerRet = streamInstance_l.pfnStreamHandler_m(&streamInstance_l.handlParam_m);
+        stream_stopTiming(&streamInstance_l.handlerTiming_m, startCycle);
+#else
+        fHandlerRet = streamInstance_l.pfnStreamHandler_m(&streamInstance_l.handlParam_m);
+#endif
+
+        if(fHandlerRet != FALSE)
         {
             fReturn = TRUE;
         }
         else
         {
+            streamInstance_l.transState_m = kStreamTransIdle;
+
             /* Stream handler error handler */
             error_setError(kPsiModuleStream, kPsiStreamTransferError);
         }
@@ -322,6 +584,9 @@ BOOL stream_processSync(void)
 This procedure triggers all post actions of the libpsi. A post action
 are all tasks which are after the exchange of the input/output image.
 
+In double buffered mode the received consuming buffers are copied from the
+transfer image to the working image before the post actions are called.
+
 \retval TRUE      Successfully processed the post actions
 \retval FALSE     Unable to process post actions
 */
@@ -330,6 +595,12 @@ BOOL stream_processPostActions(void)
 {
     BOOL fReturn = FALSE;
 
+    /* Take over the received consuming buffers from the transfer image */
+    stream_updateConsImage();
+
+    /* Advance the transmit timers of all channels by one cycle */
+    timeout_processSync();
+
     /* Call all post transfer actions */
     if(stream_callActions(kStreamActionPost) != FALSE)
     {
@@ -340,9 +611,120 @@ BOOL stream_processPostActions(void)
         }
     }
 
+    streamInstance_l.transState_m = kStreamTransIdle;
+
     return fReturn;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Finish an asynchronous transfer
+
+This is the completion event of an asynchronous stream handler. After a
+successful transfer all post actions are processed. The event is only
+accepted while a transfer is in progress.
+
+\param[in]  fError_p     TRUE if the transfer has failed
+
+\retval TRUE      Successfully processed the post actions
+\retval FALSE     Transfer failed, unexpected event or post actions failed
+*/
+/*----------------------------------------------------------------------------*/
+BOOL stream_transferFinished(BOOL fError_p)
+{
+    BOOL fReturn = FALSE;
+
+    if(streamInstance_l.fAsyncTransfer_m == FALSE ||
+       streamInstance_l.transState_m != kStreamTransBusy)
+    {
+        error_setError(kPsiModuleStream, kPsiStreamTransferStateError);
+    }
+    else if(fError_p != FALSE)
+    {
+        streamInstance_l.transState_m = kStreamTransIdle;
+
+        error_setError(kPsiModuleStream, kPsiStreamTransferError);
+    }
+    else
+    {
+        streamInstance_l.transState_m = kStreamTransPost;
+
+        fReturn = stream_processPostActions();
+    }
+
+    return fReturn;
+}
+
+#ifdef STREAM_TIMING_ENABLED
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Get the execution time statistic of an action
+
+The statistic is available if a cycle counter was passed to the stream module
+on initialization. For the stream handler only the call itself is measured.
+A transfer which is finished in an interrupt is not included.
+
+\param[in]  src_p            Source of the statistic
+\param[in]  buffId_p         Id of the buffer of the action (Ignored for the handler)
+\param[out] pTiming_p        Statistic of the first action registered to the buffer
+
+\retval TRUE         Statistic is returned
+\retval FALSE        No action is registered to the buffer or invalid parameter
+*/
+/*----------------------------------------------------------------------------*/
+BOOL stream_getTiming(tStreamTimingSrc src_p, UINT8 buffId_p,
+        tStreamTiming* pTiming_p)
+{
+    BOOL fReturn = FALSE;
+    tStreamTimingStat* pStat;
+
+    if(pTiming_p == NULL)
+    {
+        error_setError(kPsiModuleStream, kPsiStreamInvalidParameter);
+    }
+    else
+    {
+        pStat = stream_findTiming(src_p, buffId_p);
+        if(pStat != NULL)
+        {
+            pTiming_p->count_m = pStat->count_m;
+            pTiming_p->min_m = pStat->min_m;
+            pTiming_p->max_m = pStat->max_m;
+            pTiming_p->mean_m = (pStat->count_m != 0) ? (pStat->sum_m / pStat->count_m) : 0;
+            PSI_MEMCPY(&pTiming_p->hist_m, &pStat->hist_m, sizeof(pTiming_p->hist_m));
+
+            fReturn = TRUE;
+        }
+    }
+
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Reset the execution time statistics of all actions
+*/
+/*----------------------------------------------------------------------------*/
+void stream_resetTiming(void)
+{
+    UINT8 i;
+
+    for(i=0; i < streamInstance_l.buffPreActTable_m.actCount_m; i++)
+    {
+        PSI_MEMSET(&streamInstance_l.buffPreActTable_m.actList_m[i].timing_m, 0,
+                sizeof(tStreamTimingStat));
+    }
+
+    for(i=0; i < streamInstance_l.buffPostActTable_m.actCount_m; i++)
+    {
+        PSI_MEMSET(&streamInstance_l.buffPostActTable_m.actList_m[i].timing_m, 0,
+                sizeof(tStreamTimingStat));
+    }
+
+    PSI_MEMSET(&streamInstance_l.handlerTiming_m, 0, sizeof(tStreamTimingStat));
+}
+#endif /* #ifdef STREAM_TIMING_ENABLED */
+
 /*============================================================================*/
 /*            P R I V A T E   F U N C T I O N S                               */
 /*============================================================================*/
@@ -351,7 +733,12 @@ BOOL stream_processPostActions(void)
 
 /*----------------------------------------------------------------------------*/
 /**
-\brief   Call all buffer filling post actions
+\brief   Call all buffer filling actions of one type
+
+The actions are called in the order of their priority. Actions with a
+cycle divider are skipped until their cycle is reached. Actions which
+are only triggered on a changed buffer are skipped if the buffer is
+unchanged.
 
 \param[in] actType_p               Pre- or post filling actions
 
@@ -361,44 +748,89 @@ BOOL stream_processPostActions(void)
 /*----------------------------------------------------------------------------*/
 static BOOL stream_callActions(tActionType actType_p)
 {
-    BOOL fReturn = FALSE, fRetAct;
+    BOOL fReturn = TRUE;
     UINT8 i;
     tBuffDescriptor* pBuffElement;
-    tBuffActionElem* pBuffActList;
+    tBuffActionTable* pActTable;
+    tBuffActionElem* pBuffActElem;
+    BOOL fActRet;
+#ifdef STREAM_TIMING_ENABLED
+    UINT32 startCycle;
+#endif
 
-    pBuffActList = stream_getActionList(actType_p);
+    pActTable = stream_getActionTable(actType_p);
 
-    /* Call buffer action for each buffer */
-    for(i=0; i < kTbufCount; i++, pBuffActList++)
+    /* Call buffer action for each registered action */
+    for(i=0; i < pActTable->actCount_m; i++)
     {
-        if(pBuffActList->pfnBuffAction_m != NULL)
+        pBuffActElem = &pActTable->actList_m[i];
+
+        if(pBuffActElem->cycleCnt_m != 0)
         {
-            /* Get buffer element by Id */
-            pBuffElement = &streamInstance_l.buffDescList_m[pBuffActList->buffId_m];
+            /* Not the cycle of this action -> Skip action */
+            pBuffActElem->cycleCnt_m--;
+            continue;
+        }
 
-            fRetAct = pBuffActList->pfnBuffAction_m(pBuffElement->pBuffBase_m,
-                                               pBuffElement->buffSize_m,
-                                               pBuffActList->pUserArg_m);
-            if(fRetAct == FALSE)
-            {
-                /* Error happened.. return! */
-                error_setError(kPsiModuleStream, kPsiStreamProcessActionFailed);
+        pBuffActElem->cycleCnt_m = pBuffActElem->cycleDiv_m - 1;
 
-                break;
-            }
+        if(pBuffActElem->cond_m == kStreamActionCondChanged &&
+           (streamInstance_l.buffChangedMask_m & STREAM_BUFF_MASK(pBuffActElem->buffId_m)) == 0)
+        {
+            /* Buffer is unchanged -> Skip action */
+            continue;
         }
-        else
+
+        /* Get buffer element by Id */
+        pBuffElement = &streamInstance_l.buffDescList_m[pBuffActElem->buffId_m];
+
+#ifdef STREAM_TIMING_ENABLED
+        startCycle = stream_startTiming();
+        fActRet = pBuffActElem->pfnBuffAction_m(pBuffElement->pBuffBase_m,
+                                                pBuffElement->buffSize_m,
+                                                pBuffActElem->pUserArg_m);
+        stream_stopTiming(&pBuffActElem->timing_m, startCycle);
+#else
+        fActRet = pBuffActElem->pfnBuffAction_m(pBuffElement->pBuffBase_m,
+                                                pBuffElement->buffSize_m,
+                                                pBuffActElem->pUserArg_m);
+#endif
+
+        if(fActRet == FALSE)
         {
-            /* All set actions carried out! return! */
-            fReturn = TRUE;
+            /* Error happened.. return! */
+            error_setError(kPsiModuleStream, kPsiStreamProcessActionFailed);
+
+            fReturn = FALSE;
             break;
         }
     }
 
-    if(i == kTbufCount)
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Check the timeout of an asynchronous transfer in progress
+
+\retval TRUE         Transfer is still allowed to finish
+\retval FALSE        Timeout of the transfer -> Transfer aborted
+*/
+/*----------------------------------------------------------------------------*/
+static BOOL stream_checkTransTimeout(void)
+{
+    BOOL fReturn = TRUE;
+
+    streamInstance_l.transBusyCycles_m++;
+
+    if(streamInstance_l.transBusyCycles_m > streamInstance_l.transTimeoutCycles_m)
     {
-        /* All actions set and carried out */
-        fReturn = TRUE;
+        /* Abort the transfer -> Next cycle starts a new one */
+        streamInstance_l.transState_m = kStreamTransIdle;
+
+        error_setError(kPsiModuleStream, kPsiStreamTransferTimeout);
+
+        fReturn = FALSE;
     }
 
     return fReturn;
@@ -429,28 +861,28 @@ static UINT16 stream_calcImageSize(tTbufNumLayout firstId_p, tTbufNumLayout last
 
 /*----------------------------------------------------------------------------*/
 /**
-\brief   Get action list for action type
+\brief   Get action table for action type
 
 \param[in] actType_p               Type of the action
 
-\retval Address            Pointer to the action list
-\retval Null               Invalid action type for action list
+\retval Address            Pointer to the action table
+\retval Null               Invalid action type for action table
 */
 /*----------------------------------------------------------------------------*/
-static tBuffActionElem* stream_getActionList(tActionType actType_p)
+static tBuffActionTable* stream_getActionTable(tActionType actType_p)
 {
-    tBuffActionElem* pBuffActElem = NULL;
+    tBuffActionTable* pActTable = NULL;
 
     switch(actType_p)
     {
         case kStreamActionPre:
         {
-            pBuffActElem = &streamInstance_l.buffPreActList_m[0];
+            pActTable = &streamInstance_l.buffPreActTable_m;
             break;
         }
         case kStreamActionPost:
         {
-            pBuffActElem = &streamInstance_l.buffPostActList_m[0];
+            pActTable = &streamInstance_l.buffPostActTable_m;
             break;
         }
         default:
@@ -460,7 +892,7 @@ static tBuffActionElem* stream_getActionList(tActionType actType_p)
         }
     }
 
-    return pBuffActElem;
+    return pActTable;
 }
 
 /*----------------------------------------------------------------------------*/
@@ -495,6 +927,317 @@ static BOOL stream_callSyncCb(void)
     return fReturn;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Initialize the descriptor list of the transfer image
+
+If no transfer descriptor list is provided the working image is also used
+as transfer image. Otherwise the layout of the transfer image needs to match
+the layout of the working image.
+
+\param[in] pTransDescList_p        Descriptor list of the transfer image (Can be NULL)
+
+\retval TRUE           Transfer image successfully initialized
+\retval FALSE          Layout of the transfer image is invalid
+*/
+/*----------------------------------------------------------------------------*/
+static BOOL stream_initTransImage(tBuffDescriptor* pTransDescList_p)
+{
+    BOOL fReturn = TRUE;
+    UINT8 i;
+
+    if(pTransDescList_p == NULL)
+    {
+        /* Single buffered -> Transfer the working image */
+        PSI_MEMCPY(&streamInstance_l.transDescList_m,
+                &streamInstance_l.buffDescList_m,
+                sizeof(streamInstance_l.transDescList_m));
+
+        streamInstance_l.fDoubleBuffered_m = FALSE;
+    }
+    else
+    {
+        PSI_MEMCPY(&streamInstance_l.transDescList_m,
+                pTransDescList_p,
+                sizeof(streamInstance_l.transDescList_m));
+
+        for(i=0; i < kTbufCount; i++)
+        {
+            if(streamInstance_l.transDescList_m[i].pBuffBase_m == NULL  ||
+               streamInstance_l.transDescList_m[i].buffSize_m !=
+                       streamInstance_l.buffDescList_m[i].buffSize_m     )
+            {
+                /* Both images need to have the same layout */
+                fReturn = FALSE;
+                break;
+            }
+        }
+
+        streamInstance_l.fDoubleBuffered_m = fReturn;
+    }
+
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Initialize the stream handler parameters of one transfer direction
+
+The segment list points to the buffer descriptors of the transfer image. The
+contiguous descriptor is only set if the buffers are located back to back.
+
+\param[out] pDesc_p                Contiguous descriptor of the direction
+\param[out] pSegs_p                Segment list of the direction
+\param[in]  firstId_p              Id of the first buffer of the direction
+\param[in]  lastId_p               Id of the buffer after the last buffer
+*/
+/*----------------------------------------------------------------------------*/
+static void stream_initHandlerDesc(tBuffDescriptor* pDesc_p, tSegmentList* pSegs_p,
+        tTbufNumLayout firstId_p, tTbufNumLayout lastId_p)
+{
+    pSegs_p->pSegList_m = &streamInstance_l.transDescList_m[firstId_p];
+    pSegs_p->segCount_m = (UINT8)(lastId_p - firstId_p);
+
+    pDesc_p->buffSize_m = stream_calcImageSize(firstId_p, lastId_p);
+
+    if(stream_isImageContiguous(firstId_p, lastId_p) != FALSE)
+    {
+        pDesc_p->pBuffBase_m = streamInstance_l.transDescList_m[firstId_p].pBuffBase_m;
+    }
+    else
+    {
+        /* Image is scattered -> Only the segment list can be used */
+        pDesc_p->pBuffBase_m = NULL;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Check if a range of buffers of the transfer image is contiguous
+
+\param[in] firstId_p               Id of the first buffer of the range
+\param[in] lastId_p                Id of the buffer after the last buffer
+
+\retval TRUE           All buffers are located back to back
+\retval FALSE          There is a gap between two buffers
+*/
+/*----------------------------------------------------------------------------*/
+static BOOL stream_isImageContiguous(tTbufNumLayout firstId_p, tTbufNumLayout lastId_p)
+{
+    BOOL fReturn = TRUE;
+    UINT8 i;
+    tBuffDescriptor* pTransList = &streamInstance_l.transDescList_m[0];
+
+    for(i=firstId_p + 1; i < lastId_p; i++)
+    {
+        if(pTransList[i - 1].pBuffBase_m + pTransList[i - 1].buffSize_m !=
+                pTransList[i].pBuffBase_m)
+        {
+            fReturn = FALSE;
+            break;
+        }
+    }
+
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Update the producing buffers of the transfer image
+
+In double buffered mode all producing buffers of the working image are copied
+to the transfer image. The stream handler always transfers the whole
+producing image, so the buffers are not compared.
+*/
+/*----------------------------------------------------------------------------*/
+static void stream_updateProdImage(void)
+{
+    UINT8 i;
+    tBuffDescriptor* pWorkDesc;
+    tBuffDescriptor* pTransDesc;
+
+    if(streamInstance_l.fDoubleBuffered_m != FALSE)
+    {
+        for(i=streamInstance_l.idFirstProdBuffer_m; i < kTbufCount; i++)
+        {
+            pWorkDesc = &streamInstance_l.buffDescList_m[i];
+            pTransDesc = &streamInstance_l.transDescList_m[i];
+
+            PSI_MEMCPY(pTransDesc->pBuffBase_m, pWorkDesc->pBuffBase_m,
+                    pWorkDesc->buffSize_m);
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Take over the consuming buffers from the transfer image
+
+In double buffered mode only consuming buffers which differ from the working
+image are copied and marked as changed. In single buffered mode all buffers
+are always marked as changed.
+*/
+/*----------------------------------------------------------------------------*/
+static void stream_updateConsImage(void)
+{
+    UINT8 i;
+    tBuffDescriptor* pWorkDesc;
+    tBuffDescriptor* pTransDesc;
+
+    if(streamInstance_l.fDoubleBuffered_m != FALSE)
+    {
+        for(i=streamInstance_l.idConsAck_m; i < streamInstance_l.idFirstProdBuffer_m; i++)
+        {
+            pWorkDesc = &streamInstance_l.buffDescList_m[i];
+            pTransDesc = &streamInstance_l.transDescList_m[i];
+
+            if(PSI_MEMCMP(pWorkDesc->pBuffBase_m, pTransDesc->pBuffBase_m,
+                    pTransDesc->buffSize_m) != 0)
+            {
+                PSI_MEMCPY(pWorkDesc->pBuffBase_m, pTransDesc->pBuffBase_m,
+                        pTransDesc->buffSize_m);
+
+                streamInstance_l.buffChangedMask_m |= STREAM_BUFF_MASK(i);
+            }
+            else
+            {
+                streamInstance_l.buffChangedMask_m &= ~STREAM_BUFF_MASK(i);
+            }
+        }
+    }
+}
+
+#ifdef STREAM_TIMING_ENABLED
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Start the measurement of an execution time
+
+\retval UINT32      Current value of the cycle counter (Zero if not available)
+*/
+/*----------------------------------------------------------------------------*/
+static UINT32 stream_startTiming(void)
+{
+    UINT32 cycle = 0;
+
+    if(streamInstance_l.pfnCycleCount_m != NULL)
+    {
+        cycle = streamInstance_l.pfnCycleCount_m();
+    }
+
+    return cycle;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Finish the measurement of an execution time and update the statistic
+
+\param[in,out] pStat_p          Statistic to update
+\param[in]     startCycle_p     Cycle counter value at the start of the measurement
+*/
+/*----------------------------------------------------------------------------*/
+static void stream_stopTiming(tStreamTimingStat* pStat_p, UINT32 startCycle_p)
+{
+    UINT32 duration;
+    UINT32 binVal;
+    UINT8 bin = 0;
+
+    if(streamInstance_l.pfnCycleCount_m != NULL)
+    {
+        /* Unsigned arithmetic handles a wrap of the counter */
+        duration = streamInstance_l.pfnCycleCount_m() - startCycle_p;
+
+        if(pStat_p->count_m == 0 || duration < pStat_p->min_m)
+        {
+            pStat_p->min_m = duration;
+        }
+
+        if(duration > pStat_p->max_m)
+        {
+            pStat_p->max_m = duration;
+        }
+
+        if(pStat_p->sum_m + duration < pStat_p->sum_m)
+        {
+            /* Sum overflows -> Halve sum and count to keep the mean */
+            pStat_p->sum_m >>= 1;
+            pStat_p->count_m >>= 1;
+        }
+
+        pStat_p->sum_m += duration;
+        pStat_p->count_m++;
+
+        /* Each bin doubles the upper limit of the previous one */
+        binVal = duration >> STREAM_TIMING_HIST_SHIFT;
+        while(binVal != 0 && bin < (STREAM_TIMING_HIST_BINS - 1))
+        {
+            binVal >>= 1;
+            bin++;
+        }
+
+        if(pStat_p->hist_m[bin] < 0xFFFF)
+        {
+            pStat_p->hist_m[bin]++;
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Find the execution time statistic of an action
+
+\param[in]  src_p            Source of the statistic
+\param[in]  buffId_p         Id of the buffer of the action
+
+\retval Address      Pointer to the statistic
+\retval NULL         No action registered to the buffer
+*/
+/*----------------------------------------------------------------------------*/
+static tStreamTimingStat* stream_findTiming(tStreamTimingSrc src_p, UINT8 buffId_p)
+{
+    tStreamTimingStat* pStat = NULL;
+    tBuffActionTable* pActTable = NULL;
+    UINT8 i;
+
+    switch(src_p)
+    {
+        case kStreamTimingPreAction:
+        {
+            pActTable = stream_getActionTable(kStreamActionPre);
+            break;
+        }
+        case kStreamTimingPostAction:
+        {
+            pActTable = stream_getActionTable(kStreamActionPost);
+            break;
+        }
+        case kStreamTimingHandler:
+        {
+            pStat = &streamInstance_l.handlerTiming_m;
+            break;
+        }
+        default:
+        {
+            error_setError(kPsiModuleStream, kPsiStreamInvalidParameter);
+            break;
+        }
+    }
+
+    if(pActTable != NULL)
+    {
+        for(i=0; i < pActTable->actCount_m; i++)
+        {
+            if(pActTable->actList_m[i].buffId_m == buffId_p)
+            {
+                pStat = &pActTable->actList_m[i].timing_m;
+                break;
+            }
+        }
+    }
+
+    return pStat;
+}
+#endif /* #ifdef STREAM_TIMING_ENABLED */
+
 /**
  * \}
  * \}
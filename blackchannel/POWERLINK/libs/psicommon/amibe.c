@@ -9,7 +9,8 @@
 
 This file implements the AMI interface in big endian for architectures
 where access to unaligned addresses is not possible. (This implementation
-always copies bytewise)
+always copies bytewise) On hosts with unaligned access a single native load or
+store is used instead. (See libpsicommon/internal/ami.h)
 
 \ingroup group_libpsicommon
 *******************************************************************************/
@@ -44,7 +45,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*----------------------------------------------------------------------------*/
 /* includes                                                                   */
 /*----------------------------------------------------------------------------*/
-#include <libpsicommon/ami.h>
+#include <libpsicommon/internal/ami.h>
 
 /*============================================================================*/
 /*            G L O B A L   D E F I N I T I O N S                             */
@@ -71,6 +72,10 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* const defines                                                              */
 /*----------------------------------------------------------------------------*/
 
+#if defined(AMI_HOST_LITTLE_ENDIAN)
+#error "amibe.c implements the AMI of big endian hosts. Use amile.c on this host!"
+#endif
+
 /*----------------------------------------------------------------------------*/
 /* local types                                                                */
 /*----------------------------------------------------------------------------*/
@@ -99,8 +104,12 @@ Sets a 16 bit value to a buffer in big endian
 /*----------------------------------------------------------------------------*/
 void ami_setUint16Be(void* pAddr_p, UINT16 uint16Val_p)
 {
+#ifdef AMI_NATIVE_ACCESS
+    AMI_STORE(pAddr_p, &uint16Val_p);
+#else
     ((UINT8 *) pAddr_p)[0] = ((UINT8 *) &uint16Val_p)[0];
     ((UINT8 *) pAddr_p)[1] = ((UINT8 *) &uint16Val_p)[1];
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -115,8 +124,13 @@ Sets a 16 bit value to a buffer in little endian
 /*----------------------------------------------------------------------------*/
 void ami_setUint16Le(void* pAddr_p, UINT16 uint16Val_p)
 {
+#ifdef AMI_NATIVE_ACCESS
+    uint16Val_p = AMI_SWAP16(uint16Val_p);
+    AMI_STORE(pAddr_p, &uint16Val_p);
+#else
     ((UINT8 *) pAddr_p)[1] = ((UINT8 *) &uint16Val_p)[0];
     ((UINT8 *) pAddr_p)[0] = ((UINT8 *) &uint16Val_p)[1];
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -135,8 +149,12 @@ UINT16 ami_getUint16Be(void* pAddr_p)
 {
     UINT16 val;
 
+#ifdef AMI_NATIVE_ACCESS
+    AMI_LOAD(&val, pAddr_p);
+#else
     ((UINT8 *) &val)[0] = ((UINT8 *) pAddr_p)[0];
     ((UINT8 *) &val)[1] = ((UINT8 *) pAddr_p)[1];
+#endif
 
     return val;
 }
@@ -157,8 +175,13 @@ UINT16 ami_getUint16Le(void* pAddr_p)
 {
     UINT16 val;
 
+#ifdef AMI_NATIVE_ACCESS
+    AMI_LOAD(&val, pAddr_p);
+    val = AMI_SWAP16(val);
+#else
     ((UINT8 *) &val)[1] = ((UINT8 *) pAddr_p)[0];
     ((UINT8 *) &val)[0] = ((UINT8 *) pAddr_p)[1];
+#endif
 
     return val;
 }
@@ -175,10 +198,14 @@ Sets a 32 bit value to a buffer in big endian
 /*----------------------------------------------------------------------------*/
 void ami_setUint32Be(void* pAddr_p, UINT32 uint32Val_p)
 {
+#ifdef AMI_NATIVE_ACCESS
+    AMI_STORE(pAddr_p, &uint32Val_p);
+#else
     ((UINT8 *) pAddr_p)[0] = ((UINT8 *) &uint32Val_p)[0];
     ((UINT8 *) pAddr_p)[1] = ((UINT8 *) &uint32Val_p)[1];
     ((UINT8 *) pAddr_p)[2] = ((UINT8 *) &uint32Val_p)[2];
     ((UINT8 *) pAddr_p)[3] = ((UINT8 *) &uint32Val_p)[3];
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -193,10 +220,15 @@ Sets a 32 bit value to a buffer in little endian
 /*----------------------------------------------------------------------------*/
 void ami_setUint32Le(void* pAddr_p, UINT32 uint32Val_p)
 {
+#ifdef AMI_NATIVE_ACCESS
+    uint32Val_p = AMI_SWAP32(uint32Val_p);
+    AMI_STORE(pAddr_p, &uint32Val_p);
+#else
     ((UINT8 *) pAddr_p)[3] = ((UINT8 *) &uint32Val_p)[0];
     ((UINT8 *) pAddr_p)[2] = ((UINT8 *) &uint32Val_p)[1];
     ((UINT8 *) pAddr_p)[1] = ((UINT8 *) &uint32Val_p)[2];
     ((UINT8 *) pAddr_p)[0] = ((UINT8 *) &uint32Val_p)[3];
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -215,10 +247,14 @@ UINT32 ami_getUint32Be(void* pAddr_p)
 {
     UINT32 val;
 
+#ifdef AMI_NATIVE_ACCESS
+    AMI_LOAD(&val, pAddr_p);
+#else
     ((UINT8 *) &val)[0] = ((UINT8 *) pAddr_p)[0];
     ((UINT8 *) &val)[1] = ((UINT8 *) pAddr_p)[1];
     ((UINT8 *) &val)[2] = ((UINT8 *) pAddr_p)[2];
     ((UINT8 *) &val)[3] = ((UINT8 *) pAddr_p)[3];
+#endif
 
     return val;
 }
@@ -239,10 +275,15 @@ UINT32 ami_getUint32Le(void* pAddr_p)
 {
     UINT32 val;
 
+#ifdef AMI_NATIVE_ACCESS
+    AMI_LOAD(&val, pAddr_p);
+    val = AMI_SWAP32(val);
+#else
     ((UINT8 *) &val)[3] = ((UINT8 *) pAddr_p)[0];
     ((UINT8 *) &val)[2] = ((UINT8 *) pAddr_p)[1];
     ((UINT8 *) &val)[1] = ((UINT8 *) pAddr_p)[2];
     ((UINT8 *) &val)[0] = ((UINT8 *) pAddr_p)[3];
+#endif
 
     return val;
 }
@@ -259,6 +300,9 @@ Sets a 64 bit value to a buffer in big endian
 /*----------------------------------------------------------------------------*/
 void ami_setUint64Be(void* pAddr_p, UINT64 uint64Val_p)
 {
+#ifdef AMI_NATIVE_ACCESS
+    AMI_STORE(pAddr_p, &uint64Val_p);
+#else
     ((UINT8 *) pAddr_p)[0] = ((UINT8 *) &uint64Val_p)[0];
     ((UINT8 *) pAddr_p)[1] = ((UINT8 *) &uint64Val_p)[1];
     ((UINT8 *) pAddr_p)[2] = ((UINT8 *) &uint64Val_p)[2];
@@ -267,6 +311,7 @@ void ami_setUint64Be(void* pAddr_p, UINT64 uint64Val_p)
     ((UINT8 *) pAddr_p)[5] = ((UINT8 *) &uint64Val_p)[5];
     ((UINT8 *) pAddr_p)[6] = ((UINT8 *) &uint64Val_p)[6];
     ((UINT8 *) pAddr_p)[7] = ((UINT8 *) &uint64Val_p)[7];
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -281,6 +326,10 @@ Sets a 64 bit value to a buffer in little endian
 /*----------------------------------------------------------------------------*/
 void ami_setUint64Le(void* pAddr_p, UINT64 uint64Val_p)
 {
+#ifdef AMI_NATIVE_ACCESS
+    uint64Val_p = AMI_SWAP64(uint64Val_p);
+    AMI_STORE(pAddr_p, &uint64Val_p);
+#else
     ((UINT8 *) pAddr_p)[7] = ((UINT8 *) &uint64Val_p)[0];
     ((UINT8 *) pAddr_p)[6] = ((UINT8 *) &uint64Val_p)[1];
     ((UINT8 *) pAddr_p)[5] = ((UINT8 *) &uint64Val_p)[2];
@@ -289,6 +338,7 @@ void ami_setUint64Le(void* pAddr_p, UINT64 uint64Val_p)
     ((UINT8 *) pAddr_p)[2] = ((UINT8 *) &uint64Val_p)[5];
     ((UINT8 *) pAddr_p)[1] = ((UINT8 *) &uint64Val_p)[6];
     ((UINT8 *) pAddr_p)[0] = ((UINT8 *) &uint64Val_p)[7];
+#endif
 }
 
 /*----------------------------------------------------------------------------*/
@@ -307,6 +357,9 @@ UINT64 ami_getUint64Be(void* pAddr_p)
 {
     UINT64 val;
 
+#ifdef AMI_NATIVE_ACCESS
+    AMI_LOAD(&val, pAddr_p);
+#else
     ((UINT8 *) &val)[0] = ((UINT8 *) pAddr_p)[0];
     ((UINT8 *) &val)[1] = ((UINT8 *) pAddr_p)[1];
     ((UINT8 *) &val)[2] = ((UINT8 *) pAddr_p)[2];
@@ -315,6 +368,7 @@ UINT64 ami_getUint64Be(void* pAddr_p)
     ((UINT8 *) &val)[5] = ((UINT8 *) pAddr_p)[5];
     ((UINT8 *) &val)[6] = ((UINT8 *) pAddr_p)[6];
     ((UINT8 *) &val)[7] = ((UINT8 *) pAddr_p)[7];
+#endif
 
     return val;
 }
@@ -335,6 +389,10 @@ UINT64 ami_getUint64Le(void* pAddr_p)
 {
     UINT64 val;
 
+#ifdef AMI_NATIVE_ACCESS
+    AMI_LOAD(&val, pAddr_p);
+    val = AMI_SWAP64(val);
+#else
     ((UINT8 *) &val)[7] = ((UINT8 *) pAddr_p)[0];
     ((UINT8 *) &val)[6] = ((UINT8 *) pAddr_p)[1];
     ((UINT8 *) &val)[5] = ((UINT8 *) pAddr_p)[2];
@@ -343,10 +401,171 @@ UINT64 ami_getUint64Le(void* pAddr_p)
     ((UINT8 *) &val)[2] = ((UINT8 *) pAddr_p)[5];
     ((UINT8 *) &val)[1] = ((UINT8 *) pAddr_p)[6];
     ((UINT8 *) &val)[0] = ((UINT8 *) pAddr_p)[7];
+#endif
 
     return val;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Set an Uint16 array to big endian
+
+Converts an array of 16 bit values to a buffer in big endian (e.g. a
+process image).
+
+\param[out] pAddr_p         Pointer to the destination buffer
+\param[in]  pVal_p          Pointer to the source values
+\param[in]  count_p         Number of values to convert
+*/
+/*----------------------------------------------------------------------------*/
+void ami_setUint16ArrayBe(void* pAddr_p, UINT16* pVal_p, UINT16 count_p)
+{
+    /* Same byte order -> Plain copy */
+    PSI_MEMCPY(pAddr_p, pVal_p, (UINT32)count_p * sizeof(UINT16));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get an Uint16 array from big endian
+
+Converts a buffer of 16 bit values in big endian (e.g. a process image)
+to an array in platform endian.
+
+\param[out] pVal_p          Pointer to the destination values
+\param[in]  pAddr_p         Pointer to the source buffer
+\param[in]  count_p         Number of values to convert
+*/
+/*----------------------------------------------------------------------------*/
+void ami_getUint16ArrayBe(UINT16* pVal_p, void* pAddr_p, UINT16 count_p)
+{
+    /* Same byte order -> Plain copy */
+    PSI_MEMCPY(pVal_p, pAddr_p, (UINT32)count_p * sizeof(UINT16));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Set an Uint16 array to little endian
+
+Converts an array of 16 bit values to a buffer in little endian (e.g. a
+process image).
+
+\param[out] pAddr_p         Pointer to the destination buffer
+\param[in]  pVal_p          Pointer to the source values
+\param[in]  count_p         Number of values to convert
+*/
+/*----------------------------------------------------------------------------*/
+void ami_setUint16ArrayLe(void* pAddr_p, UINT16* pVal_p, UINT16 count_p)
+{
+    UINT16 i;
+
+    for(i=0; i < count_p; i++)
+    {
+        ami_setUint16Le(&((UINT8 *) pAddr_p)[(UINT32)i * sizeof(UINT16)], pVal_p[i]);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get an Uint16 array from little endian
+
+Converts a buffer of 16 bit values in little endian (e.g. a process image)
+to an array in platform endian.
+
+\param[out] pVal_p          Pointer to the destination values
+\param[in]  pAddr_p         Pointer to the source buffer
+\param[in]  count_p         Number of values to convert
+*/
+/*----------------------------------------------------------------------------*/
+void ami_getUint16ArrayLe(UINT16* pVal_p, void* pAddr_p, UINT16 count_p)
+{
+    UINT16 i;
+
+    for(i=0; i < count_p; i++)
+    {
+        pVal_p[i] = ami_getUint16Le(&((UINT8 *) pAddr_p)[(UINT32)i * sizeof(UINT16)]);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Set an Uint32 array to big endian
+
+Converts an array of 32 bit values to a buffer in big endian (e.g. a
+process image).
+
+\param[out] pAddr_p         Pointer to the destination buffer
+\param[in]  pVal_p          Pointer to the source values
+\param[in]  count_p         Number of values to convert
+*/
+/*----------------------------------------------------------------------------*/
+void ami_setUint32ArrayBe(void* pAddr_p, UINT32* pVal_p, UINT16 count_p)
+{
+    /* Same byte order -> Plain copy */
+    PSI_MEMCPY(pAddr_p, pVal_p, (UINT32)count_p * sizeof(UINT32));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get an Uint32 array from big endian
+
+Converts a buffer of 32 bit values in big endian (e.g. a process image)
+to an array in platform endian.
+
+\param[out] pVal_p          Pointer to the destination values
+\param[in]  pAddr_p         Pointer to the source buffer
+\param[in]  count_p         Number of values to convert
+*/
+/*----------------------------------------------------------------------------*/
+void ami_getUint32ArrayBe(UINT32* pVal_p, void* pAddr_p, UINT16 count_p)
+{
+    /* Same byte order -> Plain copy */
+    PSI_MEMCPY(pVal_p, pAddr_p, (UINT32)count_p * sizeof(UINT32));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Set an Uint32 array to little endian
+
+Converts an array of 32 bit values to a buffer in little endian (e.g. a
+process image).
+
+\param[out] pAddr_p         Pointer to the destination buffer
+\param[in]  pVal_p          Pointer to the source values
+\param[in]  count_p         Number of values to convert
+*/
+/*----------------------------------------------------------------------------*/
+void ami_setUint32ArrayLe(void* pAddr_p, UINT32* pVal_p, UINT16 count_p)
+{
+    UINT16 i;
+
+    for(i=0; i < count_p; i++)
+    {
+        ami_setUint32Le(&((UINT8 *) pAddr_p)[(UINT32)i * sizeof(UINT32)], pVal_p[i]);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get an Uint32 array from little endian
+
+Converts a buffer of 32 bit values in little endian (e.g. a process image)
+to an array in platform endian.
+
+\param[out] pVal_p          Pointer to the destination values
+\param[in]  pAddr_p         Pointer to the source buffer
+\param[in]  count_p         Number of values to convert
+*/
+/*----------------------------------------------------------------------------*/
+void ami_getUint32ArrayLe(UINT32* pVal_p, void* pAddr_p, UINT16 count_p)
+{
+    UINT16 i;
+
+    for(i=0; i < count_p; i++)
+    {
+        pVal_p[i] = ami_getUint32Le(&((UINT8 *) pAddr_p)[(UINT32)i * sizeof(UINT32)]);
+    }
+}
+
 /*============================================================================*/
 /*            P R I V A T E   F U N C T I O N S                               */
 /*============================================================================*/
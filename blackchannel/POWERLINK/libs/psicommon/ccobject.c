@@ -80,6 +80,25 @@ during runtime.
 /* const defines                                                              */
 /*----------------------------------------------------------------------------*/
 
+/* Number of hash buckets (Power of two not smaller than the number of objects) */
+#if (CONF_CHAN_NUM_OBJECTS <= 4)
+  #define CCOBJECT_HASH_BUCKETS     4
+#elif (CONF_CHAN_NUM_OBJECTS <= 8)
+  #define CCOBJECT_HASH_BUCKETS     8
+#elif (CONF_CHAN_NUM_OBJECTS <= 16)
+  #define CCOBJECT_HASH_BUCKETS     16
+#elif (CONF_CHAN_NUM_OBJECTS <= 32)
+  #define CCOBJECT_HASH_BUCKETS     32
+#else
+  #define CCOBJECT_HASH_BUCKETS     64
+#endif
+
+#define CCOBJECT_HASH_SLOTS         (2 * CCOBJECT_HASH_BUCKETS)   /**< Number of slots in the hash table */
+#define CCOBJECT_HASH_SEED_COUNT    0xFF                          /**< Number of tried seeds per bucket */
+#define CCOBJECT_INVALID_ID         0xFF                          /**< Id of an empty hash slot */
+
+#define CCOBJECT_READ_RETRIES       8                             /**< Number of tries to get a consistent copy of an object */
+
 /*----------------------------------------------------------------------------*/
 /* local types                                                                */
 /*----------------------------------------------------------------------------*/
@@ -90,13 +109,33 @@ during runtime.
 
 The configuration channel instance holds the periodic object access information
 of the slim interface.
+
+The payload of the objects is protected by a sequence counter (seqlock). A
+writer increments the counter before and after changing the list, so the
+counter is odd while a write is in progress. A reader copies the object and
+retries if the counter was odd or has changed in the meantime. Therefore
+neither readers nor writers need to disable interrupts.
+
+The sequence counter only protects readers against one writer. All functions
+which write the object list therefore need to run in the same context and
+must not interrupt each other (AP: cc_process and cc_writeObject in the
+background, PCP: Object dictionary access callback and icc_process in the
+background).
 */
 typedef struct
 {
     tConfChanObject      objectList_m[CONF_CHAN_NUM_OBJECTS];  /**< List of all objects to transfer */
     UINT8                currReadObj_m;                        /**< Current object read pointer */
     UINT8                currWriteObj_m;                       /**< Current object write pointer */
-    tPsiCritSec          pfnCritSec_m;                         /**< Function pointer to the critical section */
+    tPsiCritSec          pfnCritSec_m;                         /**< Function pointer to the critical section (Only used during initialization) */
+    volatile UINT32      seqCount_m;                           /**< Sequence counter of the object payloads */
+    UINT8                objInit_m[CONF_CHAN_NUM_OBJECTS];     /**< TRUE when the object is initialized */
+    UINT8                hashSlot_m[CCOBJECT_HASH_SLOTS];      /**< Object id of each hash slot */
+    UINT8                hashSeed_m[CCOBJECT_HASH_BUCKETS];    /**< Slot hash seed of each bucket */
+    BOOL                 fHashValid_m;                         /**< TRUE when the hash table is usable */
+    volatile UINT8       objDirty_m[CONF_CHAN_NUM_OBJECTS];    /**< TRUE when the object changed since its last transfer */
+    UINT8                currDirtyObj_m;                       /**< Start of the next search for changed objects */
+    UINT16               refreshCount_m;                       /**< Cycles since the last refresh of an unchanged object */
 } tConfChanInstance;
 
 /*----------------------------------------------------------------------------*/
@@ -108,6 +147,15 @@ static tConfChanInstance          ccobjInstance_l;
 /*----------------------------------------------------------------------------*/
 /* local function prototypes                                                  */
 /*----------------------------------------------------------------------------*/
+static BOOL ccobject_getSizeCode(UINT8 objSize_p, UINT8* pSizeCode_p);
+static UINT8 ccobject_findObject(UINT16 objIdx_p, UINT8 objSubIdx_p);
+static void ccobject_buildHash(void);
+static BOOL ccobject_placeBucket(UINT8 bucket_p, UINT8 seed_p);
+static UINT32 ccobject_hashKey(UINT16 objIdx_p, UINT8 objSubIdx_p, UINT8 seed_p);
+static void ccobject_setPayload(tConfChanObject* pObjDest_p, UINT8* pData_p);
+static void ccobject_getPayload(tConfChanObject* pObjSrc_p, UINT8* pData_p);
+static void ccobject_beginWrite(void);
+static void ccobject_endWrite(void);
 
 
 /*============================================================================*/
@@ -163,14 +211,29 @@ void ccobject_exit(void)
 BOOL ccobject_initObject(UINT8 objId_p, tConfChanObject* pObjDef_p)
 {
     BOOL fReturn = FALSE;
+    UINT8 sizeCode;
 
     if(pObjDef_p != NULL)
     {
-        if(objId_p < CONF_CHAN_NUM_OBJECTS)
+        if(objId_p < CONF_CHAN_NUM_OBJECTS                                   &&
+           ccobject_getSizeCode(pObjDef_p->objSize_m, &sizeCode) != FALSE     )
         {
+            /* Enter critical section */
+            ccobjInstance_l.pfnCritSec_m(FALSE);
+
             /* Copy object to list */
             PSI_MEMCPY(&ccobjInstance_l.objectList_m[objId_p], pObjDef_p,
                     sizeof(tConfChanObject));
+            ccobjInstance_l.objInit_m[objId_p] = TRUE;
+
+            /* Transfer the initial value once */
+            ccobjInstance_l.objDirty_m[objId_p] = TRUE;
+
+            /* Update the lookup table */
+            ccobject_buildHash();
+
+            ccobjInstance_l.pfnCritSec_m(TRUE);
+            /* Leave critical section */
 
             fReturn = TRUE;
         }
@@ -183,6 +246,10 @@ BOOL ccobject_initObject(UINT8 objId_p, tConfChanObject* pObjDef_p)
 /**
 \brief   Write an object in the object list
 
+Must not be called in a context which can interrupt an other writer of the
+object list or be interrupted by one (See \ref tConfChanInstance). Readers
+can run in any context (See \ref ccobject_copyObject).
+
 \param[in] pObjDef_p        The object to write
 
 \retval  TRUE      Write to object successful
@@ -192,29 +259,25 @@ BOOL ccobject_initObject(UINT8 objId_p, tConfChanObject* pObjDef_p)
 BOOL ccobject_writeObject(tConfChanObject* pObjDef_p)
 {
     BOOL fReturn = FALSE;
-    UINT8 i;
+    UINT8 objId;
 
-    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    objId = ccobject_findObject(pObjDef_p->objIdx_m, pObjDef_p->objSubIdx_m);
+    if(objId != CCOBJECT_INVALID_ID                                                 &&
+       ccobjInstance_l.objectList_m[objId].objSize_m == pObjDef_p->objSize_m         )
     {
-        if(ccobjInstance_l.objectList_m[i].objIdx_m == pObjDef_p->objIdx_m        &&
-           ccobjInstance_l.objectList_m[i].objSubIdx_m == pObjDef_p->objSubIdx_m  &&
-           ccobjInstance_l.objectList_m[i].objSize_m == pObjDef_p->objSize_m        )
-        {
-            /* Enter critical section */
-            ccobjInstance_l.pfnCritSec_m(FALSE);
+        ccobject_beginWrite();
 
-            /* object found in list! Remember object data */
-            PSI_MEMCPY(&ccobjInstance_l.objectList_m[i].objPayloadLow_m,
-                    &pObjDef_p->objPayloadLow_m,
-                    pObjDef_p->objSize_m);
+        /* object found in list! Remember object data */
+        PSI_MEMCPY(&ccobjInstance_l.objectList_m[objId].objPayloadLow_m,
+                &pObjDef_p->objPayloadLow_m,
+                pObjDef_p->objSize_m);
 
-            ccobjInstance_l.pfnCritSec_m(TRUE);
-            /* Leave critical section */
+        ccobject_endWrite();
 
-            fReturn = TRUE;
+        /* Mark object for the next transfer */
+        ccobjInstance_l.objDirty_m[objId] = TRUE;
 
-            break;
-        }
+        fReturn = TRUE;
     }
 
     return fReturn;
@@ -242,54 +305,322 @@ tCcWriteState ccobject_writeCurrObject(UINT16 objIdx_p, UINT8 objSubIdx_p,
     if(pObjDest->objIdx_m == objIdx_p        &&
        pObjDest->objSubIdx_m == objSubIdx_p   )
     {
-        /* Enter critical section */
-        ccobjInstance_l.pfnCritSec_m(FALSE);
+        ccobject_beginWrite();
 
         /* object found in list -> Copy object data and convert endian! */
-        switch(pObjDest->objSize_m)
+        ccobject_setPayload(pObjDest, pData_p);
+        writeState = kCcWriteStateSuccessful;
+
+        ccobject_endWrite();
+    }
+    else
+    {
+        writeState = kCcWriteStateOutOfSync;
+    }
+
+    return writeState;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Write a batch of objects to the object list
+
+The batch consists of objCount_p entries of the form entry header followed
+by the little endian payload (See \ref tTbufCcStructure). All entries are
+checked before the object list is touched. The batch is then applied as one
+write of the sequence counter so the reader never sees half of an update.
+Like \ref ccobject_writeObject it needs to run in the context of the other
+writers of the object list.
+
+\param[in]  pData_p         Pointer to the first entry of the batch
+\param[in]  dataSize_p      Size of the batch data
+\param[in]  objCount_p      Number of entries in the batch
+\param[out] pObjIdList_p    List of the updated object ids (NULL: not needed)
+
+\retval  TRUE      All objects of the batch written
+\retval  FALSE     Invalid batch, no object is updated
+*/
+/*----------------------------------------------------------------------------*/
+BOOL ccobject_writeObjectBatch(UINT8* pData_p, UINT8 dataSize_p,
+        UINT8 objCount_p, UINT8* pObjIdList_p)
+{
+    BOOL fReturn = TRUE;
+    UINT8 offset = 0;
+    UINT8 objId;
+    UINT8 objSize;
+    UINT8 i;
+
+    /* Check all entries of the batch */
+    for(i=0; i < objCount_p; i++)
+    {
+        if(offset + CC_ENTRY_HEADER_SIZE > dataSize_p)
+        {
+            fReturn = FALSE;
+            break;
+        }
+
+        objId = CC_ENTRY_GET_ID(pData_p[offset]);
+        objSize = CC_ENTRY_GET_SIZE(pData_p[offset]);
+
+        if(objId >= CONF_CHAN_NUM_OBJECTS                                 ||
+           ccobjInstance_l.objectList_m[objId].objSize_m != objSize       ||
+           offset + CC_ENTRY_HEADER_SIZE + objSize > dataSize_p            )
         {
-            case sizeof(UINT8):
+            fReturn = FALSE;
+            break;
+        }
+
+        offset += CC_ENTRY_HEADER_SIZE + objSize;
+    }
+
+    if(fReturn != FALSE && objCount_p > 0)
+    {
+        ccobject_beginWrite();
+
+        offset = 0;
+        for(i=0; i < objCount_p; i++)
+        {
+            objId = CC_ENTRY_GET_ID(pData_p[offset]);
+
+            ccobject_setPayload(&ccobjInstance_l.objectList_m[objId],
+                    &pData_p[offset + CC_ENTRY_HEADER_SIZE]);
+
+            if(pObjIdList_p != NULL)
             {
-                pObjDest->objPayloadLow_m = ami_getUint8Le((UINT8 *)pData_p);
-                writeState = kCcWriteStateSuccessful;
-                break;
+                pObjIdList_p[i] = objId;
             }
-            case sizeof(UINT16):
+
+            offset += CC_ENTRY_HEADER_SIZE + CC_ENTRY_GET_SIZE(pData_p[offset]);
+        }
+
+        ccobject_endWrite();
+    }
+
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Pack one object of the object list into a batch entry
+
+\param[in]  objId_p         Id of the object to pack
+\param[out] pData_p         Destination of the entry
+\param[in]  dataSize_p      Free space at the destination
+
+\return UINT8
+\retval Size       Size of the packed entry
+\retval 0          Invalid object, not enough space left or object is written
+*/
+/*----------------------------------------------------------------------------*/
+UINT8 ccobject_packObject(UINT8 objId_p, UINT8* pData_p, UINT8 dataSize_p)
+{
+    UINT8 entrySize = 0;
+    UINT8 sizeCode;
+    tConfChanObject object;
+
+    if(ccobject_copyObject(objId_p, &object) != FALSE)
+    {
+        if(ccobject_getSizeCode(object.objSize_m, &sizeCode) != FALSE   &&
+           CC_ENTRY_HEADER_SIZE + object.objSize_m <= dataSize_p          )
+        {
+            pData_p[0] = CC_ENTRY_HEADER(objId_p, sizeCode);
+            ccobject_getPayload(&object, &pData_p[CC_ENTRY_HEADER_SIZE]);
+
+            entrySize = CC_ENTRY_HEADER_SIZE + object.objSize_m;
+        }
+    }
+
+    return entrySize;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Pack as many objects as fit into a batch
+
+Starts at the current object read pointer and steps the pointer over every
+packed object. Each object is packed at most once per batch.
+
+\param[out] pData_p         Destination of the batch
+\param[in]  dataSize_p      Size of the destination
+\param[out] pObjCount_p     Number of packed objects
+
+\return UINT8
+\retval Size       Number of used bytes at the destination
+*/
+/*----------------------------------------------------------------------------*/
+UINT8 ccobject_packCurrObjects(UINT8* pData_p, UINT8 dataSize_p,
+        UINT8* pObjCount_p)
+{
+    UINT8 offset = 0;
+    UINT8 objCount = 0;
+    UINT8 entrySize;
+
+    while(objCount < CONF_CHAN_NUM_OBJECTS)
+    {
+        entrySize = ccobject_packObject(ccobjInstance_l.currReadObj_m,
+                &pData_p[offset], dataSize_p - offset);
+        if(entrySize == 0)
+        {
+            /* Batch is full or object is currently written */
+            break;
+        }
+
+        offset += entrySize;
+        objCount++;
+
+        ccobject_incObjReadPointer();
+    }
+
+    *pObjCount_p = objCount;
+
+    return offset;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Pack the changed objects into a batch
+
+Only objects which were written since their last transfer are packed. The
+search starts behind the last packed object, so no object is starved when
+more objects changed than fit into one batch. Each packed object is marked
+as transferred. An object which is written at the same time stays marked and
+is packed with the next call.
+
+If CC_REFRESH_CYCLE_COUNT is not zero, every CC_REFRESH_CYCLE_COUNT calls
+the next object of the round robin is packed again even if it is unchanged.
+This slowly refreshes the whole list on the receiver side.
+
+\param[out] pData_p         Destination of the batch
+\param[in]  dataSize_p      Size of the destination
+\param[out] pObjCount_p     Number of packed objects
+
+\return UINT8
+\retval Size       Number of used bytes at the destination
+*/
+/*----------------------------------------------------------------------------*/
+UINT8 ccobject_packDirtyObjects(UINT8* pData_p, UINT8 dataSize_p,
+        UINT8* pObjCount_p)
+{
+    UINT8 offset = 0;
+    UINT8 objCount = 0;
+    UINT8 entrySize;
+    UINT8 objId;
+    UINT8 i;
+
+#if (CC_REFRESH_CYCLE_COUNT != 0)
+    ccobjInstance_l.refreshCount_m++;
+    if(ccobjInstance_l.refreshCount_m >= CC_REFRESH_CYCLE_COUNT)
+    {
+        ccobjInstance_l.refreshCount_m = 0;
+
+        /* Refresh the next object of the round robin */
+        if(ccobjInstance_l.objInit_m[ccobjInstance_l.currReadObj_m] != FALSE)
+        {
+            ccobjInstance_l.objDirty_m[ccobjInstance_l.currReadObj_m] = TRUE;
+        }
+
+        ccobject_incObjReadPointer();
+    }
+#endif
+
+    objId = ccobjInstance_l.currDirtyObj_m;
+    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    {
+        if(ccobjInstance_l.objDirty_m[objId] != FALSE)
+        {
+            if(CC_ENTRY_HEADER_SIZE + ccobjInstance_l.objectList_m[objId].objSize_m >
+                    dataSize_p - offset)
             {
-                pObjDest->objPayloadLow_m = ami_getUint16Le((UINT8 *)pData_p);
-                writeState = kCcWriteStateSuccessful;
+                /* Batch is full -> Continue with this object next time */
                 break;
             }
-            case sizeof(UINT32):
+
+            /* Clear the flag first, a concurrent write sets it again */
+            ccobjInstance_l.objDirty_m[objId] = FALSE;
+            PSI_MEMORY_BARRIER();
+
+            entrySize = ccobject_packObject(objId, &pData_p[offset],
+                    dataSize_p - offset);
+            if(entrySize == 0)
             {
-                pObjDest->objPayloadLow_m = ami_getUint32Le((UINT8 *)pData_p);
-                writeState = kCcWriteStateSuccessful;
-                break;
+                /* Object is currently written -> Retry with the next call */
+                ccobjInstance_l.objDirty_m[objId] = TRUE;
             }
-            default:
+            else
             {
-                /* Default use UINT64 */
-                pObjDest->objPayloadLow_m = ami_getUint32Le((UINT8 *)pData_p);
-                pObjDest->objPayloadHigh_m = ami_getUint32Le((UINT8 *)pData_p + 4);
-                writeState = kCcWriteStateSuccessful;
-                break;
+                offset += entrySize;
+                objCount++;
             }
         }
 
-        ccobjInstance_l.pfnCritSec_m(TRUE);
-        /* Leave critical section */
+        objId++;
+        if(objId >= CONF_CHAN_NUM_OBJECTS)
+        {
+            objId = 0;
+        }
     }
-    else
+
+    ccobjInstance_l.currDirtyObj_m = objId;
+
+    *pObjCount_p = objCount;
+
+    return offset;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief   Get a consistent copy of an object
+
+The object is copied without disabling interrupts. If the object list is
+written during the copy the copy is repeated. A reader which interrupts a
+writer can't wait for the write to finish, therefore the number of tries is
+limited.
+
+\param[in]  objId_p         Id of the object
+\param[out] pObject_p       Destination of the copy
+
+\retval TRUE     Consistent copy of the object
+\retval FALSE    Invalid object id or object is currently written
+*/
+/*----------------------------------------------------------------------------*/
+BOOL ccobject_copyObject(UINT8 objId_p, tConfChanObject* pObject_p)
+{
+    BOOL fReturn = FALSE;
+    UINT32 seqCount;
+    UINT8 i;
+
+    if(objId_p < CONF_CHAN_NUM_OBJECTS)
     {
-        writeState = kCcWriteStateOutOfSync;
+        for(i=0; i < CCOBJECT_READ_RETRIES; i++)
+        {
+            seqCount = ccobjInstance_l.seqCount_m;
+            if((seqCount & 0x1) == 0)
+            {
+                PSI_MEMORY_BARRIER();
+
+                PSI_MEMCPY(pObject_p, &ccobjInstance_l.objectList_m[objId_p],
+                        sizeof(tConfChanObject));
+
+                PSI_MEMORY_BARRIER();
+
+                if(ccobjInstance_l.seqCount_m == seqCount)
+                {
+                    fReturn = TRUE;
+                    break;
+                }
+            }
+        }
     }
 
-    return writeState;
+    return fReturn;
 }
 
 /*----------------------------------------------------------------------------*/
 /**
-\brief   Write an object in the object list
+\brief   Read an object from the object list
+
+The payload of the object may change while it is accessed by the returned
+pointer. Use \ref ccobject_copyObject to get a consistent copy.
 
 \param[in]  objIdx_p          The object index to read
 \param[in]  objSubIdx_p       The object subindex to read
@@ -301,17 +632,12 @@ tCcWriteState ccobject_writeCurrObject(UINT16 objIdx_p, UINT8 objSubIdx_p,
 tConfChanObject* ccobject_readObject(UINT16 objIdx_p, UINT8 objSubIdx_p)
 {
     tConfChanObject* pObjDef = NULL;
-    UINT8 i;
+    UINT8 objId;
 
-    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    objId = ccobject_findObject(objIdx_p, objSubIdx_p);
+    if(objId != CCOBJECT_INVALID_ID)
     {
-        if(ccobjInstance_l.objectList_m[i].objIdx_m == objIdx_p        &&
-           ccobjInstance_l.objectList_m[i].objSubIdx_m == objSubIdx_p   )
-        {
-            pObjDef = &ccobjInstance_l.objectList_m[i];
-
-            break;
-        }
+        pObjDef = &ccobjInstance_l.objectList_m[objId];
     }
 
     return pObjDef;
@@ -364,6 +690,56 @@ void ccobject_incObjWritePointer(void)
     }
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get an object by its id in the object list
+
+\param[in]  objId_p        Id of the object
+
+\retval  Address       Object read successful
+\retval  Null          Invalid object id
+*/
+/*----------------------------------------------------------------------------*/
+tConfChanObject* ccobject_readObjectById(UINT8 objId_p)
+{
+    tConfChanObject* pObject = NULL;
+
+    if(objId_p < CONF_CHAN_NUM_OBJECTS)
+    {
+        pObject = &ccobjInstance_l.objectList_m[objId_p];
+    }
+
+    return pObject;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get the id of an object in the object list
+
+\param[in] objIdx_p         Index of the object
+\param[in] objSubIdx_p      Subindex of the object
+\param[out] pObjId_p        The id of the object
+
+\retval TRUE     Object found in the list
+\retval FALSE    Object is not part of the list
+*/
+/*----------------------------------------------------------------------------*/
+BOOL ccobject_getObjectId(UINT16 objIdx_p, UINT8 objSubIdx_p, UINT8* pObjId_p)
+{
+    BOOL fReturn = FALSE;
+    UINT8 objId;
+
+    objId = ccobject_findObject(objIdx_p, objSubIdx_p);
+    if(objId != CCOBJECT_INVALID_ID)
+    {
+        *pObjId_p = objId;
+
+        fReturn = TRUE;
+    }
+
+    return fReturn;
+}
+
 /*----------------------------------------------------------------------------*/
 /**
 \brief    Get the size of an object
@@ -380,20 +756,15 @@ BOOL ccobject_getObjectSize(UINT16 objIdx_p, UINT8 objSubIdx_p,
         UINT8* pSize_p)
 {
     BOOL fReturn = FALSE;
-    UINT8 i;
+    UINT8 objId;
 
-    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    objId = ccobject_findObject(objIdx_p, objSubIdx_p);
+    if(objId != CCOBJECT_INVALID_ID)
     {
-        if(ccobjInstance_l.objectList_m[i].objIdx_m == objIdx_p        &&
-           ccobjInstance_l.objectList_m[i].objSubIdx_m == objSubIdx_p  )
-        {
-            /* object found in list! Remember object data */
-            *pSize_p = ccobjInstance_l.objectList_m[i].objSize_m;
+        /* object found in list! Remember object data */
+        *pSize_p = ccobjInstance_l.objectList_m[objId].objSize_m;
 
-            fReturn = TRUE;
-
-            break;
-        }
+        fReturn = TRUE;
     }
 
     return fReturn;
@@ -406,6 +777,354 @@ BOOL ccobject_getObjectSize(UINT16 objIdx_p, UINT8 objSubIdx_p,
 /** \name Private Functions */
 /** \{ */
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Find an object in the object list
+
+The lookup needs two hash calculations and one compare, independent of the
+number of objects. Only if the hash table couldn't be built (e.g. an object
+is configured twice) the list is searched linearly.
+
+\param[in] objIdx_p         Index of the object
+\param[in] objSubIdx_p      Subindex of the object
+
+\return UINT8
+\retval Id                     Id of the object in the list
+\retval CCOBJECT_INVALID_ID    Object not found
+*/
+/*----------------------------------------------------------------------------*/
+static UINT8 ccobject_findObject(UINT16 objIdx_p, UINT8 objSubIdx_p)
+{
+    UINT8 objId = CCOBJECT_INVALID_ID;
+    UINT8 bucket;
+    UINT8 slot;
+    UINT8 i;
+
+    if(ccobjInstance_l.fHashValid_m != FALSE)
+    {
+        bucket = (UINT8)(ccobject_hashKey(objIdx_p, objSubIdx_p, 0) & (CCOBJECT_HASH_BUCKETS - 1));
+        slot = (UINT8)(ccobject_hashKey(objIdx_p, objSubIdx_p,
+                ccobjInstance_l.hashSeed_m[bucket]) & (CCOBJECT_HASH_SLOTS - 1));
+
+        i = ccobjInstance_l.hashSlot_m[slot];
+        if(i != CCOBJECT_INVALID_ID                                   &&
+           ccobjInstance_l.objectList_m[i].objIdx_m == objIdx_p        &&
+           ccobjInstance_l.objectList_m[i].objSubIdx_m == objSubIdx_p   )
+        {
+            objId = i;
+        }
+    }
+    else
+    {
+        for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+        {
+            if(ccobjInstance_l.objInit_m[i] != FALSE                      &&
+               ccobjInstance_l.objectList_m[i].objIdx_m == objIdx_p        &&
+               ccobjInstance_l.objectList_m[i].objSubIdx_m == objSubIdx_p   )
+            {
+                objId = i;
+                break;
+            }
+        }
+    }
+
+    return objId;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Build the perfect hash table of the object list
+
+Every initialized object is assigned to a bucket by its index and subindex.
+For each bucket (largest first) a seed is searched which maps all of its
+objects to free slots of the table. The table is rebuilt whenever an object
+is initialized, so the costs are only paid during the startup.
+*/
+/*----------------------------------------------------------------------------*/
+static void ccobject_buildHash(void)
+{
+    UINT8 bucketSize[CCOBJECT_HASH_BUCKETS];
+    UINT8 maxSize = 0;
+    UINT8 size;
+    UINT8 bucket;
+    UINT8 seed;
+    UINT8 i;
+
+    PSI_MEMSET(&ccobjInstance_l.hashSlot_m[0], CCOBJECT_INVALID_ID,
+            sizeof(ccobjInstance_l.hashSlot_m));
+    PSI_MEMSET(&ccobjInstance_l.hashSeed_m[0], 0, sizeof(ccobjInstance_l.hashSeed_m));
+    PSI_MEMSET(&bucketSize[0], 0, sizeof(bucketSize));
+
+    ccobjInstance_l.fHashValid_m = TRUE;
+
+    /* Sort objects into buckets */
+    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    {
+        if(ccobjInstance_l.objInit_m[i] != FALSE)
+        {
+            bucket = (UINT8)(ccobject_hashKey(ccobjInstance_l.objectList_m[i].objIdx_m,
+                    ccobjInstance_l.objectList_m[i].objSubIdx_m, 0) & (CCOBJECT_HASH_BUCKETS - 1));
+
+            bucketSize[bucket]++;
+            if(bucketSize[bucket] > maxSize)
+            {
+                maxSize = bucketSize[bucket];
+            }
+        }
+    }
+
+    /* Place the buckets with the most objects first */
+    for(size = maxSize; size > 0 && ccobjInstance_l.fHashValid_m != FALSE; size--)
+    {
+        for(bucket=0; bucket < CCOBJECT_HASH_BUCKETS; bucket++)
+        {
+            if(bucketSize[bucket] == size)
+            {
+                for(seed=1; seed < CCOBJECT_HASH_SEED_COUNT; seed++)
+                {
+                    if(ccobject_placeBucket(bucket, seed) != FALSE)
+                    {
+                        ccobjInstance_l.hashSeed_m[bucket] = seed;
+                        break;
+                    }
+                }
+
+                if(seed == CCOBJECT_HASH_SEED_COUNT)
+                {
+                    /* No seed found -> Fall back to the linear search */
+                    ccobjInstance_l.fHashValid_m = FALSE;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Try to place all objects of a bucket into the hash table
+
+\param[in] bucket_p         The bucket to place
+\param[in] seed_p           The seed to calculate the slots
+
+\retval TRUE     All objects placed in free slots
+\retval FALSE    Slot collision, the table is left unchanged
+*/
+/*----------------------------------------------------------------------------*/
+static BOOL ccobject_placeBucket(UINT8 bucket_p, UINT8 seed_p)
+{
+    BOOL fReturn = TRUE;
+    tConfChanObject* pObject;
+    UINT8 slot;
+    UINT8 i;
+    UINT8 j;
+
+    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    {
+        pObject = &ccobjInstance_l.objectList_m[i];
+
+        if(ccobjInstance_l.objInit_m[i] != FALSE                                      &&
+           (ccobject_hashKey(pObject->objIdx_m, pObject->objSubIdx_m, 0) &
+                   (CCOBJECT_HASH_BUCKETS - 1)) == bucket_p                            )
+        {
+            slot = (UINT8)(ccobject_hashKey(pObject->objIdx_m, pObject->objSubIdx_m,
+                    seed_p) & (CCOBJECT_HASH_SLOTS - 1));
+
+            if(ccobjInstance_l.hashSlot_m[slot] != CCOBJECT_INVALID_ID)
+            {
+                fReturn = FALSE;
+                break;
+            }
+
+            ccobjInstance_l.hashSlot_m[slot] = i;
+        }
+    }
+
+    if(fReturn == FALSE)
+    {
+        /* Remove the already placed objects of this bucket */
+        for(j=0; j < i; j++)
+        {
+            pObject = &ccobjInstance_l.objectList_m[j];
+
+            if(ccobjInstance_l.objInit_m[j] != FALSE                                  &&
+               (ccobject_hashKey(pObject->objIdx_m, pObject->objSubIdx_m, 0) &
+                       (CCOBJECT_HASH_BUCKETS - 1)) == bucket_p                        )
+            {
+                slot = (UINT8)(ccobject_hashKey(pObject->objIdx_m, pObject->objSubIdx_m,
+                        seed_p) & (CCOBJECT_HASH_SLOTS - 1));
+
+                ccobjInstance_l.hashSlot_m[slot] = CCOBJECT_INVALID_ID;
+            }
+        }
+    }
+
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Calculate the hash of an object
+
+\param[in] objIdx_p         Index of the object
+\param[in] objSubIdx_p      Subindex of the object
+\param[in] seed_p           Seed of the hash (0: bucket hash)
+
+\return UINT32 The hash value
+*/
+/*----------------------------------------------------------------------------*/
+static UINT32 ccobject_hashKey(UINT16 objIdx_p, UINT8 objSubIdx_p, UINT8 seed_p)
+{
+    UINT32 hash;
+
+    hash = (((UINT32)objIdx_p << 8) | objSubIdx_p) ^ ((UINT32)seed_p * 0x9E3779B9U);
+    hash *= 0x85EBCA6BU;
+    hash ^= hash >> 15;
+
+    return hash;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Start a write of the object list
+
+Makes the sequence counter odd. Readers which start from now on retry until
+\ref ccobject_endWrite is called. The increment is not atomic, therefore a
+second writer must not start a write in between (See \ref tConfChanInstance).
+*/
+/*----------------------------------------------------------------------------*/
+static void ccobject_beginWrite(void)
+{
+    ccobjInstance_l.seqCount_m++;
+    PSI_MEMORY_BARRIER();
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Finish a write of the object list
+
+Makes the sequence counter even again. Readers which copied an object during
+the write detect the changed counter. Must be called in the same context as
+the matching \ref ccobject_beginWrite.
+*/
+/*----------------------------------------------------------------------------*/
+static void ccobject_endWrite(void)
+{
+    PSI_MEMORY_BARRIER();
+    ccobjInstance_l.seqCount_m++;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get the entry header size code of an object size
+
+\param[in]  objSize_p       Size of the object
+\param[out] pSizeCode_p     Resulting size code
+
+\retval TRUE     Object size is valid
+\retval FALSE    Object size can't be transferred
+*/
+/*----------------------------------------------------------------------------*/
+static BOOL ccobject_getSizeCode(UINT8 objSize_p, UINT8* pSizeCode_p)
+{
+    BOOL fReturn = TRUE;
+
+    switch(objSize_p)
+    {
+        case sizeof(UINT8):
+            *pSizeCode_p = 0;
+            break;
+        case sizeof(UINT16):
+            *pSizeCode_p = 1;
+            break;
+        case sizeof(UINT32):
+            *pSizeCode_p = 2;
+            break;
+        case sizeof(UINT64):
+            *pSizeCode_p = 3;
+            break;
+        default:
+            fReturn = FALSE;
+            break;
+    }
+
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Copy little endian payload to an object
+
+\param[out] pObjDest_p     The destination object
+\param[in]  pData_p        The little endian payload
+*/
+/*----------------------------------------------------------------------------*/
+static void ccobject_setPayload(tConfChanObject* pObjDest_p, UINT8* pData_p)
+{
+    switch(pObjDest_p->objSize_m)
+    {
+        case sizeof(UINT8):
+        {
+            pObjDest_p->objPayloadLow_m = ami_getUint8Le(pData_p);
+            break;
+        }
+        case sizeof(UINT16):
+        {
+            pObjDest_p->objPayloadLow_m = ami_getUint16Le(pData_p);
+            break;
+        }
+        case sizeof(UINT32):
+        {
+            pObjDest_p->objPayloadLow_m = ami_getUint32Le(pData_p);
+            break;
+        }
+        default:
+        {
+            /* Default use UINT64 */
+            pObjDest_p->objPayloadLow_m = ami_getUint32Le(pData_p);
+            pObjDest_p->objPayloadHigh_m = ami_getUint32Le(pData_p + 4);
+            break;
+        }
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Copy the payload of an object in little endian order
+
+\param[in]  pObjSrc_p      The source object
+\param[out] pData_p        Destination of the payload
+*/
+/*----------------------------------------------------------------------------*/
+static void ccobject_getPayload(tConfChanObject* pObjSrc_p, UINT8* pData_p)
+{
+    switch(pObjSrc_p->objSize_m)
+    {
+        case sizeof(UINT8):
+        {
+            ami_setUint8Le(pData_p, (UINT8)pObjSrc_p->objPayloadLow_m);
+            break;
+        }
+        case sizeof(UINT16):
+        {
+            ami_setUint16Le(pData_p, (UINT16)pObjSrc_p->objPayloadLow_m);
+            break;
+        }
+        case sizeof(UINT32):
+        {
+            ami_setUint32Le(pData_p, pObjSrc_p->objPayloadLow_m);
+            break;
+        }
+        default:
+        {
+            /* Default use UINT64 */
+            ami_setUint32Le(pData_p, pObjSrc_p->objPayloadLow_m);
+            ami_setUint32Le(pData_p + 4, pObjSrc_p->objPayloadHigh_m);
+            break;
+        }
+    }
+}
+
 
 /**
  * \}
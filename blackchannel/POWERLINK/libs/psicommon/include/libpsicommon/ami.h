@@ -85,6 +85,17 @@ DLLEXPORT void ami_setUint64Le(void* pAddr_p, UINT64 uint64Val_p);
 DLLEXPORT UINT64 ami_getUint64Be(void* pAddr_p);
 DLLEXPORT UINT64 ami_getUint64Le(void* pAddr_p);
 
+/* Conversion functions for arrays (e.g. process images) */
+DLLEXPORT void ami_setUint16ArrayBe(void* pAddr_p, UINT16* pVal_p, UINT16 count_p);
+DLLEXPORT void ami_getUint16ArrayBe(UINT16* pVal_p, void* pAddr_p, UINT16 count_p);
+DLLEXPORT void ami_setUint16ArrayLe(void* pAddr_p, UINT16* pVal_p, UINT16 count_p);
+DLLEXPORT void ami_getUint16ArrayLe(UINT16* pVal_p, void* pAddr_p, UINT16 count_p);
+
+DLLEXPORT void ami_setUint32ArrayBe(void* pAddr_p, UINT32* pVal_p, UINT16 count_p);
+DLLEXPORT void ami_getUint32ArrayBe(UINT32* pVal_p, void* pAddr_p, UINT16 count_p);
+DLLEXPORT void ami_setUint32ArrayLe(void* pAddr_p, UINT32* pVal_p, UINT16 count_p);
+DLLEXPORT void ami_getUint32ArrayLe(UINT32* pVal_p, void* pAddr_p, UINT16 count_p);
+
 #ifdef __cplusplus
     }
 #endif
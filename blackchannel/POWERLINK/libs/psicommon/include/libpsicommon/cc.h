@@ -49,12 +49,17 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* typedef                                                                    */
 /*----------------------------------------------------------------------------*/
 
+/**
+ * \brief Triple buffer layout of the configuration channel
+ *
+ * One buffer carries a batch of objCount_m objects. Every object in objData_m
+ * starts with a one byte entry header (\ref CC_ENTRY_HEADER) followed by the
+ * object payload in little endian byte order.
+ */
 typedef struct {
     UINT8 seqNr_m;
-    UINT8 objSubIdx_m;
-    UINT16 objIdx_m;
-    UINT32 objPayloadLow_m;
-    UINT32 objPayloadHigh_m;
+    UINT8 objCount_m;
+    UINT8 objData_m[10];
 } PACK_STRUCT tTbufCcStructure;
 
 /*----------------------------------------------------------------------------*/
@@ -62,10 +67,28 @@ typedef struct {
 /*----------------------------------------------------------------------------*/
 
 #define TBUF_SEQNR_OFF          offsetof(tTbufCcStructure, seqNr_m)
-#define TBUF_OBJSUBIDX_OFF      offsetof(tTbufCcStructure, objSubIdx_m)
-#define TBUF_OBJIDX_OFF         offsetof(tTbufCcStructure, objIdx_m)
-#define TBUF_PAYLOADLOW_OFF     offsetof(tTbufCcStructure, objPayloadLow_m)
-#define TBUF_PAYLOADHIGH_OFF    offsetof(tTbufCcStructure, objPayloadHigh_m)
+#define TBUF_OBJCOUNT_OFF       offsetof(tTbufCcStructure, objCount_m)
+#define TBUF_OBJDATA_OFF        offsetof(tTbufCcStructure, objData_m)
+
+#define CC_OBJDATA_SIZE         sizeof(((tTbufCcStructure *)0)->objData_m)   /**< Size of the object batch area */
+
+#define CC_ENTRY_HEADER_SIZE    1           /**< Size of the header in front of each object */
+#define CC_ENTRY_ID_MASK        0x3F        /**< Object id field of the entry header */
+#define CC_ENTRY_SIZE_SHIFT     6           /**< Position of the size code in the entry header */
+#define CC_ENTRY_MAX_OBJECTS    (CC_ENTRY_ID_MASK + 1)   /**< Maximum number of addressable objects */
+#define CC_MAX_BATCH_OBJECTS    (CC_OBJDATA_SIZE / (CC_ENTRY_HEADER_SIZE + 1))  /**< Maximum number of objects in one buffer */
+
+/**
+ * \brief Assemble an entry header from the object id and the size code
+ *
+ * The size code is the binary logarithm of the object size (0: UINT8 ..
+ * 3: UINT64).
+ */
+#define CC_ENTRY_HEADER(objId, sizeCode)    \
+    ((UINT8)((((sizeCode) & 0x03) << CC_ENTRY_SIZE_SHIFT) | ((objId) & CC_ENTRY_ID_MASK)))
+
+#define CC_ENTRY_GET_ID(header)         ((UINT8)((header) & CC_ENTRY_ID_MASK))
+#define CC_ENTRY_GET_SIZE(header)       ((UINT8)(1 << (((header) >> CC_ENTRY_SIZE_SHIFT) & 0x03)))
 
 /*----------------------------------------------------------------------------*/
 /* function prototypes                                                        */
@@ -43,6 +43,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*----------------------------------------------------------------------------*/
 
 #include <libpsicommon/global.h>
+#include <libpsicommon/cc.h>
 
 #include <config/ccobjectlist.h>
 
@@ -50,6 +51,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /* const defines                                                              */
 /*----------------------------------------------------------------------------*/
 
+/* Detect configuration errors */
+#if (CONF_CHAN_NUM_OBJECTS > CC_ENTRY_MAX_OBJECTS)
+#error "CONF_CHAN_NUM_OBJECTS exceeds the number of addressable configuration channel objects"
+#endif
+
+#if (CC_REFRESH_CYCLE_COUNT > 0xFFFF)
+#error "CC_REFRESH_CYCLE_COUNT needs to be between 0 and 65535"
+#endif
 
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
@@ -73,10 +82,20 @@ DLLEXPORT BOOL ccobject_initObject(UINT8 objId_p, tConfChanObject* pObjDef_p);
 DLLEXPORT BOOL ccobject_writeObject(tConfChanObject* objDef_p);
 DLLEXPORT tCcWriteState ccobject_writeCurrObject(UINT16 objIdx_p, UINT8 objSubIdx_p,
         UINT8* pData_p);
+DLLEXPORT BOOL ccobject_writeObjectBatch(UINT8* pData_p, UINT8 dataSize_p,
+        UINT8 objCount_p, UINT8* pObjIdList_p);
+DLLEXPORT UINT8 ccobject_packObject(UINT8 objId_p, UINT8* pData_p, UINT8 dataSize_p);
+DLLEXPORT UINT8 ccobject_packCurrObjects(UINT8* pData_p, UINT8 dataSize_p,
+        UINT8* pObjCount_p);
+DLLEXPORT UINT8 ccobject_packDirtyObjects(UINT8* pData_p, UINT8 dataSize_p,
+        UINT8* pObjCount_p);
 DLLEXPORT tConfChanObject* ccobject_readObject(UINT16 objIdx_p, UINT8 objSubIdx_p);
 DLLEXPORT tConfChanObject* ccobject_readCurrObject(void);
 DLLEXPORT void ccobject_incObjReadPointer(void);
 DLLEXPORT void ccobject_incObjWritePointer(void);
+DLLEXPORT tConfChanObject* ccobject_readObjectById(UINT8 objId_p);
+DLLEXPORT BOOL ccobject_copyObject(UINT8 objId_p, tConfChanObject* pObject_p);
+DLLEXPORT BOOL ccobject_getObjectId(UINT16 objIdx_p, UINT8 objSubIdx_p, UINT8* pObjId_p);
 DLLEXPORT BOOL ccobject_getObjectSize(UINT16 objIdx_p, UINT8 objSubIdx_p,
         UINT8* pSize_p);
 
@@ -175,6 +175,7 @@ typedef enum {
     kPsiProcessSyncFailed           = 0x06,
     kPsiProcessAsyncFailed          = 0x07,
     kPsiInvalidHandle               = 0x08,
+    kPsiErrorRingOverflow           = 0x09,
 
     kPsiMainPlkStackInitError       = 0x12,
     kPsiMainPlkStackStartError      = 0x13,
@@ -222,6 +223,8 @@ typedef enum {
     kPsiStreamNoFreeElementFound    = 0x84,
     kPsiStreamProcessActionFailed   = 0x85,
     kPsiStreamSyncError             = 0x86,
+    kPsiStreamTransferTimeout       = 0x87,
+    kPsiStreamTransferStateError    = 0x88,
 
     kPsiSsdoInitError               = 0x90,
     kPsiSsdoInvalidParameter        = 0x91,
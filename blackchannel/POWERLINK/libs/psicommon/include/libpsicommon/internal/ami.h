@@ -0,0 +1,93 @@
+/**
+********************************************************************************
+\file   libpsicommon/internal/ami.h
+
+\brief  Internal header file of the Abstract Memory Interface
+
+This header detects at compile time if the host is able to access unaligned
+addresses. In this case the AMI implementations use single native loads and
+stores and swap the byte order with the compiler builtins. Otherwise the
+portable bytewise copy is used.
+
+Define AMI_FORCE_BYTEWISE to always use the bytewise copy.
+
+*******************************************************************************/
+
+
+/*------------------------------------------------------------------------------
+Copyright (c) 2013, Bernecker+Rainer Industrie-Elektronik Ges.m.b.H. (B&R)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#ifndef _INC_psicommon_int_ami_H_
+#define _INC_psicommon_int_ami_H_
+
+/*----------------------------------------------------------------------------*/
+/* includes                                                                   */
+/*----------------------------------------------------------------------------*/
+
+#include <libpsicommon/ami.h>
+#include <libpsicommon/byteorder.h>
+
+/*----------------------------------------------------------------------------*/
+/* const defines                                                              */
+/*----------------------------------------------------------------------------*/
+
+/* Detect hosts with unaligned load and store (x86, ARMv7-M like Cortex-M3/M4) */
+#if !defined(AMI_FORCE_BYTEWISE)
+  #if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64) || \
+      defined(__ARM_FEATURE_UNALIGNED)
+    #define AMI_NATIVE_ACCESS
+  #endif
+#endif
+
+/* Byte swap of the native access */
+#if defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8)))
+  #define AMI_SWAP16(val_p)     __builtin_bswap16(val_p)
+  #define AMI_SWAP32(val_p)     __builtin_bswap32(val_p)
+  #define AMI_SWAP64(val_p)     __builtin_bswap64(val_p)
+#else
+  #define AMI_SWAP16(val_p)     ((UINT16)((((UINT16)(val_p)) << 8) | (((UINT16)(val_p)) >> 8)))
+  #define AMI_SWAP32(val_p)     ((((UINT32)(val_p)) << 24)                  | \
+                                 ((((UINT32)(val_p)) << 8) & 0x00FF0000UL)  | \
+                                 ((((UINT32)(val_p)) >> 8) & 0x0000FF00UL)  | \
+                                 (((UINT32)(val_p)) >> 24))
+  #define AMI_SWAP64(val_p)     ((((UINT64)AMI_SWAP32((UINT32)(val_p))) << 32) | \
+                                 ((UINT64)AMI_SWAP32((UINT32)(((UINT64)(val_p)) >> 32))))
+#endif
+
+/* Native load and store (A fixed size copy is translated to a single access) */
+#define AMI_LOAD(pVal_p, pAddr_p)       PSI_MEMCPY((pVal_p), (pAddr_p), sizeof(*(pVal_p)))
+#define AMI_STORE(pAddr_p, pVal_p)      PSI_MEMCPY((pAddr_p), (pVal_p), sizeof(*(pVal_p)))
+
+/*----------------------------------------------------------------------------*/
+/* typedef                                                                    */
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/* function prototypes                                                        */
+/*----------------------------------------------------------------------------*/
+
+#endif /* _INC_psicommon_int_ami_H_ */
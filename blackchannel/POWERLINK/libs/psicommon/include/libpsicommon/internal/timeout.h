@@ -4,8 +4,8 @@
 
 \brief  Internal header file timeout generation
 
-This module generates a timeout for asynchronous transmissions by simply counting
-the synchronous interrupts. If a limit is reached the timeout is generated.
+This module generates a timeout for asynchronous transmissions by counting
+the synchronous cycles in a hierarchical timing wheel.
 
 *******************************************************************************/
 
@@ -50,6 +50,23 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*----------------------------------------------------------------------------*/
 
 #define TIMEOUT_MAX_INSTANCES       5       /**< Maximum number of timeout module instances */
+#define TIMEOUT_MIN_CYCLE_LIMIT     4       /**< Lowest cycle limit selectable with timeout_setMinCycleLimit() */
+
+#define TIMEOUT_WHEEL_BITS          4       /**< Number of cycle counter bits resolved by one level of the timing wheel */
+#define TIMEOUT_WHEEL_LEVELS        5       /**< Number of timing wheel levels (Wheel covers 2^(BITS*LEVELS) cycles) */
+
+/* Detect configuration errors */
+#if (TIMEOUT_MAX_INSTANCES > 32)
+#error "TIMEOUT_MAX_INSTANCES needs to be lower or equal 32"
+#endif
+
+#if ((TIMEOUT_WHEEL_BITS * TIMEOUT_WHEEL_LEVELS) <= 16) || ((TIMEOUT_WHEEL_BITS * TIMEOUT_WHEEL_LEVELS) > 24)
+#error "The timing wheel needs to cover more than the UINT16 cycle limit and less than 2^24 cycles"
+#endif
+
+#if ((TIMEOUT_WHEEL_LEVELS << TIMEOUT_WHEEL_BITS) > 255)
+#error "The timing wheel needs to have less than 255 slots"
+#endif
 
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
@@ -60,10 +77,24 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 struct eTimeoutInstance
 {
-    UINT8     fInstUsed_m;              /**< Instance is already allocated */
-    UINT8     fTimeoutEn_m;             /**< Transmit timeout enabled */
-    UINT16    timeoutCycleCount_m;      /**< Async transmit cycle count */
-    UINT16    cycleLimit_m;             /**< Limit of cycles to count */
+    UINT8               fInstUsed_m;        /**< Instance is already allocated */
+    volatile UINT8      fTimeoutEn_m;       /**< Transmit timeout enabled */
+    volatile UINT8      fExpired_m;         /**< Timer expired in the timing wheel */
+    volatile UINT8      generation_m;       /**< Incremented on each start and stop of the timer */
+    UINT8               wheelGen_m;         /**< Generation of the timer entry in the wheel */
+    UINT8               slot_m;             /**< Wheel slot of the timer (Slot + 1, 0: not in the wheel) */
+    UINT8               next_m;             /**< Next timer in the slot (Index + 1, 0: none) */
+    UINT8               prev_m;             /**< Previous timer in the slot (Index + 1, 0: none) */
+    volatile UINT32     startTick_m;        /**< Wheel cycle the timer was started in */
+    UINT32              expireTick_m;       /**< Wheel cycle the timer expires in */
+    UINT16              cycleLimit_m;       /**< Limit of cycles to count */
+    UINT16              maxCycleLimit_m;    /**< Upper bound of the cycle limit (Limit passed to timeout_create()) */
+    UINT16              minCycleLimit_m;    /**< Lower bound of the round trip time based cycle limit */
+    UINT8               fRetried_m;         /**< Transmission was retried or timed out -> No round trip time sample */
+    UINT32              srtt_m;             /**< Smoothed round trip time in cycles (Scaled by 8) */
+    UINT32              rttVar_m;           /**< Round trip time variation in cycles (Scaled by 4) */
+    tTimeoutExpireCb    pfnExpireCb_m;      /**< Called by timeout_processSync() on expiry */
+    void*               pCbArg_m;           /**< Argument of the expiry callback */
 };
 
 /*----------------------------------------------------------------------------*/
@@ -48,6 +48,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 /*----------------------------------------------------------------------------*/
 #define LOG_CHANNEL_SIZE   0x0C        /**< Size of the logger channel */
 
+#define LOG_BATCH_FLAG              0x80    /**< First data byte of a transfer with several compact entries */
+#define LOG_BATCH_COUNT_MASK        0x7F    /**< Number of entries in the batch header */
+
+#define LOG_COMPACT_LEVEL_SHIFT     6       /**< Position of the error level in a compact entry */
+#define LOG_COMPACT_SOURCE_MASK     0x3F    /**< Maximum error source of a compact entry */
+#define LOG_COMPACT_VALUE_MAX       0xFFFF  /**< Maximum error code and additional info of a compact entry */
+
 /*----------------------------------------------------------------------------*/
 /* typedef                                                                    */
 /*----------------------------------------------------------------------------*/
@@ -75,6 +82,31 @@ typedef struct
     UINT32 addInfo_m;       /**< Additional info of this error */
 } PACK_STRUCT tLogFormat;
 
+/**
+ * \brief Compact format of a logbook entry inside of a batch
+ */
+typedef struct
+{
+    UINT8 levelSource_m;    /**< The error level (Bit 6-7) and the source (Bit 0-5) */
+    UINT16 code_m;          /**< The error code */
+    UINT16 addInfo_m;       /**< Additional info of this error */
+} PACK_STRUCT tLogCompactFormat;
+
+/** Number of compact entries which fit into one logbook transfer */
+#define LOG_BATCH_MAX_ENTRIES   ((sizeof(tLogFormat) - 1) / sizeof(tLogCompactFormat))
+
+/**
+ * \brief Several compact logbook entries sent in one transfer
+ *
+ * The header byte is distinguished from the error level of a single
+ * \ref tLogFormat entry by the LOG_BATCH_FLAG.
+ */
+typedef struct
+{
+    UINT8 header_m;                                     /**< LOG_BATCH_FLAG and number of entries */
+    tLogCompactFormat entry_m[LOG_BATCH_MAX_ENTRIES];   /**< The compact entries */
+} PACK_STRUCT tLogBatchFormat;
+
 /**
  * \brief Memory layout of the logbook channel
  */
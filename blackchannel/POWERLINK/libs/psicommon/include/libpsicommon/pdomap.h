@@ -0,0 +1,158 @@
+/**
+********************************************************************************
+\file   libpsicommon/pdomap.h
+
+\brief  Generator macros for the mapped PDO objects
+
+The mapped objects of the PDO images are listed once in the tbuf configuration
+headers (RPDO_MAPPED_OBJ_LIST and TPDO_MAPPED_OBJ_LIST). Each list entry has the
+form:
+
+    OBJ(member, Name, objIdx, objSubIdx, type, count)
+
+The macros of this header generate from these lists the packed structure of
+the image, the object count, the object linking list of the PCP and typed
+accessor functions for the application and the PCP. The images are little
+endian. On little endian targets the accessors reduce to plain loads and
+stores of the structure members.
+
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+Copyright (c) 2013, Bernecker+Rainer Industrie-Elektronik Ges.m.b.H. (B&R)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#ifndef _INC_libpsicommon_pdomap_H_
+#define _INC_libpsicommon_pdomap_H_
+
+/*----------------------------------------------------------------------------*/
+/* includes                                                                   */
+/*----------------------------------------------------------------------------*/
+
+#include <stddef.h>
+
+#include <libpsicommon/global.h>
+#include <libpsicommon/byteorder.h>
+
+#ifdef AMI_HOST_BIG_ENDIAN
+  /* Accessors of the big endian path convert the image byte order */
+  #ifdef PSI_BUILD_PCP
+    #include <common/ami.h>
+  #else
+    #include <libpsicommon/ami.h>
+  #endif
+#endif
+
+/*----------------------------------------------------------------------------*/
+/* const defines                                                              */
+/*----------------------------------------------------------------------------*/
+
+/* Generate the structure member of one object */
+#define PDOMAP_MEMBER(member_p, name_p, idx_p, subIdx_p, type_p, count_p) \
+    type_p member_p[count_p];
+
+/* Count the objects of a list: (0 LIST(PDOMAP_COUNT)) */
+#define PDOMAP_COUNT(member_p, name_p, idx_p, subIdx_p, type_p, count_p) \
+    + 1
+
+/* Sum up the size of the objects of a list: (0 LIST(PDOMAP_SIZE)) */
+#define PDOMAP_SIZE(member_p, name_p, idx_p, subIdx_p, type_p, count_p) \
+    + (sizeof(type_p) * (count_p))
+
+/* Generate one element of the object linking list */
+#define PDOMAP_LINK(objType_p, member_p, idx_p, subIdx_p, type_p, count_p) \
+    { (idx_p), (subIdx_p), offsetof(objType_p, member_p), (sizeof(type_p) * (count_p)) },
+
+/* Fail to compile if the generated structure is not packed */
+#define PDOMAP_CHECK_SIZE(objType_p, size_p) \
+    typedef char objType_p##SizeCheck[(sizeof(objType_p) == (size_p)) ? 1 : -1];
+
+#ifdef AMI_HOST_BIG_ENDIAN
+  /* Convert from and to the little endian image (The size is resolved at compile time) */
+  #define PDOMAP_LOAD(type_p, obj_p)                                              \
+      ((type_p)((sizeof(type_p) == 1) ? ami_getUint8Le((void *)&(obj_p))  :      \
+                (sizeof(type_p) == 2) ? ami_getUint16Le((void *)&(obj_p)) :      \
+                (sizeof(type_p) == 4) ? ami_getUint32Le((void *)&(obj_p)) :      \
+                                        ami_getUint64Le((void *)&(obj_p))))
+  #define PDOMAP_STORE(type_p, obj_p, val_p)                                      \
+      do {                                                                        \
+          if(sizeof(type_p) == 1)                                                 \
+          {                                                                       \
+              ami_setUint8Le((void *)&(obj_p), (UINT8)(val_p));                   \
+          }                                                                       \
+          else if(sizeof(type_p) == 2)                                            \
+          {                                                                       \
+              ami_setUint16Le((void *)&(obj_p), (UINT16)(val_p));                 \
+          }                                                                       \
+          else if(sizeof(type_p) == 4)                                            \
+          {                                                                       \
+              ami_setUint32Le((void *)&(obj_p), (UINT32)(val_p));                 \
+          }                                                                       \
+          else                                                                    \
+          {                                                                       \
+              ami_setUint64Le((void *)&(obj_p), (UINT64)(val_p));                 \
+          }                                                                       \
+      } while(0)
+#else
+  /* Image has the native byte order -> Access the packed member directly */
+  #define PDOMAP_LOAD(type_p, obj_p)            (obj_p)
+  #define PDOMAP_STORE(type_p, obj_p, val_p)    ((obj_p) = (val_p))
+#endif
+
+/**
+ * \brief Generate the accessor functions of one object
+ *
+ * For an object with the accessor name 'Name' the following functions are
+ * generated:
+ * - prefix_getName(pImage, elem): Read one element of the object
+ * - prefix_setName(pImage, elem, val): Write one element of the object
+ * - prefix_getNameAddr(pImage): Base address of the object
+ */
+#define PDOMAP_ACCESSORS(prefix_p, objType_p, member_p, name_p, type_p)               \
+    PSI_INLINE type_p prefix_p##_get##name_p(objType_p* pImage_p, UINT16 elem_p)      \
+    {                                                                                 \
+        return PDOMAP_LOAD(type_p, pImage_p->member_p[elem_p]);                       \
+    }                                                                                 \
+    PSI_INLINE void prefix_p##_set##name_p(objType_p* pImage_p, UINT16 elem_p,        \
+            type_p val_p)                                                             \
+    {                                                                                 \
+        PDOMAP_STORE(type_p, pImage_p->member_p[elem_p], val_p);                      \
+    }                                                                                 \
+    PSI_INLINE type_p* prefix_p##_get##name_p##Addr(objType_p* pImage_p)              \
+    {                                                                                 \
+        return &pImage_p->member_p[0];                                                \
+    }
+
+/*----------------------------------------------------------------------------*/
+/* typedef                                                                    */
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/* function prototypes                                                        */
+/*----------------------------------------------------------------------------*/
+
+#endif /* _INC_libpsicommon_pdomap_H_ */
+
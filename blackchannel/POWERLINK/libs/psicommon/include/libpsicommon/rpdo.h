@@ -74,5 +74,11 @@ typedef struct {
 /* function prototypes                                                        */
 /*----------------------------------------------------------------------------*/
 
+/* Generate the typed accessors of all mapped RPDO objects */
+#define RPDO_ACCESSORS(member_p, name_p, idx_p, subIdx_p, type_p, count_p) \
+    PDOMAP_ACCESSORS(rpdo, tRpdoMappedObj, member_p, name_p, type_p)
+
+RPDO_MAPPED_OBJ_LIST(RPDO_ACCESSORS)
+
 #endif /* _INC_psicommon_rpdo_H_ */
 
@@ -68,19 +68,32 @@ typedef enum {
     kTimerStateStopped   = 0x03,    /**< Timer is currently stopped */
 } tTimerStatus;
 
+/**
+ * \brief Timer expiry callback (Called in the context of timeout_processSync())
+ */
+typedef void (*tTimeoutExpireCb)(tTimeoutInstance pInstance_p, void* pArg_p);
+
 /*----------------------------------------------------------------------------*/
 /* function prototypes                                                        */
 /*----------------------------------------------------------------------------*/
 DLLEXPORT void timeout_init(void);
 DLLEXPORT tTimeoutInstance timeout_create(UINT16 cycleLimit_p);
 DLLEXPORT void timeout_destroy(tTimeoutInstance pInstance_p);
+DLLEXPORT void timeout_setExpireCb(tTimeoutInstance pInstance_p,
+        tTimeoutExpireCb pfnExpireCb_p, void* pArg_p);
+
+DLLEXPORT void timeout_processSync(void);
 
 DLLEXPORT tTimerStatus timeout_checkExpire(tTimeoutInstance pInstance_p);
-DLLEXPORT void timeout_incrementCounter(tTimeoutInstance pInstance_p);
 DLLEXPORT void timeout_startTimer(tTimeoutInstance pInstance_p);
 DLLEXPORT void timeout_stopTimer(tTimeoutInstance pInstance_p);
 DLLEXPORT tTimerStatus timeout_isRunning(tTimeoutInstance pInstance_p);
 
+DLLEXPORT void timeout_updateRtt(tTimeoutInstance pInstance_p);
+DLLEXPORT void timeout_setMinCycleLimit(tTimeoutInstance pInstance_p,
+        UINT16 minCycleLimit_p);
+DLLEXPORT UINT16 timeout_getCycleLimit(tTimeoutInstance pInstance_p);
+
 #endif /* _INC_psicommon_timeout_H_ */
 
 
@@ -72,5 +72,11 @@ typedef struct {
 /* function prototypes                                                        */
 /*----------------------------------------------------------------------------*/
 
+/* Generate the typed accessors of all mapped TPDO objects */
+#define TPDO_ACCESSORS(member_p, name_p, idx_p, subIdx_p, type_p, count_p) \
+    PDOMAP_ACCESSORS(tpdo, tTpdoMappedObj, member_p, name_p, type_p)
+
+TPDO_MAPPED_OBJ_LIST(TPDO_ACCESSORS)
+
 #endif /* _INC_psicommon_tpdo_H_ */
 
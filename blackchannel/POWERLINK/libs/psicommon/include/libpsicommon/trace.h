@@ -0,0 +1,135 @@
+/**
+********************************************************************************
+\file   libpsicommon/trace.h
+
+\brief  Module header file of the binary trace recorder
+
+The binary trace recorder stores debug traces into a RAM ring without formatting
+them. A record only holds the id of the format string, a time stamp and the
+raw arguments. The text is created later on the host by trace_decodeRecord().
+
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+Copyright (c) 2013, Bernecker+Rainer Industrie-Elektronik Ges.m.b.H. (B&R)
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the name of the copyright holders nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL COPYRIGHT HOLDERS BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+#ifndef _INC_psicommon_trace_H_
+#define _INC_psicommon_trace_H_
+
+/*----------------------------------------------------------------------------*/
+/* includes                                                                   */
+/*----------------------------------------------------------------------------*/
+
+#include <libpsicommon/global.h>
+
+/*----------------------------------------------------------------------------*/
+/* const defines                                                              */
+/*----------------------------------------------------------------------------*/
+
+#ifndef TRACE_RING_SIZE
+  #define TRACE_RING_SIZE           64      /**< Number of records in the trace ring (Power of two) */
+#endif
+
+#define TRACE_MAX_ARGS              6       /**< Maximum number of arguments of one trace */
+
+#define TRACE_FMT_SECTION           "psitrace_fmt"    /**< Linker section of the format strings */
+
+/* Detect configuration errors */
+#if (TRACE_RING_SIZE == 0) || ((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) != 0)
+#error "TRACE_RING_SIZE needs to be a power of two"
+#endif
+
+/* Split the trace arguments into format string, argument count and arguments.
+   The count goes beyond TRACE_MAX_ARGS to detect too many arguments. */
+#define TRACE_ARG_COUNT(...)        TRACE_ARG_COUNT_(__VA_ARGS__, 12, 11, 10, 9, 8, 7, \
+                                                     6, 5, 4, 3, 2, 1, 0, ~)
+#define TRACE_ARG_COUNT_(fmt, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, \
+                         cnt, ...)  cnt
+#define TRACE_ARG_FMT(...)          TRACE_ARG_FMT_(__VA_ARGS__, ~)
+#define TRACE_ARG_FMT_(fmt, ...)    fmt
+#define TRACE_ARG_REST(...)         TRACE_ARG_REST_(__VA_ARGS__, 0)
+#define TRACE_ARG_REST_(fmt, ...)   __VA_ARGS__
+
+#if defined(__GNUC__)
+/**
+ * \brief Record a trace with a printf style format string literal
+ *
+ * The format string is moved to the section psitrace_fmt and only its offset
+ * inside this section is recorded. Extract the format table from the ELF file
+ * with 'objcopy -O binary --only-section=psitrace_fmt' for the decoder.
+ * All arguments are stored as 32 bit values. More than TRACE_MAX_ARGS
+ * arguments fail to compile.
+ */
+  #define TRACE_BINARY(...)                                                    \
+    do {                                                                       \
+        static const char traceFmt_l[]                                         \
+            __attribute__((section(TRACE_FMT_SECTION))) = TRACE_ARG_FMT(__VA_ARGS__); \
+        enum { traceArgCheck_l = sizeof(char[(TRACE_ARG_COUNT(__VA_ARGS__) <= TRACE_MAX_ARGS) ? 1 : -1]) }; \
+        trace_write((UINT32)(traceFmt_l - __start_psitrace_fmt),               \
+                    TRACE_ARG_COUNT(__VA_ARGS__), TRACE_ARG_REST(__VA_ARGS__)); \
+    } while(0)
+#endif
+
+/*----------------------------------------------------------------------------*/
+/* typedef                                                                    */
+/*----------------------------------------------------------------------------*/
+
+/**
+ * \brief Time stamp source of the trace records
+ */
+typedef UINT32 (*tTraceTimeStamp)(void);
+
+/**
+ * \brief One binary trace record
+ */
+typedef struct {
+    volatile UINT32     seq_m;                  /**< Ring position + 1 of the record (0: Record is written) */
+    UINT32              fmtId_m;                /**< Offset of the format string in the format table */
+    UINT32              timeStamp_m;            /**< Time stamp of the trace */
+    UINT32              argCount_m;             /**< Number of valid arguments */
+    UINT32              arg_m[TRACE_MAX_ARGS];  /**< Raw arguments of the trace */
+} tTraceRecord;
+
+/*----------------------------------------------------------------------------*/
+/* function prototypes                                                        */
+/*----------------------------------------------------------------------------*/
+#if defined(__GNUC__)
+extern const char __start_psitrace_fmt[];
+#endif
+
+DLLEXPORT void trace_init(tTraceTimeStamp pfnTimeStamp_p);
+
+DLLEXPORT void trace_write(UINT32 fmtId_p, UINT32 argCount_p, ...);
+DLLEXPORT BOOL trace_getRecord(tTraceRecord* pRecord_p);
+DLLEXPORT UINT32 trace_getLostCount(void);
+
+DLLEXPORT BOOL trace_decodeRecord(const tTraceRecord* pRecord_p,
+        const char* pFmtTable_p, UINT32 fmtTableSize_p,
+        char* pBuffer_p, UINT32 bufSize_p);
+
+#endif /* _INC_psicommon_trace_H_ */
+
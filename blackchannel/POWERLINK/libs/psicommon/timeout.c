@@ -7,8 +7,10 @@
 
 \brief  Module for internal timeout generation
 
-This module generates a timeout for asynchronous transmissions by simply counting
-the synchronous interrupts. If a limit is reached the timeout is generated.
+This module generates a timeout for asynchronous transmissions by counting
+the synchronous cycles. All timers are kept in one hierarchical timing wheel
+which is advanced once per cycle by timeout_processSync(). Starting, stopping
+and expiring a timer costs the same, independent of the number of timers.
 
 \ingroup group_libpsicommon
 *******************************************************************************/
@@ -78,19 +80,47 @@ the synchronous interrupts. If a limit is reached the timeout is generated.
 /* const defines                                                              */
 /*----------------------------------------------------------------------------*/
 
+#define TIMEOUT_WHEEL_SLOTS     (1U << TIMEOUT_WHEEL_BITS)                             /**< Number of slots of one wheel level */
+#define TIMEOUT_WHEEL_MASK      (TIMEOUT_WHEEL_SLOTS - 1U)                             /**< Mask of the slot index of one level */
+#define TIMEOUT_WHEEL_SPAN      (1UL << (TIMEOUT_WHEEL_BITS * TIMEOUT_WHEEL_LEVELS))   /**< Number of cycles covered by the wheel */
+
 /*----------------------------------------------------------------------------*/
 /* local types                                                                */
 /*----------------------------------------------------------------------------*/
 
+/**
+\brief Timing wheel type
+
+Level 0 of the wheel has one slot per cycle. One slot of the next level covers
+a full turn of the level below. A timer is kept in the level which matches its
+remaining time and is moved down (cascaded) when the level below wraps around.
+
+Timers are referenced by their number (Index + 1), so an all zero wheel is
+empty.
+*/
+typedef struct
+{
+    UINT8             slotHead_m[TIMEOUT_WHEEL_LEVELS * TIMEOUT_WHEEL_SLOTS];  /**< Number of the first timer of each slot (0: empty) */
+    volatile UINT32   currTick_m;                                              /**< Number of processed cycles */
+    volatile UINT32   reqMask_m;                                               /**< Timers with a pending start or stop request */
+} tTimeoutWheel;
+
 /*----------------------------------------------------------------------------*/
 /* local vars                                                                 */
 /*----------------------------------------------------------------------------*/
 
 static struct  eTimeoutInstance       timeoutInstance_l[TIMEOUT_MAX_INSTANCES];
+static tTimeoutWheel                  timeoutWheel_l;
 
 /*----------------------------------------------------------------------------*/
 /* local function prototypes                                                  */
 /*----------------------------------------------------------------------------*/
+static void timeout_postRequest(tTimeoutInstance pInstance_p);
+static void timeout_applyRequest(UINT8 timerId_p);
+static void timeout_insert(UINT8 timerId_p, UINT32 expireTick_p);
+static void timeout_unlink(UINT8 timerId_p);
+static void timeout_cascade(UINT8 level_p);
+static void timeout_expireSlot(void);
 
 
 /*============================================================================*/
@@ -105,6 +135,7 @@ static struct  eTimeoutInstance       timeoutInstance_l[TIMEOUT_MAX_INSTANCES];
 void timeout_init(void)
 {
     PSI_MEMSET(&timeoutInstance_l, 0 , sizeof(struct eTimeoutInstance) * TIMEOUT_MAX_INSTANCES);
+    PSI_MEMSET(&timeoutWheel_l, 0 , sizeof(tTimeoutWheel));
 }
 
 /*----------------------------------------------------------------------------*/
@@ -135,8 +166,11 @@ tTimeoutInstance timeout_create(UINT16 cycleLimit_p)
 
     if(timeoutId != 0xFF)
     {
-        /* Set maximum cycle count */
+        /* Set maximum cycle count (Not lowered by the round trip time by default) */
         timeoutInstance_l[timeoutId].cycleLimit_m = cycleLimit_p;
+        timeoutInstance_l[timeoutId].maxCycleLimit_m = cycleLimit_p;
+        timeoutInstance_l[timeoutId].minCycleLimit_m = cycleLimit_p;
+        timeoutInstance_l[timeoutId].fRetried_m = FALSE;
 
         /* Set valid instance id */
         timeoutInstance_l[timeoutId].fInstUsed_m = TRUE;
@@ -150,6 +184,9 @@ tTimeoutInstance timeout_create(UINT16 cycleLimit_p)
 /**
 \brief    Destroy the timer instance
 
+The timer is stopped and removed from the timing wheel with the next call of
+timeout_processSync().
+
 \param[in]  pInstance_p     Timeout module instance
 */
 /*----------------------------------------------------------------------------*/
@@ -157,17 +194,103 @@ void timeout_destroy(tTimeoutInstance pInstance_p)
 {
     if(pInstance_p != NULL)
     {
-        /* Destroy timeout instance! */
-        PSI_MEMSET(pInstance_p, 0 , sizeof(struct eTimeoutInstance));
+        timeout_stopTimer(pInstance_p);
+
+        /* Destroy timeout instance! (The wheel links are owned by the wheel) */
+        pInstance_p->pfnExpireCb_m = NULL;
+        pInstance_p->pCbArg_m = NULL;
+        pInstance_p->srtt_m = 0;
+        pInstance_p->rttVar_m = 0;
+        pInstance_p->cycleLimit_m = 0;
+        pInstance_p->maxCycleLimit_m = 0;
+        pInstance_p->minCycleLimit_m = 0;
+        pInstance_p->fInstUsed_m = FALSE;
     }
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Set the expiry callback of a timer
+
+The callback is called from timeout_processSync() in the cycle the timer
+expires. The timer keeps the expired state until timeout_checkExpire() or
+timeout_stopTimer() is called.
+
+\param[in]  pInstance_p     Timeout module instance
+\param[in]  pfnExpireCb_p   Expiry callback (NULL: no callback)
+\param[in]  pArg_p          Argument passed to the callback
+*/
+/*----------------------------------------------------------------------------*/
+void timeout_setExpireCb(tTimeoutInstance pInstance_p,
+        tTimeoutExpireCb pfnExpireCb_p, void* pArg_p)
+{
+    pInstance_p->pfnExpireCb_m = pfnExpireCb_p;
+    pInstance_p->pCbArg_m = pArg_p;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Advance all timers by one cycle
+
+Call this function exactly once per synchronous cycle. It applies the pending
+start and stop requests, moves the timing wheel forward and expires the timers
+of the current slot.
+*/
+/*----------------------------------------------------------------------------*/
+void timeout_processSync(void)
+{
+    UINT32 reqMask;
+    UINT32 tick;
+    UINT8 level;
+    UINT8 i;
+
+    /* Take over the start and stop requests */
+    reqMask = timeoutWheel_l.reqMask_m;
+    if(reqMask != 0)
+    {
+        while(!PSI_ATOMIC_CAS(&timeoutWheel_l.reqMask_m, reqMask, 0))
+        {
+            reqMask = timeoutWheel_l.reqMask_m;
+        }
+
+        for(i=0; i < TIMEOUT_MAX_INSTANCES; i++)
+        {
+            if((reqMask & (1UL << i)) != 0)
+            {
+                timeout_applyRequest(i);
+            }
+        }
+    }
+
+    tick = timeoutWheel_l.currTick_m + 1;
+    timeoutWheel_l.currTick_m = tick;
+
+    /* Level 0 wrapped -> Move the timers of the higher levels down */
+    if((tick & TIMEOUT_WHEEL_MASK) == 0)
+    {
+        level = 1;
+        while(level < (TIMEOUT_WHEEL_LEVELS - 1) &&
+              ((tick >> (TIMEOUT_WHEEL_BITS * level)) & TIMEOUT_WHEEL_MASK) == 0)
+        {
+            level++;
+        }
+
+        for( ; level > 0; level--)
+        {
+            timeout_cascade(level);
+        }
+    }
 
+    timeout_expireSlot();
+}
 
 /*----------------------------------------------------------------------------*/
 /**
 \brief    Check transmission validity
 
+On expiry the cycle limit is doubled (up to the limit passed to
+timeout_create()) to back off from a too short round trip time estimate.
+
 \param[in]  pInstance_p     Timeout module instance
 
 \retval kTimerStateInvalid    Error occurred
@@ -184,11 +307,24 @@ tTimerStatus timeout_checkExpire(tTimeoutInstance pInstance_p)
     {
         timerState = kTimerStateRunning;
 
-        if(pInstance_p->timeoutCycleCount_m > pInstance_p->cycleLimit_m)
+        if(pInstance_p->fExpired_m != FALSE)
         {
             timeout_stopTimer(pInstance_p);
 
             timerState = kTimerStateExpired;
+
+            /* The next answer may belong to the lost transmission */
+            pInstance_p->fRetried_m = TRUE;
+
+            /* Back off from the round trip time estimate */
+            if(pInstance_p->cycleLimit_m > (pInstance_p->maxCycleLimit_m >> 1))
+            {
+                pInstance_p->cycleLimit_m = pInstance_p->maxCycleLimit_m;
+            }
+            else
+            {
+                pInstance_p->cycleLimit_m <<= 1;
+            }
         }
     }
     else
@@ -201,30 +337,34 @@ tTimerStatus timeout_checkExpire(tTimeoutInstance pInstance_p)
 
 /*----------------------------------------------------------------------------*/
 /**
-\brief    Increment the local cycle counter
+\brief    Start the timer for this instance
+
+The timer expires when more than the cycle limit cycles have passed. It is
+put into the timing wheel by the next call of timeout_processSync(), so this
+function can be called from any context. Starting a running timer again
+counts as retransmission and gives no round trip time sample.
 
 \param[in]  pInstance_p     Timeout module instance
 */
 /*----------------------------------------------------------------------------*/
-void timeout_incrementCounter(tTimeoutInstance pInstance_p)
+void timeout_startTimer(tTimeoutInstance pInstance_p)
 {
     if(pInstance_p->fTimeoutEn_m != FALSE)
     {
-        pInstance_p->timeoutCycleCount_m++;
+        /* No answer to the last start -> The transmission is retried */
+        pInstance_p->fRetried_m = TRUE;
     }
-}
 
-/*----------------------------------------------------------------------------*/
-/**
-\brief    Start the timer for this instance
+    /* Invalidate an entry of a previous run in the wheel */
+    pInstance_p->generation_m++;
+    pInstance_p->fExpired_m = FALSE;
+    pInstance_p->startTick_m = timeoutWheel_l.currTick_m;
+
+    PSI_MEMORY_BARRIER();
 
-\param[in]  pInstance_p     Timeout module instance
-*/
-/*----------------------------------------------------------------------------*/
-void timeout_startTimer(tTimeoutInstance pInstance_p)
-{
     pInstance_p->fTimeoutEn_m = TRUE;
-    pInstance_p->timeoutCycleCount_m = 0;
+
+    timeout_postRequest(pInstance_p);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -236,8 +376,11 @@ void timeout_startTimer(tTimeoutInstance pInstance_p)
 /*----------------------------------------------------------------------------*/
 void timeout_stopTimer(tTimeoutInstance pInstance_p)
 {
+    pInstance_p->generation_m++;
     pInstance_p->fTimeoutEn_m = FALSE;
-    pInstance_p->timeoutCycleCount_m = 0;
+    pInstance_p->fExpired_m = FALSE;
+
+    timeout_postRequest(pInstance_p);
 }
 
 /*----------------------------------------------------------------------------*/
@@ -266,12 +409,321 @@ tTimerStatus timeout_isRunning(tTimeoutInstance pInstance_p)
     return timerState;
 }
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Adapt the cycle limit to the round trip time of the running timer
+
+Call this function when the answer to the timed transmission arrives and
+before the timer is stopped. The cycles since the timer start are taken as
+round trip time sample. The cycle limit is set to the smoothed round trip time
+plus four times its variation, bounded by the limit set with
+timeout_setMinCycleLimit() and the limit passed to timeout_create().
+
+A transmission which was retried or follows an expiry gives no sample, because
+the answer can't be assigned to one of the transmissions (Karn's rule).
+
+\param[in]  pInstance_p     Timeout module instance
+*/
+/*----------------------------------------------------------------------------*/
+void timeout_updateRtt(tTimeoutInstance pInstance_p)
+{
+    UINT32 sample;
+    UINT32 delta;
+    UINT32 cycleLimit;
+
+    if(pInstance_p->fTimeoutEn_m != FALSE &&
+       pInstance_p->fRetried_m == FALSE      )
+    {
+        sample = timeoutWheel_l.currTick_m - pInstance_p->startTick_m;
+
+        if(pInstance_p->srtt_m == 0)
+        {
+            /* First sample -> Initialize the estimator */
+            pInstance_p->srtt_m = sample << 3;
+            pInstance_p->rttVar_m = sample << 1;
+        }
+        else
+        {
+            /* srtt = 7/8 srtt + 1/8 sample, rttVar = 3/4 rttVar + 1/4 |srtt - sample| */
+            delta = pInstance_p->srtt_m >> 3;
+            delta = (delta > sample) ? (delta - sample) : (sample - delta);
+
+            pInstance_p->srtt_m = pInstance_p->srtt_m - (pInstance_p->srtt_m >> 3) + sample;
+            pInstance_p->rttVar_m = pInstance_p->rttVar_m - (pInstance_p->rttVar_m >> 2) + delta;
+        }
+
+        cycleLimit = (pInstance_p->srtt_m >> 3) + pInstance_p->rttVar_m;
+
+        if(cycleLimit < pInstance_p->minCycleLimit_m)
+        {
+            cycleLimit = pInstance_p->minCycleLimit_m;
+        }
+
+        if(cycleLimit > pInstance_p->maxCycleLimit_m)
+        {
+            cycleLimit = pInstance_p->maxCycleLimit_m;
+        }
+
+        pInstance_p->cycleLimit_m = (UINT16)cycleLimit;
+    }
+
+    /* Answer arrived -> The next transmission is a new one */
+    pInstance_p->fRetried_m = FALSE;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Allow the round trip time to lower the cycle limit
+
+By default the cycle limit never drops below the limit passed to
+timeout_create(). A user which drops the frame on expiry needs to keep the
+floor well above the usual round trip time, otherwise a slow answer loses
+data.
+
+\param[in]  pInstance_p         Timeout module instance
+\param[in]  minCycleLimit_p     Lower bound of the cycle limit (At least TIMEOUT_MIN_CYCLE_LIMIT)
+*/
+/*----------------------------------------------------------------------------*/
+void timeout_setMinCycleLimit(tTimeoutInstance pInstance_p,
+        UINT16 minCycleLimit_p)
+{
+    if(minCycleLimit_p < TIMEOUT_MIN_CYCLE_LIMIT)
+    {
+        minCycleLimit_p = TIMEOUT_MIN_CYCLE_LIMIT;
+    }
+
+    if(minCycleLimit_p > pInstance_p->maxCycleLimit_m)
+    {
+        minCycleLimit_p = pInstance_p->maxCycleLimit_m;
+    }
+
+    pInstance_p->minCycleLimit_m = minCycleLimit_p;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get the current cycle limit of the timer
+
+\param[in]  pInstance_p     Timeout module instance
+
+\return The number of cycles until the timer expires
+*/
+/*----------------------------------------------------------------------------*/
+UINT16 timeout_getCycleLimit(tTimeoutInstance pInstance_p)
+{
+    return pInstance_p->cycleLimit_m;
+}
+
 /*============================================================================*/
 /*            P R I V A T E   F U N C T I O N S                               */
 /*============================================================================*/
 /** \name Private Functions */
 /** \{ */
 
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Signal a start or stop of a timer to the timing wheel
+
+Only timeout_processSync() changes the wheel. The other contexts set the
+request bit of the timer, which is safe against concurrent requests.
+
+\param[in]  pInstance_p     Timeout module instance
+*/
+/*----------------------------------------------------------------------------*/
+static void timeout_postRequest(tTimeoutInstance pInstance_p)
+{
+    UINT32 reqMask;
+    UINT32 timerBit = 1UL << (UINT8)(pInstance_p - &timeoutInstance_l[0]);
+
+    do
+    {
+        reqMask = timeoutWheel_l.reqMask_m;
+    } while(!PSI_ATOMIC_CAS(&timeoutWheel_l.reqMask_m, reqMask, reqMask | timerBit));
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Apply the start or stop request of a timer to the wheel
+
+\param[in]  timerId_p       Index of the timer
+*/
+/*----------------------------------------------------------------------------*/
+static void timeout_applyRequest(UINT8 timerId_p)
+{
+    tTimeoutInstance pInstance = &timeoutInstance_l[timerId_p];
+    UINT32 expireTick;
+
+    timeout_unlink(timerId_p);
+
+    if(pInstance->fTimeoutEn_m != FALSE)
+    {
+        pInstance->wheelGen_m = pInstance->generation_m;
+
+        PSI_MEMORY_BARRIER();
+
+        expireTick = pInstance->startTick_m + pInstance->cycleLimit_m + 1;
+        if((INT32)(expireTick - timeoutWheel_l.currTick_m) < 1)
+        {
+            /* Expire with the next cycle at the earliest */
+            expireTick = timeoutWheel_l.currTick_m + 1;
+        }
+
+        timeout_insert(timerId_p, expireTick);
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Insert a timer into the slot of its expiry cycle
+
+\param[in]  timerId_p       Index of the timer
+\param[in]  expireTick_p    Cycle the timer expires in
+*/
+/*----------------------------------------------------------------------------*/
+static void timeout_insert(UINT8 timerId_p, UINT32 expireTick_p)
+{
+    tTimeoutInstance pInstance = &timeoutInstance_l[timerId_p];
+    UINT32 delta = expireTick_p - timeoutWheel_l.currTick_m;
+    UINT8 level = 0;
+    UINT8 slot;
+    UINT8 head;
+
+    if(delta >= TIMEOUT_WHEEL_SPAN)
+    {
+        /* Limit to the wheel span */
+        delta = TIMEOUT_WHEEL_SPAN - 1;
+        expireTick_p = timeoutWheel_l.currTick_m + delta;
+    }
+
+    /* Find the level which resolves the remaining time */
+    while(level < (TIMEOUT_WHEEL_LEVELS - 1) &&
+          (delta >> (TIMEOUT_WHEEL_BITS * (level + 1))) != 0)
+    {
+        level++;
+    }
+
+    slot = (UINT8)(level * TIMEOUT_WHEEL_SLOTS +
+            ((expireTick_p >> (TIMEOUT_WHEEL_BITS * level)) & TIMEOUT_WHEEL_MASK));
+
+    head = timeoutWheel_l.slotHead_m[slot];
+
+    pInstance->expireTick_m = expireTick_p;
+    pInstance->slot_m = slot + 1;
+    pInstance->prev_m = 0;
+    pInstance->next_m = head;
+
+    if(head != 0)
+    {
+        timeoutInstance_l[head - 1].prev_m = timerId_p + 1;
+    }
+
+    timeoutWheel_l.slotHead_m[slot] = timerId_p + 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Remove a timer from the wheel
+
+\param[in]  timerId_p       Index of the timer
+*/
+/*----------------------------------------------------------------------------*/
+static void timeout_unlink(UINT8 timerId_p)
+{
+    tTimeoutInstance pInstance = &timeoutInstance_l[timerId_p];
+
+    if(pInstance->slot_m != 0)
+    {
+        if(pInstance->prev_m != 0)
+        {
+            timeoutInstance_l[pInstance->prev_m - 1].next_m = pInstance->next_m;
+        }
+        else
+        {
+            timeoutWheel_l.slotHead_m[pInstance->slot_m - 1] = pInstance->next_m;
+        }
+
+        if(pInstance->next_m != 0)
+        {
+            timeoutInstance_l[pInstance->next_m - 1].prev_m = pInstance->prev_m;
+        }
+
+        pInstance->slot_m = 0;
+        pInstance->next_m = 0;
+        pInstance->prev_m = 0;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Move the timers of the current slot of a level to the lower levels
+
+\param[in]  level_p         The level to cascade
+*/
+/*----------------------------------------------------------------------------*/
+static void timeout_cascade(UINT8 level_p)
+{
+    UINT8 slot;
+    UINT8 timerNum;
+    UINT8 nextNum;
+    tTimeoutInstance pInstance;
+
+    slot = (UINT8)(level_p * TIMEOUT_WHEEL_SLOTS +
+            ((timeoutWheel_l.currTick_m >> (TIMEOUT_WHEEL_BITS * level_p)) & TIMEOUT_WHEEL_MASK));
+
+    timerNum = timeoutWheel_l.slotHead_m[slot];
+    timeoutWheel_l.slotHead_m[slot] = 0;
+
+    while(timerNum != 0)
+    {
+        pInstance = &timeoutInstance_l[timerNum - 1];
+        nextNum = pInstance->next_m;
+
+        pInstance->slot_m = 0;
+        timeout_insert(timerNum - 1, pInstance->expireTick_m);
+
+        timerNum = nextNum;
+    }
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Expire all timers of the current level 0 slot
+*/
+/*----------------------------------------------------------------------------*/
+static void timeout_expireSlot(void)
+{
+    UINT8 slot;
+    UINT8 timerNum;
+    tTimeoutInstance pInstance;
+
+    slot = (UINT8)(timeoutWheel_l.currTick_m & TIMEOUT_WHEEL_MASK);
+
+    timerNum = timeoutWheel_l.slotHead_m[slot];
+    timeoutWheel_l.slotHead_m[slot] = 0;
+
+    while(timerNum != 0)
+    {
+        pInstance = &timeoutInstance_l[timerNum - 1];
+        timerNum = pInstance->next_m;
+
+        pInstance->slot_m = 0;
+        pInstance->next_m = 0;
+        pInstance->prev_m = 0;
+
+        /* Ignore entries of a restarted or stopped timer */
+        if(pInstance->fTimeoutEn_m != FALSE                      &&
+           pInstance->wheelGen_m == pInstance->generation_m        )
+        {
+            pInstance->fExpired_m = TRUE;
+
+            if(pInstance->pfnExpireCb_m != NULL)
+            {
+                pInstance->pfnExpireCb_m(pInstance, pInstance->pCbArg_m);
+            }
+        }
+    }
+}
+
 /**
  * \}
  * \}
@@ -0,0 +1,289 @@
+/**
+********************************************************************************
+\file   psicommon/tools/psitracedec.c
+
+\brief  Host tool to expand the binary traces of the target to text
+
+Reads the console output of the target and replaces all trace lines which are
+printed by the target ('#TRC <fmtId> <timeStamp> <argCount> <args>') with the
+expanded text. All other lines are passed through unchanged.
+
+Usage: psitracedec <format table> [console log]
+
+The format table is the .tracefmt file which is extracted from the ELF file.
+Without a console log the standard input is read.
+
+\ingroup module_psicom_trace
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2014 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/* includes                                                                   */
+/*----------------------------------------------------------------------------*/
+#include <libpsicommon/trace.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*============================================================================*/
+/*            G L O B A L   D E F I N I T I O N S                             */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* const defines                                                              */
+/*----------------------------------------------------------------------------*/
+
+
+/*----------------------------------------------------------------------------*/
+/* module global vars                                                         */
+/*----------------------------------------------------------------------------*/
+
+
+/*----------------------------------------------------------------------------*/
+/* global function prototypes                                                 */
+/*----------------------------------------------------------------------------*/
+
+
+/*============================================================================*/
+/*            P R I V A T E   D E F I N I T I O N S                           */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* const defines                                                              */
+/*----------------------------------------------------------------------------*/
+#define TRACEDEC_LINE_SIZE      256     /**< Maximum length of one console line */
+#define TRACEDEC_TEXT_SIZE      1024    /**< Maximum length of one expanded trace */
+
+#define TRACEDEC_RECORD_TAG     "#TRC "     /**< Start of a trace record line */
+#define TRACEDEC_LOST_TAG       "#TRCLOST " /**< Start of a lost records line */
+
+/*----------------------------------------------------------------------------*/
+/* local types                                                                */
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/* local vars                                                                 */
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/* local function prototypes                                                  */
+/*----------------------------------------------------------------------------*/
+static char* readFmtTable(const char* pFileName_p, UINT32* pSize_p);
+static BOOL parseRecord(const char* pLine_p, tTraceRecord* pRecord_p);
+
+/*============================================================================*/
+/*            P U B L I C   F U N C T I O N S                                 */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Entry function of the trace decoder
+
+\param[in] argc     Number of command line arguments
+\param[in] argv     The command line arguments
+
+\retval 0          All lines are processed
+\retval 1          Invalid arguments or files
+*/
+/*----------------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+    int retVal = 1;
+    char* pFmtTable = NULL;
+    UINT32 fmtTableSize = 0;
+    FILE* pLog = stdin;
+    char line[TRACEDEC_LINE_SIZE];
+    char text[TRACEDEC_TEXT_SIZE];
+    tTraceRecord record;
+
+    if(argc < 2 || argc > 3)
+    {
+        fprintf(stderr, "Usage: %s <format table> [console log]\n", argv[0]);
+        goto Exit;
+    }
+
+    pFmtTable = readFmtTable(argv[1], &fmtTableSize);
+    if(pFmtTable == NULL)
+    {
+        fprintf(stderr, "Unable to read the format table %s\n", argv[1]);
+        goto Exit;
+    }
+
+    if(argc == 3)
+    {
+        pLog = fopen(argv[2], "r");
+        if(pLog == NULL)
+        {
+            fprintf(stderr, "Unable to open the console log %s\n", argv[2]);
+            goto Exit;
+        }
+    }
+
+    while(fgets(line, sizeof(line), pLog) != NULL)
+    {
+        if(strncmp(line, TRACEDEC_LOST_TAG, strlen(TRACEDEC_LOST_TAG)) == 0)
+        {
+            printf("<%lu trace records lost>\n",
+                   strtoul(&line[strlen(TRACEDEC_LOST_TAG)], NULL, 16));
+        }
+        else if(strncmp(line, TRACEDEC_RECORD_TAG, strlen(TRACEDEC_RECORD_TAG)) == 0)
+        {
+            if(parseRecord(&line[strlen(TRACEDEC_RECORD_TAG)], &record) &&
+               trace_decodeRecord(&record, pFmtTable, fmtTableSize, text, sizeof(text)))
+            {
+                fputs(text, stdout);
+            }
+            else
+            {
+                printf("<invalid trace record> %s", &line[strlen(TRACEDEC_RECORD_TAG)]);
+            }
+        }
+        else
+        {
+            fputs(line, stdout);
+        }
+    }
+
+    retVal = 0;
+
+Exit:
+    if(pLog != NULL && pLog != stdin)
+    {
+        fclose(pLog);
+    }
+
+    free(pFmtTable);
+
+    return retVal;
+}
+
+/*============================================================================*/
+/*            P R I V A T E   F U N C T I O N S                               */
+/*============================================================================*/
+/** \name Private Functions */
+/** \{ */
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Read the format table of the binary traces
+
+\param[in]  pFileName_p     File name of the format table
+\param[out] pSize_p         Size of the format table
+
+\return Pointer to the format table or NULL on error (Free with free())
+*/
+/*----------------------------------------------------------------------------*/
+static char* readFmtTable(const char* pFileName_p, UINT32* pSize_p)
+{
+    char* pFmtTable = NULL;
+    FILE* pFile;
+    long fileSize;
+
+    pFile = fopen(pFileName_p, "rb");
+    if(pFile != NULL)
+    {
+        if(fseek(pFile, 0, SEEK_END) == 0)
+        {
+            fileSize = ftell(pFile);
+            if(fileSize > 0 && fseek(pFile, 0, SEEK_SET) == 0)
+            {
+                pFmtTable = (char*)malloc((size_t)fileSize);
+                if(pFmtTable != NULL &&
+                   fread(pFmtTable, 1, (size_t)fileSize, pFile) == (size_t)fileSize)
+                {
+                    *pSize_p = (UINT32)fileSize;
+                }
+                else
+                {
+                    free(pFmtTable);
+                    pFmtTable = NULL;
+                }
+            }
+        }
+
+        fclose(pFile);
+    }
+
+    return pFmtTable;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Parse the hexadecimal fields of one trace record line
+
+\param[in]  pLine_p         The line without the record tag
+\param[out] pRecord_p       The parsed trace record
+
+\retval TRUE        Record parsed successfully
+\retval FALSE       Invalid or incomplete record line
+*/
+/*----------------------------------------------------------------------------*/
+static BOOL parseRecord(const char* pLine_p, tTraceRecord* pRecord_p)
+{
+    BOOL fReturn = FALSE;
+    const char* pField = pLine_p;
+    char* pEnd = NULL;
+    UINT32 fields[3 + TRACE_MAX_ARGS];
+    UINT32 fieldCount = 0;
+
+    /* Collect the fmtId, time stamp, argument count and arguments */
+    while(fieldCount < sizeof(fields) / sizeof(fields[0]))
+    {
+        fields[fieldCount] = (UINT32)strtoul(pField, &pEnd, 16);
+        if(pEnd == pField)
+        {
+            break;
+        }
+        pField = pEnd;
+        fieldCount++;
+    }
+
+    if(fieldCount >= 3 && fields[2] <= TRACE_MAX_ARGS && fieldCount == 3 + fields[2])
+    {
+        memset(pRecord_p, 0, sizeof(tTraceRecord));
+        pRecord_p->fmtId_m = fields[0];
+        pRecord_p->timeStamp_m = fields[1];
+        pRecord_p->argCount_m = fields[2];
+        memcpy(pRecord_p->arg_m, &fields[3], fields[2] * sizeof(UINT32));
+        fReturn = TRUE;
+    }
+
+    return fReturn;
+}
+
+/**
+ * \}
+ */
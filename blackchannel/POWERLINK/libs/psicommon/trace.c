@@ -0,0 +1,277 @@
+/**
+********************************************************************************
+\file   psicommon/trace.c
+
+\defgroup module_psicom_trace Binary trace module
+\{
+
+\brief  Module for deferred formatting of debug traces
+
+Formatting a debug trace and sending it over a serial line takes a lot of time.
+This module only copies the id of the format string, a time stamp and the raw
+arguments into a RAM ring. The ring is read with trace_getRecord() in the
+background or dumped by the debugger. The host expands the records with
+trace_decodeRecord() and the format table extracted from the ELF file.
+
+Traces can be written from interrupt and background context. If the ring is
+full the oldest record is overwritten.
+
+\ingroup group_libpsicommon
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2014 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/* includes                                                                   */
+/*----------------------------------------------------------------------------*/
+#include <libpsicommon/trace.h>
+
+#include <stdarg.h>
+
+/*============================================================================*/
+/*            G L O B A L   D E F I N I T I O N S                             */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* const defines                                                              */
+/*----------------------------------------------------------------------------*/
+
+
+/*----------------------------------------------------------------------------*/
+/* module global vars                                                         */
+/*----------------------------------------------------------------------------*/
+
+
+/*----------------------------------------------------------------------------*/
+/* global function prototypes                                                 */
+/*----------------------------------------------------------------------------*/
+
+
+/*============================================================================*/
+/*            P R I V A T E   D E F I N I T I O N S                           */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* const defines                                                              */
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/* local types                                                                */
+/*----------------------------------------------------------------------------*/
+
+/**
+ * \brief Trace module instance
+ */
+typedef struct
+{
+    tTraceRecord        record_m[TRACE_RING_SIZE];  /**< The trace ring */
+    volatile UINT32     writePos_m;         /**< Ring position of the next record to write (All writers) */
+    UINT32              readPos_m;          /**< Ring position of the next record to read */
+    UINT32              lostCount_m;        /**< Number of records overwritten before they were read */
+    tTraceTimeStamp     pfnTimeStamp_m;     /**< Time stamp source (NULL: No time stamp) */
+} tTraceInstance;
+
+/*----------------------------------------------------------------------------*/
+/* local vars                                                                 */
+/*----------------------------------------------------------------------------*/
+
+static tTraceInstance traceInstance_l;
+
+/*----------------------------------------------------------------------------*/
+/* local function prototypes                                                  */
+/*----------------------------------------------------------------------------*/
+
+
+/*============================================================================*/
+/*            P U B L I C   F U N C T I O N S                                 */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Initialize the binary trace module
+
+\param[in] pfnTimeStamp_p       Time stamp source of the records (NULL: No time stamp)
+*/
+/*----------------------------------------------------------------------------*/
+void trace_init(tTraceTimeStamp pfnTimeStamp_p)
+{
+    PSI_MEMSET(&traceInstance_l, 0, sizeof(tTraceInstance));
+
+    traceInstance_l.pfnTimeStamp_m = pfnTimeStamp_p;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Write a trace record to the ring
+
+Use the macro TRACE_BINARY() instead of calling this function directly.
+
+\param[in] fmtId_p          Id of the format string
+\param[in] argCount_p       Number of arguments (Arguments above TRACE_MAX_ARGS are ignored)
+\param[in] ...              Arguments of the trace (Each is stored as 32 bit value)
+*/
+/*----------------------------------------------------------------------------*/
+void trace_write(UINT32 fmtId_p, UINT32 argCount_p, ...)
+{
+    va_list argList;
+    tTraceRecord* pRecord;
+    UINT32 pos;
+    UINT32 i;
+
+    /* Reserve the next record (The oldest record is overwritten) */
+    do
+    {
+        pos = traceInstance_l.writePos_m;
+    } while(!PSI_ATOMIC_CAS(&traceInstance_l.writePos_m, pos, pos + 1));
+
+    pRecord = &traceInstance_l.record_m[pos & (TRACE_RING_SIZE - 1)];
+
+    /* Record is invalid while it is written */
+    pRecord->seq_m = 0;
+    PSI_MEMORY_BARRIER();
+
+    if(argCount_p > TRACE_MAX_ARGS)
+    {
+        argCount_p = TRACE_MAX_ARGS;
+    }
+
+    pRecord->fmtId_m = fmtId_p;
+    pRecord->argCount_m = argCount_p;
+
+    if(traceInstance_l.pfnTimeStamp_m != NULL)
+    {
+        pRecord->timeStamp_m = traceInstance_l.pfnTimeStamp_m();
+    }
+    else
+    {
+        pRecord->timeStamp_m = 0;
+    }
+
+    va_start(argList, argCount_p);
+    for(i=0; i < argCount_p; i++)
+    {
+        pRecord->arg_m[i] = va_arg(argList, UINT32);
+    }
+    va_end(argList);
+
+    /* Record is complete before it gets valid */
+    PSI_MEMORY_BARRIER();
+    pRecord->seq_m = pos + 1;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Read the oldest trace record from the ring
+
+Records which are overwritten before they are read are skipped and counted.
+Only one reader is allowed.
+
+\param[out] pRecord_p       Copy of the trace record
+
+\retval TRUE        Record is read
+\retval FALSE       No record available
+*/
+/*----------------------------------------------------------------------------*/
+BOOL trace_getRecord(tTraceRecord* pRecord_p)
+{
+    BOOL fReturn = FALSE;
+    UINT32 writePos;
+    UINT32 readPos;
+    tTraceRecord* pRecord;
+
+    if(pRecord_p != NULL)
+    {
+        writePos = traceInstance_l.writePos_m;
+        readPos = traceInstance_l.readPos_m;
+
+        /* Skip records which are already overwritten */
+        if(writePos - readPos > TRACE_RING_SIZE)
+        {
+            traceInstance_l.lostCount_m += writePos - readPos - TRACE_RING_SIZE;
+            readPos = writePos - TRACE_RING_SIZE;
+        }
+
+        if(readPos != writePos)
+        {
+            pRecord = &traceInstance_l.record_m[readPos & (TRACE_RING_SIZE - 1)];
+
+            if(pRecord->seq_m == readPos + 1)
+            {
+                PSI_MEMORY_BARRIER();
+                PSI_MEMCPY(pRecord_p, pRecord, sizeof(tTraceRecord));
+                PSI_MEMORY_BARRIER();
+
+                /* Check if the record was overwritten during the copy */
+                if(pRecord->seq_m == readPos + 1)
+                {
+                    fReturn = TRUE;
+                }
+                else
+                {
+                    traceInstance_l.lostCount_m++;
+                }
+
+                readPos++;
+            }   /* no else: Record is still written -> Retry later */
+        }
+
+        traceInstance_l.readPos_m = readPos;
+    }
+
+    return fReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Get the number of records which were overwritten before reading
+
+\return Number of lost records
+*/
+/*----------------------------------------------------------------------------*/
+UINT32 trace_getLostCount(void)
+{
+    return traceInstance_l.lostCount_m;
+}
+
+/*============================================================================*/
+/*            P R I V A T E   F U N C T I O N S                               */
+/*============================================================================*/
+/** \name Private Functions */
+/** \{ */
+
+
+/**
+ * \}
+ * \}
+ */
@@ -0,0 +1,266 @@
+/**
+********************************************************************************
+\file   psicommon/tracedecode.c
+
+\brief  Host side decoder of binary trace records
+
+Expands the records of the binary trace module to text. The format strings are
+taken from the format table which is extracted from the psitrace_fmt section of
+the ELF file. This file is only built for the host.
+
+\ingroup module_psicom_trace
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2014 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/* includes                                                                   */
+/*----------------------------------------------------------------------------*/
+#include <libpsicommon/trace.h>
+
+#include <stdio.h>
+#include <string.h>
+
+/*============================================================================*/
+/*            G L O B A L   D E F I N I T I O N S                             */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* const defines                                                              */
+/*----------------------------------------------------------------------------*/
+
+
+/*----------------------------------------------------------------------------*/
+/* module global vars                                                         */
+/*----------------------------------------------------------------------------*/
+
+
+/*----------------------------------------------------------------------------*/
+/* global function prototypes                                                 */
+/*----------------------------------------------------------------------------*/
+
+
+/*============================================================================*/
+/*            P R I V A T E   D E F I N I T I O N S                           */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* const defines                                                              */
+/*----------------------------------------------------------------------------*/
+#define TRACE_SPEC_SIZE         16      /**< Maximum length of one conversion specification */
+#define TRACE_CONV_SIZE         64      /**< Maximum length of one converted argument */
+
+/*----------------------------------------------------------------------------*/
+/* local types                                                                */
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/* local vars                                                                 */
+/*----------------------------------------------------------------------------*/
+
+/*----------------------------------------------------------------------------*/
+/* local function prototypes                                                  */
+/*----------------------------------------------------------------------------*/
+static int trace_convertArg(char* pConv_p, char* pSpec_p, UINT8 specLen_p,
+        char conv_p, UINT32 arg_p);
+
+/*============================================================================*/
+/*            P U B L I C   F U N C T I O N S                                 */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Expand a binary trace record to text
+
+Integer and character conversions are expanded like printf(). Strings and
+pointers can't be resolved on the host, therefore their address is printed.
+
+\param[in]  pRecord_p           The trace record
+\param[in]  pFmtTable_p         Content of the psitrace_fmt section
+\param[in]  fmtTableSize_p      Size of the format table
+\param[out] pBuffer_p           Buffer for the text
+\param[in]  bufSize_p           Size of the text buffer
+
+\retval TRUE        Record expanded successfully
+\retval FALSE       Invalid record, format string or too small buffer
+*/
+/*----------------------------------------------------------------------------*/
+BOOL trace_decodeRecord(const tTraceRecord* pRecord_p,
+        const char* pFmtTable_p, UINT32 fmtTableSize_p,
+        char* pBuffer_p, UINT32 bufSize_p)
+{
+    BOOL fReturn = FALSE;
+    const char* pFmt = NULL;
+    const char* pFmtEnd = NULL;
+    char spec[TRACE_SPEC_SIZE];
+    char conv[TRACE_CONV_SIZE];
+    UINT8 specLen;
+    UINT32 argIdx = 0;
+    UINT32 outLen = 0;
+    int convLen;
+
+    if(pRecord_p != NULL && pFmtTable_p != NULL && pBuffer_p != NULL &&
+       bufSize_p > 0 && pRecord_p->fmtId_m < fmtTableSize_p &&
+       pRecord_p->argCount_m <= TRACE_MAX_ARGS)
+    {
+        /* The format string needs to be terminated inside the table */
+        pFmt = &pFmtTable_p[pRecord_p->fmtId_m];
+        pFmtEnd = (const char*)memchr(pFmt, '\0', fmtTableSize_p - pRecord_p->fmtId_m);
+        if(pFmtEnd != NULL)
+        {
+            fReturn = TRUE;
+        }
+    }
+
+    while(pFmt < pFmtEnd && fReturn != FALSE)
+    {
+        if(*pFmt != '%')
+        {
+            conv[0] = *pFmt++;
+            convLen = 1;
+        }
+        else if(pFmt[1] == '%')
+        {
+            conv[0] = '%';
+            convLen = 1;
+            pFmt += 2;
+        }
+        else
+        {
+            /* Collect flags, width and precision of the conversion */
+            specLen = 0;
+            spec[specLen++] = *pFmt++;
+            while(pFmt < pFmtEnd && strchr("-+ #0123456789.hlzjt", *pFmt) != NULL &&
+                  specLen < TRACE_SPEC_SIZE - 2)
+            {
+                /* Length modifiers are dropped, all arguments are 32 bit */
+                if(strchr("hlzjt", *pFmt) == NULL)
+                {
+                    spec[specLen++] = *pFmt;
+                }
+                pFmt++;
+            }
+
+            if(pFmt >= pFmtEnd || argIdx >= pRecord_p->argCount_m)
+            {
+                /* Incomplete conversion or missing argument */
+                convLen = -1;
+            }
+            else
+            {
+                convLen = trace_convertArg(conv, spec, specLen, *pFmt++,
+                                           pRecord_p->arg_m[argIdx++]);
+            }
+        }
+
+        if(convLen < 0 || outLen + (UINT32)convLen >= bufSize_p)
+        {
+            fReturn = FALSE;
+        }
+        else
+        {
+            PSI_MEMCPY(&pBuffer_p[outLen], conv, convLen);
+            outLen += (UINT32)convLen;
+        }
+    }
+
+    if(pBuffer_p != NULL && bufSize_p > 0)
+    {
+        pBuffer_p[(fReturn != FALSE) ? outLen : 0] = '\0';
+    }
+
+    return fReturn;
+}
+
+/*============================================================================*/
+/*            P R I V A T E   F U N C T I O N S                               */
+/*============================================================================*/
+/** \name Private Functions */
+/** \{ */
+
+/*----------------------------------------------------------------------------*/
+/**
+\brief    Convert one argument of a trace record
+
+\param[out] pConv_p         Buffer of size TRACE_CONV_SIZE for the result
+\param[in]  pSpec_p         Conversion specification without conversion character
+\param[in]  specLen_p       Length of the specification
+\param[in]  conv_p          The conversion character
+\param[in]  arg_p           The raw argument
+
+\return Length of the converted argument or -1 on error
+*/
+/*----------------------------------------------------------------------------*/
+static int trace_convertArg(char* pConv_p, char* pSpec_p, UINT8 specLen_p,
+        char conv_p, UINT32 arg_p)
+{
+    int convLen = -1;
+
+    pSpec_p[specLen_p] = conv_p;
+    pSpec_p[specLen_p + 1] = '\0';
+
+    switch(conv_p)
+    {
+        case 'd':
+        case 'i':
+        case 'c':
+            convLen = snprintf(pConv_p, TRACE_CONV_SIZE, pSpec_p, (int)arg_p);
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            convLen = snprintf(pConv_p, TRACE_CONV_SIZE, pSpec_p, (unsigned int)arg_p);
+            break;
+        case 's':
+        case 'p':
+            /* Memory of the target is not available */
+            convLen = snprintf(pConv_p, TRACE_CONV_SIZE, "<0x%08X>", (unsigned int)arg_p);
+            break;
+        default:
+            /* Unsupported conversion */
+            break;
+    }
+
+    if(convLen >= TRACE_CONV_SIZE)
+    {
+        convLen = -1;
+    }
+
+    return convLen;
+}
+
+/**
+ * \}
+ */
@@ -2,10 +2,17 @@
 ********************************************************************************
 \file   fifo.c
 
-\brief  Simple generic FIFO implementation
+\brief  Generic single producer single consumer FIFO implementation
 
-Implements a FIFO to store data which is forward it to the reading task.
-This FIFO is implemented thread safe.
+Implements a FIFO to store data which is forwarded to the reading task. The
+producer reserves space for an element in the FIFO, writes the element in
+place and commits it. The consumer gets a pointer to the oldest element,
+processes it in place and releases it. Elements are stored with their
+actual size, so short elements only occupy the space they need.
+
+The FIFO is lock free for exactly one producer and one consumer context.
+The producer only writes the write counter and the consumer only writes the
+read counter. The FIFO buffer is provided by the creator of the instance.
 
 \ingroup module_fifo
 *******************************************************************************/
@@ -74,7 +81,10 @@ This FIFO is implemented thread safe.
 //------------------------------------------------------------------------------
 // const defines
 //------------------------------------------------------------------------------
-#define FIFO_MAX_INSTANCES      4           ///< Maximum number of FIFO instances
+#define FIFO_MAX_INSTANCES      4               ///< Maximum number of FIFO instances
+#define FIFO_ELEM_PAD           0xFFFFFFFFU     ///< Header marks the rest of the buffer as unused
+
+#define FIFO_ALIGN(size)        (((size) + 3U) & 0xFFFFFFFCU)   ///< Align size to four bytes
 
 //------------------------------------------------------------------------------
 // local types
@@ -96,7 +106,7 @@ static struct eFifoInstance fifoInstance_l[FIFO_MAX_INSTANCES];
 //------------------------------------------------------------------------------
 // local function prototypes
 //------------------------------------------------------------------------------
-
+static tElemHeader* getHeader(tFifoInstance pInstance_p, UINT32 count_p);
 
 //============================================================================//
 //            P U B L I C   F U N C T I O N S                                 //
@@ -116,7 +126,7 @@ tPsiStatus fifo_init(void)
     PSI_MEMSET(&fifoInstance_l, 0, sizeof(struct eFifoInstance) * FIFO_MAX_INSTANCES);
 
     // Check alignment of element header
-    if((sizeof(tElemHeader) & 3) != 0)
+    if(sizeof(tElemHeader) != FIFO_ELEM_HEADER_SIZE)
     {
         ret = kPsiFifoAlignError;
     }
@@ -128,8 +138,11 @@ tPsiStatus fifo_init(void)
 /**
 \brief    Create a FIFO instance
 
-\param[in] elemSize_p       Size of one element
-\param[in] elemCount_p      Maximum number of elements in the FIFO
+The FIFO stores its elements in the provided buffer. The size of one element
+is limited to FIFO_MAX_ELEM_SIZE(buffSize_p).
+
+\param[in] pBuffer_p        Pointer to the FIFO buffer (32 bit aligned)
+\param[in] buffSize_p       Size of the FIFO buffer (Power of two)
 
 \return tFifoInstance
 \retval Pointer        Pointer to the FIFO instance
@@ -138,14 +151,23 @@ tPsiStatus fifo_init(void)
 \ingroup module_fifo
 */
 //------------------------------------------------------------------------------
-tFifoInstance fifo_create(UINT32 elemSize_p, UINT8 elemCount_p)
+tFifoInstance fifo_create(UINT8* pBuffer_p, UINT32 buffSize_p)
 {
     tFifoInstance     pInstance = NULL;
-    UINT32            elemSizeAlign = (elemSize_p + 3U) & 0xFFFFFFFCU;
-    UINT32            lastElemOffset;
-
     UINT8  id = 0xFF, i;
 
+    if(pBuffer_p == NULL || UNALIGNED32(pBuffer_p))
+    {
+        goto Exit;
+    }
+
+    // Buffer needs to hold at least one element with payload
+    if((buffSize_p < (4 * FIFO_ELEM_HEADER_SIZE)) ||
+       ((buffSize_p & (buffSize_p - 1)) != 0)      )
+    {
+        goto Exit;
+    }
+
     // Search for free instance
     for(i=0; i < FIFO_MAX_INSTANCES; i++)
     {
@@ -163,21 +185,14 @@ tFifoInstance fifo_create(UINT32 elemSize_p, UINT8 elemCount_p)
         goto Exit;
     }
 
-    lastElemOffset = ((elemSizeAlign + sizeof(tElemHeader)) * (elemCount_p - 1));
+    PSI_MEMSET(&fifoInstance_l[id], 0, sizeof(struct eFifoInstance));
 
-    // Allocate FIFO buffer
-    fifoInstance_l[id].pFifoBuffer_m = PSI_MALLOC((elemSizeAlign + sizeof(tElemHeader)) * elemCount_p);
+    fifoInstance_l[id].pFifoBuffer_m = pBuffer_p;
+    fifoInstance_l[id].buffMask_m = buffSize_p - 1;
 
-    // Init read and write position pointer
-    fifoInstance_l[id].pReadPos_m = fifoInstance_l[id].pFifoBuffer_m;
-    fifoInstance_l[id].pWritePos_m = fifoInstance_l[id].pFifoBuffer_m;
-
-    // Remember element size and count
-    fifoInstance_l[id].elemSize_m = elemSizeAlign + sizeof(tElemHeader);
-    fifoInstance_l[id].maxElem_m = elemCount_p;
-
-    // Set pointer to fifo tail
-    fifoInstance_l[id].pFifoTail_m = (UINT8*)((UINT32)fifoInstance_l[id].pFifoBuffer_m + lastElemOffset);
+    // An element never needs more than half of the buffer -> A free
+    // reservation always fits, even when the buffer end needs to be skipped
+    fifoInstance_l[id].maxElemSize_m = FIFO_MAX_ELEM_SIZE(buffSize_p);
 
     // Create pointer to instance
     fifoInstance_l[id].fInstUsed_m = TRUE;
@@ -191,146 +206,246 @@ Exit:
 /**
 \brief    Destroy a FIFO instance
 
-\param[in] pInstance       Pointer to FIFO instance
+\param[in] pInstance_p       Pointer to FIFO instance
 
 \ingroup module_fifo
 */
 //------------------------------------------------------------------------------
-void fifo_destroy(tFifoInstance pInstance)
+void fifo_destroy(tFifoInstance pInstance_p)
 {
-    // Free FIFO buffer
-    PSI_FREE(pInstance->pFifoBuffer_m);
-
-    // Reset instance structure
-    PSI_MEMSET(pInstance, 0, sizeof(struct eFifoInstance));
+    if(pInstance_p != NULL)
+    {
+        // Reset instance structure
+        PSI_MEMSET(pInstance_p, 0, sizeof(struct eFifoInstance));
+    }
 }
 
 //------------------------------------------------------------------------------
 /**
-\brief    Insert an element to the FIFO
+\brief    Reserve space for an element in the FIFO
+
+Returns a pointer to the free space in the FIFO buffer. The producer writes
+the element directly to this space and makes it visible to the consumer with
+fifo_commitElement(). This function is only called by the producer.
 
-\param[in] pInstance       Pointer to FIFO instance
-\param[in] pElement_p      Pointer to the element to post
-\param[in] elemSize_p      Size of the element to post
+\param[in]  pInstance_p     Pointer to FIFO instance
+\param[in]  elemSize_p      Maximum size of the element
+\param[out] ppElement_p     Pointer to the reserved element
 
 \return tPsiStatus
-\retval kPsiSuccessful    On success
-\retval kPsiFifoFull      FIFO is full
+\retval kPsiSuccessful                  On success
+\retval kPsiFifoInvalidParam            Invalid parameter passed to function
+\retval kPsiFifoElementSizeOverflow     Element is too large for this FIFO
+\retval kPsiFifoFull                    Not enough free space in the FIFO
 
 \ingroup module_fifo
 */
 //------------------------------------------------------------------------------
-tPsiStatus fifo_insertElement(tFifoInstance pInstance, tFifoElement pElement_p,
-        UINT32 elemSize_p)
+tPsiStatus fifo_reserveElement(tFifoInstance pInstance_p, UINT32 elemSize_p,
+        UINT8** ppElement_p)
 {
     tPsiStatus ret = kPsiSuccessful;
-    UINT8        numElement;
-    tElemHeader  elementHeader;
-    UINT8*       pWriteHeader;
+    UINT32  writeCnt;
+    UINT32  elemSize;
+    UINT32  padSize = 0;
+    UINT32  freeSize;
+    UINT32  contSize;
 
-    if(elemSize_p > (pInstance->elemSize_m - sizeof(tElemHeader)))
+    if(pInstance_p == NULL || ppElement_p == NULL)
+    {
+        ret = kPsiFifoInvalidParam;
+        goto Exit;
+    }
+
+    if(elemSize_p > pInstance_p->maxElemSize_m)
     {
         ret = kPsiFifoElementSizeOverflow;
         goto Exit;
     }
 
-    numElement = pInstance->numWriteElem_m - pInstance->numReadElem_m;
+    writeCnt = pInstance_p->writeCnt_m;
+    elemSize = FIFO_ALIGN(elemSize_p) + FIFO_ELEM_HEADER_SIZE;
+
+    // Elements are never wrapped -> Skip the rest of the buffer if needed
+    contSize = (pInstance_p->buffMask_m + 1) - (writeCnt & pInstance_p->buffMask_m);
+    if(contSize < elemSize)
+    {
+        padSize = contSize;
+    }
 
-    // Check if FIFO is full
-    if(numElement > pInstance->maxElem_m)
+    freeSize = (pInstance_p->buffMask_m + 1) - (writeCnt - pInstance_p->readCnt_m);
+    if(freeSize < (padSize + elemSize))
     {
         ret = kPsiFifoFull;
         goto Exit;
     }
 
-    elementHeader.size_m = elemSize_p;
+    pInstance_p->padSize_m = padSize;
+    pInstance_p->reserveSize_m = elemSize;
 
-    // Write header to FIFO
-    PSI_MEMCPY(pInstance->pWritePos_m, &elementHeader, sizeof(tElemHeader));
+    *ppElement_p = (UINT8*)getHeader(pInstance_p, writeCnt + padSize) +
+                        FIFO_ELEM_HEADER_SIZE;
 
-    // Move write position header
-    pWriteHeader = pInstance->pWritePos_m + sizeof(tElemHeader);
+Exit:
+    return ret;
+}
 
-    // Post element to FIFO
-    PSI_MEMCPY(pWriteHeader, pElement_p, pInstance->elemSize_m - sizeof(tElemHeader));
+//------------------------------------------------------------------------------
+/**
+\brief    Commit the reserved element to the FIFO
 
-    // Increment write position
-    pInstance->numWriteElem_m++;
+Makes the element written to the reserved space visible to the consumer.
+The committed size can be smaller than the reserved size. This function is
+only called by the producer.
 
-    // Check overflow of write pointer
-    if( pInstance->pWritePos_m >= pInstance->pFifoTail_m)
+\param[in] pInstance_p      Pointer to FIFO instance
+\param[in] elemSize_p       Size of the written element
+
+\return tPsiStatus
+\retval kPsiSuccessful                  On success
+\retval kPsiFifoInvalidParam            Nothing reserved or invalid parameter
+\retval kPsiFifoElementSizeOverflow     Element is larger than the reservation
+
+\ingroup module_fifo
+*/
+//------------------------------------------------------------------------------
+tPsiStatus fifo_commitElement(tFifoInstance pInstance_p, UINT32 elemSize_p)
+{
+    tPsiStatus ret = kPsiSuccessful;
+    UINT32  writeCnt;
+    UINT32  elemSize;
+
+    if(pInstance_p == NULL || pInstance_p->reserveSize_m == 0)
     {
-        pInstance->pWritePos_m = pInstance->pFifoBuffer_m;
+        ret = kPsiFifoInvalidParam;
+        goto Exit;
     }
-    else
+
+    elemSize = FIFO_ALIGN(elemSize_p) + FIFO_ELEM_HEADER_SIZE;
+    if(elemSize > pInstance_p->reserveSize_m)
+    {
+        ret = kPsiFifoElementSizeOverflow;
+        goto Exit;
+    }
+
+    writeCnt = pInstance_p->writeCnt_m;
+
+    if(pInstance_p->padSize_m != 0)
     {
-        pInstance->pWritePos_m = (UINT8 *)((UINT32)pInstance->pWritePos_m +
-                    pInstance->elemSize_m);
+        // Tell the consumer to skip the rest of the buffer
+        getHeader(pInstance_p, writeCnt)->size_m = FIFO_ELEM_PAD;
     }
 
+    getHeader(pInstance_p, writeCnt + pInstance_p->padSize_m)->size_m = elemSize_p;
+
+    // Element needs to be written before it is visible to the consumer
+    PSI_MEMORY_BARRIER();
+
+    pInstance_p->writeCnt_m = writeCnt + pInstance_p->padSize_m + elemSize;
+
+    pInstance_p->reserveSize_m = 0;
+    pInstance_p->padSize_m = 0;
+
 Exit:
     return ret;
 }
 
 //------------------------------------------------------------------------------
 /**
-\brief    Get an element from the FIFO
+\brief    Get the oldest element of the FIFO
+
+Returns a pointer to the oldest element in the FIFO buffer. The element stays
+in the FIFO and the pointer stays valid until it is released with
+fifo_releaseElement(). This function is only called by the consumer.
 
-\param[in]  pInstance       Pointer to FIFO instance
-\param[in]  pElement_p      Pointer to the element to post
-\param[out] pElemSize_p     Size of the returned element
+\param[in]  pInstance_p     Pointer to FIFO instance
+\param[out] ppElement_p     Pointer to the element
+\param[out] pElemSize_p     Size of the element
 
 \return tPsiStatus
-\retval kPsiSuccessful    On success
-\retval kPsiFifoEmpty     FIFO is empty
+\retval kPsiSuccessful          On success
+\retval kPsiFifoInvalidParam    Invalid parameter passed to function
+\retval kPsiFifoEmpty           FIFO is empty
 
 \ingroup module_fifo
 */
 //------------------------------------------------------------------------------
-tPsiStatus fifo_getElement(tFifoInstance pInstance, tFifoElement pElement_p,
+tPsiStatus fifo_peekElement(tFifoInstance pInstance_p, UINT8** ppElement_p,
         UINT32* pElemSize_p)
 {
     tPsiStatus ret = kPsiSuccessful;
-    UINT8        numElement;
-    UINT8*       pReadHeader;
-
-    numElement = pInstance->numWriteElem_m - pInstance->numReadElem_m;
+    tElemHeader* pHeader;
+    UINT32  readCnt;
 
-    if(pElement_p == NULL)
+    if(pInstance_p == NULL || ppElement_p == NULL || pElemSize_p == NULL)
     {
         ret = kPsiFifoInvalidParam;
         goto Exit;
     }
 
-    if(numElement == 0)
+    readCnt = pInstance_p->readCnt_m;
+
+    if(readCnt == pInstance_p->writeCnt_m)
     {
         ret = kPsiFifoEmpty;
         goto Exit;
     }
 
-    // Get size of element
-    PSI_MEMCPY(pElemSize_p, pInstance->pReadPos_m, sizeof(tElemHeader));
+    // Read the element only after the write counter
+    PSI_MEMORY_BARRIER();
 
-    // Move read position header
-    pReadHeader = pInstance->pReadPos_m + sizeof(tElemHeader);
+    pHeader = getHeader(pInstance_p, readCnt);
+    if(pHeader->size_m == FIFO_ELEM_PAD)
+    {
+        // Rest of the buffer is unused -> Element is at the buffer start
+        readCnt += (pInstance_p->buffMask_m + 1) - (readCnt & pInstance_p->buffMask_m);
+        pInstance_p->readCnt_m = readCnt;
 
-    // Get element from FIFO
-    PSI_MEMCPY(pElement_p, pReadHeader, pInstance->elemSize_m - sizeof(tElemHeader));
+        pHeader = getHeader(pInstance_p, readCnt);
+    }
 
-    // Increment read position
-    pInstance->numReadElem_m++;
+    *ppElement_p = (UINT8*)pHeader + FIFO_ELEM_HEADER_SIZE;
+    *pElemSize_p = pHeader->size_m;
 
-    // Check overflow of read pointer
-    if(pInstance->pReadPos_m >= pInstance->pFifoTail_m)
-    {
-        pInstance->pReadPos_m = pInstance->pFifoBuffer_m;
-    }
-    else
+Exit:
+    return ret;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Release the oldest element of the FIFO
+
+Frees the space of the element returned by fifo_peekElement(). This function
+is only called by the consumer.
+
+\param[in] pInstance_p      Pointer to FIFO instance
+
+\return tPsiStatus
+\retval kPsiSuccessful          On success
+\retval kPsiFifoInvalidParam    Invalid parameter passed to function
+\retval kPsiFifoEmpty           FIFO is empty
+
+\ingroup module_fifo
+*/
+//------------------------------------------------------------------------------
+tPsiStatus fifo_releaseElement(tFifoInstance pInstance_p)
+{
+    tPsiStatus ret = kPsiSuccessful;
+    UINT8*  pElement;
+    UINT32  elemSize;
+
+    // Skip a padding header in front of the element
+    ret = fifo_peekElement(pInstance_p, &pElement, &elemSize);
+    if(ret != kPsiSuccessful)
     {
-        pInstance->pReadPos_m = (UINT8 *)((UINT32)pInstance->pReadPos_m +
-                pInstance->elemSize_m);
+        goto Exit;
     }
 
+    // Element needs to be processed before the producer reuses the space
+    PSI_MEMORY_BARRIER();
+
+    pInstance_p->readCnt_m += FIFO_ALIGN(elemSize) + FIFO_ELEM_HEADER_SIZE;
+
 Exit:
     return ret;
 }
@@ -339,23 +454,30 @@ Exit:
 /**
 \brief    Flush the FIFO
 
-\param[in]  pInstance       Pointer to FIFO instance
+Drops all committed elements. This function is only called by the consumer.
+
+\param[in]  pInstance_p       Pointer to FIFO instance
 
 \return tPsiStatus
-\retval kPsiSuccessful    On success
+\retval kPsiSuccessful          On success
+\retval kPsiFifoInvalidParam    Invalid parameter passed to function
 
 \ingroup module_fifo
 */
 //------------------------------------------------------------------------------
-tPsiStatus fifo_flush(tFifoInstance pInstance)
+tPsiStatus fifo_flush(tFifoInstance pInstance_p)
 {
     tPsiStatus ret = kPsiSuccessful;
 
-    // Reset FIFO buffer
-    pInstance->numReadElem_m = 0;
-    pInstance->numWriteElem_m = 0;
-    pInstance->pReadPos_m = pInstance->pFifoBuffer_m;
-    pInstance->pWritePos_m = pInstance->pFifoBuffer_m;
+    if(pInstance_p == NULL)
+    {
+        ret = kPsiFifoInvalidParam;
+    }
+    else
+    {
+        // Consumer owns the read counter -> Catch up with the producer
+        pInstance_p->readCnt_m = pInstance_p->writeCnt_m;
+    }
 
     return ret;
 }
@@ -366,6 +488,24 @@ tPsiStatus fifo_flush(tFifoInstance pInstance)
 /// \name Private Functions
 /// \{
 
+//------------------------------------------------------------------------------
+/**
+\brief    Get the element header at a FIFO position
+
+\param[in] pInstance_p      Pointer to FIFO instance
+\param[in] count_p          Read or write counter of the position
+
+\return tElemHeader*
+\retval Pointer     Pointer to the element header in the FIFO buffer
+
+\ingroup module_fifo
+*/
+//------------------------------------------------------------------------------
+static tElemHeader* getHeader(tFifoInstance pInstance_p, UINT32 count_p)
+{
+    return (tElemHeader*)(pInstance_p->pFifoBuffer_m +
+                (count_p & pInstance_p->buffMask_m));
+}
 
 /// \}
 
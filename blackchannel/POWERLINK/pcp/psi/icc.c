@@ -112,7 +112,7 @@ static tConfChanInInstance          iccInstance_l;
 // local function prototypes
 //------------------------------------------------------------------------------
 
-static tPsiStatus icc_grabObject(tConfChanObject*  pObject_p);
+static tPsiStatus icc_grabObjects(UINT8* pObjCount_p, UINT8* pObjData_p);
 
 //============================================================================//
 //            P U B L I C   F U N C T I O N S                                 //
@@ -240,8 +240,8 @@ Exit:
 /**
 \brief    Process icc object access
 
-Grab an object out of the internal FIFO and forward it to the local object
-dictionary.
+Grab the batch of objects out of the triple buffer and forward it to the
+object list and the local object dictionary.
 
 \return  tPsiStatus
 \retval  kPsiSuccessful                   On success
@@ -255,35 +255,45 @@ tPsiStatus icc_process(void)
 {
     tPsiStatus     ret = kPsiSuccessful;
     tOplkError       oplkret = kErrorOk;
-    tConfChanObject  object;
-
-    PSI_MEMSET(&object, 0, sizeof(tConfChanObject));
+    tConfChanObject* pObject;
+    UINT8            objData[CC_OBJDATA_SIZE];
+    UINT8            objIdList[CC_MAX_BATCH_OBJECTS];
+    UINT8            objCount = 0;
+    UINT8            i;
 
     if(iccInstance_l.fObjIncomming_m)
     {
-        // Incoming element (Update local structures)
-
-        ret = icc_grabObject(&object);
+        // Incoming batch (Update local structures)
+        ret = icc_grabObjects(&objCount, &objData[0]);
         if(ret == kPsiSuccessful)
         {
-            // Update object in object list
-            if(ccobject_writeObject(&object) == FALSE)
+            // Update all objects of the batch in object list
+            if(ccobject_writeObjectBatch(&objData[0], sizeof(objData), objCount,
+                    &objIdList[0]) == FALSE)
             {
-                goto Exit;
+                ret = kPsiConfChanWriteToObjectFailed;
             }
+        }
 
-            // Write object data to local obdict.h
-            oplkret = oplk_writeLocalObject(object.objIdx_m, object.objSubIdx_m,
-                    &object.objPayloadLow_m, object.objSize_m);
-            if(oplkret != kErrorOk)
+        if(ret == kPsiSuccessful)
+        {
+            for(i=0; i < objCount; i++)
             {
-                ret = kPsiConfChanWriteToObDictFailed;
+                pObject = ccobject_readObjectById(objIdList[i]);
+
+                // Write object data to local obdict.h
+                oplkret = oplk_writeLocalObject(pObject->objIdx_m, pObject->objSubIdx_m,
+                        &pObject->objPayloadLow_m, pObject->objSize_m);
+                if(oplkret != kErrorOk)
+                {
+                    ret = kPsiConfChanWriteToObDictFailed;
+                }
             }
         }
         else
         {
             // TODO signal error to application
-            DEBUG_TRACE(DEBUG_LVL_ERROR, "ERROR: Received invalid object from icc channel! Ret: 0x%x!\n", ret);
+            DEBUG_TRACE(DEBUG_LVL_ERROR, "ERROR: Received invalid objects from icc channel! Ret: 0x%x!\n", ret);
             ret = kPsiSuccessful;
         }
 
@@ -294,7 +304,6 @@ tPsiStatus icc_process(void)
         status_setIccStatus(iccInstance_l.currSeq_m);
     }
 
-Exit:
     return ret;
 }
 
@@ -306,87 +315,40 @@ Exit:
 
 //------------------------------------------------------------------------------
 /**
-\brief    Grab object data out of triple buffer
+\brief    Grab a batch of objects out of triple buffer
 
-\param[out] pObject_p     Pointer to the read object data
+\param[out] pObjCount_p    Number of objects in the batch
+\param[out] pObjData_p     Packed objects of the batch (CC_OBJDATA_SIZE bytes)
 
 \return  tPsiStatus
-\retval  kPsiSuccessful        On success
-\retval  kPsiTbuffReadError    Unable to read from the buffer
+\retval  kPsiSuccessful                On success
+\retval  kPsiTbuffReadError            Unable to read from the buffer
+\retval  kPsiConfChanInvalidSizeOfObj  Number of objects exceeds the buffer
 
 \ingroup module_icc
 */
 //------------------------------------------------------------------------------
-static tPsiStatus icc_grabObject(tConfChanObject*  pObject_p)
+static tPsiStatus icc_grabObjects(UINT8* pObjCount_p, UINT8* pObjData_p)
 {
     tPsiStatus           ret = kPsiSuccessful;
-    UINT8                  size;
-
-    // Get object index
-    ret = tbuf_readByte(iccInstance_l.pTbufInstance_m, TBUF_OBJSUBIDX_OFF,
-            &pObject_p->objSubIdx_m);
-    if(ret != kPsiSuccessful)
-    {
-        goto Exit;
-    }
 
-    // Get object subindex
-    ret = tbuf_readWord(iccInstance_l.pTbufInstance_m, TBUF_OBJIDX_OFF,
-            &pObject_p->objIdx_m);
+    // Get number of objects in the batch
+    ret = tbuf_readByte(iccInstance_l.pTbufInstance_m, TBUF_OBJCOUNT_OFF,
+            pObjCount_p);
     if(ret != kPsiSuccessful)
     {
         goto Exit;
     }
 
-    // Grab size from local list
-    if(ccobject_getObjectSize(pObject_p->objIdx_m, pObject_p->objSubIdx_m, &size) == FALSE)
+    if(*pObjCount_p > CC_MAX_BATCH_OBJECTS)
     {
+        ret = kPsiConfChanInvalidSizeOfObj;
         goto Exit;
     }
 
-    // Save object size
-    pObject_p->objSize_m = size;
-
-    switch(size)
-    {
-        case sizeof(UINT8):
-        {
-            ret = tbuf_readByte(iccInstance_l.pTbufInstance_m, TBUF_PAYLOADLOW_OFF,
-                    (UINT8 *)&pObject_p->objPayloadLow_m);
-            break;
-        }
-        case sizeof(UINT16):
-        {
-            ret = tbuf_readWord(iccInstance_l.pTbufInstance_m, TBUF_PAYLOADLOW_OFF,
-                    (UINT16 *)&pObject_p->objPayloadLow_m);
-            break;
-        }
-        case sizeof(UINT32):
-        {
-            ret = tbuf_readDword(iccInstance_l.pTbufInstance_m, TBUF_PAYLOADLOW_OFF,
-                    &pObject_p->objPayloadLow_m);
-            break;
-        }
-        case sizeof(UINT64):
-        {
-            ret = tbuf_readDword(iccInstance_l.pTbufInstance_m, TBUF_PAYLOADLOW_OFF,
-                    &pObject_p->objPayloadLow_m);
-            if(ret != kPsiSuccessful)
-            {
-                goto Exit;
-            }
-
-            ret = tbuf_readDword(iccInstance_l.pTbufInstance_m, TBUF_PAYLOADHIGH_OFF,
-                    &pObject_p->objPayloadHigh_m);
-            break;
-        }
-        default:
-        {
-            ret = kPsiConfChanInvalidSizeOfObj;
-            break;
-        }
-    }
-
+    // Get packed objects (Converted to host order by the object list)
+    ret = tbuf_readStream(iccInstance_l.pTbufInstance_m, TBUF_OBJDATA_OFF,
+            pObjData_p, CC_OBJDATA_SIZE);
 
 Exit:
     return ret;
@@ -47,7 +47,12 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //------------------------------------------------------------------------------
 // const defines
 //------------------------------------------------------------------------------
+#define FIFO_ELEM_HEADER_SIZE       4       ///< Size of the header in front of each element
 
+/**
+ * \brief Maximum element size which fits into a FIFO buffer of size buffSize
+ */
+#define FIFO_MAX_ELEM_SIZE(buffSize)    (((buffSize) / 2) - FIFO_ELEM_HEADER_SIZE)
 
 //------------------------------------------------------------------------------
 // typedef
@@ -56,20 +61,19 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // Create instance type
 typedef struct eFifoInstance    *tFifoInstance;
 
-// Create dummy element
-typedef void*    *tFifoElement;
-
 //------------------------------------------------------------------------------
 // function prototypes
 //------------------------------------------------------------------------------
 tPsiStatus fifo_init(void);
-tFifoInstance fifo_create(UINT32 elemSize_p, UINT8 elemCount_p);
-void fifo_destroy(tFifoInstance pInstance);
-tPsiStatus fifo_insertElement(tFifoInstance pInstance, tFifoElement pElement_p,
-        UINT32 elemSize_p);
-tPsiStatus fifo_getElement(tFifoInstance pInstance, tFifoElement pElement_p,
+tFifoInstance fifo_create(UINT8* pBuffer_p, UINT32 buffSize_p);
+void fifo_destroy(tFifoInstance pInstance_p);
+tPsiStatus fifo_reserveElement(tFifoInstance pInstance_p, UINT32 elemSize_p,
+        UINT8** ppElement_p);
+tPsiStatus fifo_commitElement(tFifoInstance pInstance_p, UINT32 elemSize_p);
+tPsiStatus fifo_peekElement(tFifoInstance pInstance_p, UINT8** ppElement_p,
         UINT32* pElemSize_p);
-tPsiStatus fifo_flush(tFifoInstance pInstance);
+tPsiStatus fifo_releaseElement(tFifoInstance pInstance_p);
+tPsiStatus fifo_flush(tFifoInstance pInstance_p);
 
 #endif /* _INC_psi_fifo_H_ */
 
@@ -53,16 +53,23 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // typedef
 //------------------------------------------------------------------------------
 
+/**
+\brief FIFO instance
+
+The FIFO is a ring of variable length elements. Each element starts with
+a header which holds the size of the element payload. The producer only
+writes the write counter and the consumer only writes the read counter.
+Both counters are running byte counters and are masked with the buffer size.
+*/
 struct eFifoInstance {
-    UINT8  fInstUsed_m;           ///< Instance is already allocated
-    void*  pFifoBuffer_m;         ///< FIFO buffer
-    UINT8* pFifoTail_m;           ///< Last element of the FIFO
-    UINT8* pReadPos_m;            ///< Event FIFO read position pointer
-    UINT8  numReadElem_m;
-    UINT8* pWritePos_m;           ///< Event FIFO write position pointer
-    UINT8  numWriteElem_m;
-    UINT8  maxElem_m;             ///< Maximum number of elements in the FIFO
-    UINT8  elemSize_m;            ///< Size of one element
+    BOOL            fInstUsed_m;        ///< Instance is already allocated
+    UINT8*          pFifoBuffer_m;      ///< FIFO buffer
+    UINT32          buffMask_m;         ///< Size of the FIFO buffer minus one
+    UINT32          maxElemSize_m;      ///< Maximum size of one element payload
+    volatile UINT32 writeCnt_m;         ///< Number of bytes committed by the producer
+    volatile UINT32 readCnt_m;          ///< Number of bytes released by the consumer
+    UINT32          reserveSize_m;      ///< Number of bytes of the reserved element (0: nothing reserved)
+    UINT32          padSize_m;          ///< Number of bytes skipped at the buffer end by the reservation
 };
 
 //------------------------------------------------------------------------------
@@ -47,6 +47,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <psi/tbuf.h>
 
 #include <libpsicommon/timeout.h>
+#include <libpsicommon/logbook.h>
 #include <config/logbook.h>
 
 #include <oplk/oplk.h>
@@ -99,7 +100,8 @@ struct eLogInstance
     tConsTxState      consTxState_m;        ///< State of the consuming transmit buffer
     tSdoComConHdl     sdoComConHdl_m;       ///< SDO connection handler
     tTimeoutInstance  pArpTimeoutInst_m;    ///< Timer for ARP request retry
-    tBuRLogEntry      burLogEntry_m;        ///< The logbook entry converted into the B&R format
+    tBuRLogEntry      burLogEntry_m[LOG_BATCH_MAX_ENTRIES];   ///< The logbook entries converted into the B&R format
+    UINT16            burLogSize_m;         ///< Size of the converted logbook entries
     UINT32            entryCount_m;         ///< The current logbook entry count
 };
 
@@ -56,6 +56,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 //------------------------------------------------------------------------------
 // const defines
 //------------------------------------------------------------------------------
+#define RSSDO_RX_FIFO_SIZE      256     ///< Size of the receive FIFO buffer in bytes (Power of two)
+
+#if (SSDO_STUB_DATA_DOM_SIZE > FIFO_MAX_ELEM_SIZE(RSSDO_RX_FIFO_SIZE))
+#error "RSSDO_RX_FIFO_SIZE is too small to hold the SSDO stub data object"
+#endif
 
 //------------------------------------------------------------------------------
 // typedef
@@ -70,14 +75,6 @@ typedef enum {
     kProdRxStateRepostFrame        = 0x02,
 } tProdRxState;
 
-/**
- * \brief
- */
-typedef struct {
-    UINT8    ssdoStubDataBuff_m[SSDO_STUB_DATA_DOM_SIZE];
-    UINT32   ssdoStubSize_m;
-} tProdRxBuffer;
-
 /**
 \brief SSDO channel user instance
 
@@ -91,7 +88,7 @@ struct eRssdoInstance
     tFifoInstance     pRxFifoInst_m;        ///< producing receive FIFO instance pointer
     tProdRxState      prodRxState_m;        ///< State of the producing receive buffer
     tSeqNrValue       currProdSeq_m;        ///< Current producing buffer sequence number
-    tProdRxBuffer     prodRecvBuff_m;       ///< Producing receive buffer for packet retransmission
+    UINT32            rxFifoBuff_m[RSSDO_RX_FIFO_SIZE / 4];   ///< Buffer of the receive FIFO (Holds the frame until it is posted)
     tTimeoutInstance  pTimeoutInst_m;       ///< Timer for SSDO transmissions over the tbuf
     UINT16            objSize_m;            ///< Size of incomming object
 };
@@ -76,8 +76,6 @@ tRssdoInstance rssdo_create(tRssdoInitStruct* pInitParam_p);
 void rssdo_destroy(tRssdoInstance pInstance_p);
 tPsiStatus rssdo_process(tRssdoInstance pInstance_p);
 
-tPsiStatus rssdo_processSync(tRssdoInstance pInstance_p);
-
 #endif /* _INC_psi_rrssdo_H_ */
 
 
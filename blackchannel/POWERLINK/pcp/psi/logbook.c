@@ -114,6 +114,8 @@ static tPsiStatus verifyTargetInfo(UINT8 targNode_p, UINT16 targIdx_p,
 static tPsiStatus reformatLogEntry(tBuRLogEntry * pBurLog_p,
                                      tLogFormat * pLogEntry_p,
                                      UINT32 * pEntryCnt_p);
+static tPsiStatus reformatLogBatch(tLogInstance pInstance_p,
+                                   tLogBatchFormat * pLogBatch_p);
 static UINT64 convertNetTime(tNetTime * pNetTime_p);
 
 //============================================================================//
@@ -343,9 +345,6 @@ tPsiStatus log_handleIncoming(tLogInstance pInstance_p)
         goto Exit;
     }
 
-    // Increment cycle counter for ARP retry timer
-    timeout_incrementCounter(pInstance_p->pArpTimeoutInst_m);
-
     if(pInstance_p->consTxState_m != kConsTxStateWaitForFrame)
     {
         // Object access is currently in progress -> do nothing here!
@@ -453,16 +452,26 @@ static tPsiStatus processTransmitSm(tLogInstance pInstance_p)
             }
 
             // Adapt logging message to fit to BuR style
-            ret = reformatLogEntry(&pInstance_p->burLogEntry_m, pLogData, &pInstance_p->entryCount_m);
+            if((pLogData->level_m & LOG_BATCH_FLAG) != 0)
+            {
+                // Unpack all compact entries of the batch
+                ret = reformatLogBatch(pInstance_p, (tLogBatchFormat *)pLogData);
+            }
+            else
+            {
+                ret = reformatLogEntry(&pInstance_p->burLogEntry_m[0], pLogData, &pInstance_p->entryCount_m);
+                pInstance_p->burLogSize_m = sizeof(tBuRLogEntry);
+            }
+
             if(ret != kPsiSuccessful)
             {
                 ret = kPsiLogEntryReformatFailed;
                 goto Exit;
             }
 
-            // Forward object access to target node
+            // Forward all entries to the target node in one object access
             ret = sendToDestTarget(pInstance_p, &targNode, &targIdx, &targSubIdx,
-                    (UINT8*)&pInstance_p->burLogEntry_m, sizeof(tBuRLogEntry));
+                    (UINT8*)&pInstance_p->burLogEntry_m[0], pInstance_p->burLogSize_m);
             if(ret != kPsiSuccessful)
             {
                 goto Exit;
@@ -491,7 +500,7 @@ static tPsiStatus processTransmitSm(tLogInstance pInstance_p)
         {
             // Forward object access to target node
             ret = sendToDestTarget(pInstance_p, &targNode, &targIdx, &targSubIdx,
-                    (UINT8*)&pInstance_p->burLogEntry_m, sizeof(tBuRLogEntry));
+                    (UINT8*)&pInstance_p->burLogEntry_m[0], pInstance_p->burLogSize_m);
             if(ret != kPsiSuccessful)
             {
                 goto Exit;
@@ -718,6 +727,61 @@ static tPsiStatus reformatLogEntry(tBuRLogEntry * pBurLog_p,
     return ret;
 }
 
+//------------------------------------------------------------------------------
+/**
+\brief    Reformat a batch of compact log entries to B&R internal style
+
+Each compact entry is expanded to the internal format and converted into one
+B&R logbook entry. All entries are transferred in a single object access.
+
+\param[in]  pInstance_p             Log instance handle
+\param[in]  pLogBatch_p             The batch of compact logbook entries
+
+\retval kPsiSuccessful            Reformat of all entries successful
+\retval kPsiLogInvalidErrorLevel  Invalid entry count or error level
+
+\ingroup module_log
+*/
+//------------------------------------------------------------------------------
+static tPsiStatus reformatLogBatch(tLogInstance pInstance_p,
+                                   tLogBatchFormat * pLogBatch_p)
+{
+    tPsiStatus ret = kPsiSuccessful;
+    tLogFormat logEntry;
+    tLogCompactFormat * pCompact;
+    UINT8 entryCount;
+    UINT8 i;
+
+    entryCount = pLogBatch_p->header_m & LOG_BATCH_COUNT_MASK;
+    if(entryCount == 0 || entryCount > LOG_BATCH_MAX_ENTRIES)
+    {
+        ret = kPsiLogInvalidErrorLevel;
+        goto Exit;
+    }
+
+    for(i = 0; i < entryCount; i++)
+    {
+        pCompact = &pLogBatch_p->entry_m[i];
+
+        logEntry.level_m = pCompact->levelSource_m >> LOG_COMPACT_LEVEL_SHIFT;
+        logEntry.source_m = pCompact->levelSource_m & LOG_COMPACT_SOURCE_MASK;
+        logEntry.code_m = pCompact->code_m;
+        logEntry.addInfo_m = pCompact->addInfo_m;
+
+        ret = reformatLogEntry(&pInstance_p->burLogEntry_m[i], &logEntry,
+                &pInstance_p->entryCount_m);
+        if(ret != kPsiSuccessful)
+        {
+            goto Exit;
+        }
+    }
+
+    pInstance_p->burLogSize_m = entryCount * sizeof(tBuRLogEntry);
+
+Exit:
+    return ret;
+}
+
 //------------------------------------------------------------------------------
 /**
 \brief    Convert the Nettime format to milliseconds
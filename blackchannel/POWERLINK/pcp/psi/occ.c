@@ -95,7 +95,7 @@ output triple buffer.
 typedef struct
 {
     tTbufInstance        pTbufInstance_m;      ///< Instance pointer to the triple buffer
-    UINT8                fSeqNr_m;             ///< Sequence flag to indicate new data
+    UINT8                seqNr_m;              ///< Running sequence number to indicate new data
     UINT16               objSize_m;            ///< Size of an incomming object
 } tConfChanOutInstance;
 
@@ -109,7 +109,8 @@ static tConfChanOutInstance          occInstance_l;
 // local function prototypes
 //------------------------------------------------------------------------------
 
-static tPsiStatus occ_postObject(UINT8 seqNr_p, tConfChanObject* pObject_p);
+static tPsiStatus occ_postObjects(UINT8 seqNr_p, UINT8 objCount_p,
+        UINT8* pObjData_p, UINT8 dataSize_p);
 
 //============================================================================//
 //            P U B L I C   F U N C T I O N S                                 //
@@ -178,7 +179,8 @@ void occ_exit(void)
 /**
 \brief    Handle outgoing objects
 
-Grab the next object out of the object list and forward it to the triple buffer.
+Grab the changed objects out of the object list and forward them as one batch
+to the triple buffer. If no object changed, the buffer is left untouched.
 (This function is called in interrupt context)
 
 \return  tPsiStatus
@@ -192,22 +194,22 @@ Grab the next object out of the object list and forward it to the triple buffer.
 tPsiStatus occ_handleOutgoing(void)
 {
     tPsiStatus ret = kPsiSuccessful;
-    tConfChanObject *pObject;
+    UINT8 objData[CC_OBJDATA_SIZE];
+    UINT8 objCount = 0;
+    UINT8 dataSize;
 
-    // Get object from object list
-    pObject = ccobject_readCurrObject();
-    if(pObject == NULL)
+    // Pack the changed objects (and the periodic refresh) into one buffer
+    dataSize = ccobject_packDirtyObjects(&objData[0], sizeof(objData), &objCount);
+    if(objCount == 0)
     {
         goto Exit;
     }
 
-    // Change sequence flag
-    if(occInstance_l.fSeqNr_m == 0x00)
-        occInstance_l.fSeqNr_m = 0x01;
-    else
-        occInstance_l.fSeqNr_m = 0x00;
+    // Count the batches, so the AP can't mistake a batch for an older one
+    // when it misses some of them
+    occInstance_l.seqNr_m++;
 
-    ret = occ_postObject(occInstance_l.fSeqNr_m, pObject);
+    ret = occ_postObjects(occInstance_l.seqNr_m, objCount, &objData[0], dataSize);
     if(ret != kPsiSuccessful)
     {
         goto Exit;
@@ -220,9 +222,6 @@ tPsiStatus occ_handleOutgoing(void)
         goto Exit;
     }
 
-    // Step to next object
-    ccobject_incObjReadPointer();
-
 Exit:
     return ret;
 }
@@ -285,10 +284,12 @@ Exit:
 
 //------------------------------------------------------------------------------
 /**
-\brief    Write object to triple buffer
+\brief    Write a batch of objects to triple buffer
 
 \param[in] seqNr_p       Sequence number of the new message
-\param[in] pObject_p     Pointer to object data to write
+\param[in] objCount_p    Number of objects in the batch
+\param[in] pObjData_p    Pointer to the packed objects
+\param[in] dataSize_p    Size of the packed objects
 
 \return  tPsiStatus
 \retval  kPsiSuccessful              On success
@@ -297,7 +298,8 @@ Exit:
 \ingroup module_occ
 */
 //------------------------------------------------------------------------------
-static tPsiStatus occ_postObject(UINT8 seqNr_p, tConfChanObject* pObject_p)
+static tPsiStatus occ_postObjects(UINT8 seqNr_p, UINT8 objCount_p,
+        UINT8* pObjData_p, UINT8 dataSize_p)
 {
     tPsiStatus ret = kPsiSuccessful;
 
@@ -308,60 +310,16 @@ static tPsiStatus occ_postObject(UINT8 seqNr_p, tConfChanObject* pObject_p)
         goto Exit;
     }
 
-    ret = tbuf_writeByte(occInstance_l.pTbufInstance_m, TBUF_OBJSUBIDX_OFF,
-            pObject_p->objSubIdx_m);
+    ret = tbuf_writeByte(occInstance_l.pTbufInstance_m, TBUF_OBJCOUNT_OFF,
+            objCount_p);
     if(ret != kPsiSuccessful)
     {
         goto Exit;
     }
 
-    ret = tbuf_writeWord(occInstance_l.pTbufInstance_m, TBUF_OBJIDX_OFF,
-            pObject_p->objIdx_m);
-    if(ret != kPsiSuccessful)
-    {
-        goto Exit;
-    }
-
-    switch(pObject_p->objSize_m)
-    {
-        case sizeof(UINT8):
-        {
-            ret = tbuf_writeByte(occInstance_l.pTbufInstance_m, TBUF_PAYLOADLOW_OFF,
-                    pObject_p->objPayloadLow_m);
-            break;
-        }
-        case sizeof(UINT16):
-        {
-            ret = tbuf_writeWord(occInstance_l.pTbufInstance_m, TBUF_PAYLOADLOW_OFF,
-                    pObject_p->objPayloadLow_m);
-            break;
-        }
-        case sizeof(UINT32):
-        {
-            ret = tbuf_writeDword(occInstance_l.pTbufInstance_m, TBUF_PAYLOADLOW_OFF,
-                    pObject_p->objPayloadLow_m);
-            break;
-        }
-        case sizeof(UINT64):
-        {
-            ret = tbuf_writeDword(occInstance_l.pTbufInstance_m, TBUF_PAYLOADLOW_OFF,
-                    pObject_p->objPayloadLow_m);
-            if(ret != kPsiSuccessful)
-            {
-                goto Exit;
-            }
-
-            ret = tbuf_writeDword(occInstance_l.pTbufInstance_m, TBUF_PAYLOADHIGH_OFF,
-                    pObject_p->objPayloadHigh_m);
-            break;
-        }
-        default:
-        {
-            ret = kPsiConfChanInvalidSizeOfObj;
-            break;
-        }
-    }
-
+    // Objects are already packed in little endian order
+    ret = tbuf_writeStream(occInstance_l.pTbufInstance_m, TBUF_OBJDATA_OFF,
+            pObjData_p, dataSize_p);
 
 Exit:
     return ret;
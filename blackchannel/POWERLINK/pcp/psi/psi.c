@@ -63,6 +63,7 @@ the synchronous and asynchronous tasks.
 #include <psi/logbook.h>
 #include <psi/fifo.h>
 #include <libpsicommon/ccobject.h>
+#include <libpsicommon/timeout.h>
 #include <debug.h>
 
 #include <config/ccobjectlist.h>
@@ -219,6 +220,8 @@ tPsiStatus psi_init(UINT8 nodeId_p, tPsiCritSec pfnCritSec_p)
         goto Exit;
     }
 
+    timeout_init();
+
 #if(((PSI_MODULE_INTEGRATION) & (PSI_MODULE_SSDO)) != 0)
     rssdo_init(psiInstance_l.nodeId_m, SSDO_STUB_OBJECT_INDEX, SSDO_STUB_DATA_OBJECT_INDEX);
     tssdo_init(psiInstance_l.nodeId_m, SSDO_STUB_OBJECT_INDEX, SSDO_STUB_DATA_OBJECT_INDEX);
@@ -568,6 +571,9 @@ tPsiStatus psi_handleSync(tNetTime * pNetTime_p)
     UNUSED_PARAMETER(pNetTime_p);
 #endif
 
+    // Advance the timers of all channels by one cycle
+    timeout_processSync();
+
 #if(((PSI_MODULE_INTEGRATION) & (PSI_MODULE_CC)) != 0)
     // Handle configuration channel module
     ret = occ_handleOutgoing();
@@ -594,14 +600,6 @@ tPsiStatus psi_handleSync(tNetTime * pNetTime_p)
                     "instance %d with: 0x%x!\n", i, ret);
             goto Exit;
         }
-
-        ret = rssdo_processSync(psiInstance_l.instRssdoChan_m[i]);
-        if(ret != kPsiSuccessful)
-        {
-            DEBUG_TRACE(DEBUG_LVL_ERROR, "ERROR: rssdo_processSync() failed for "
-                    "instance %d with: 0x%x!\n", i, ret);
-            goto Exit;
-        }
     }
 #endif
 
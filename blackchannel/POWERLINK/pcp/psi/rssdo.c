@@ -81,8 +81,8 @@ extern tOplkError rssdo_obdAccessCb(tObdAlConHdl* pParam_p);
 //------------------------------------------------------------------------------
 // const defines
 //------------------------------------------------------------------------------
-#define SSDO_RECEIVE_FIFO_ELEM_COUNT       5      ///< Number of elements in the receive FIFO
 #define SSDO_RX_TIMEOUT_CYCLE_COUNT        400    ///< Number of cycles after a transmit has a timeout
+#define SSDO_RX_MIN_TIMEOUT_CYCLE_COUNT    100    ///< Lowest timeout the measured round trip time can select
 
 //------------------------------------------------------------------------------
 // local types
@@ -182,8 +182,8 @@ tRssdoInstance rssdo_create(tRssdoInitStruct* pInitParam_p)
 
     // Initialize the frame receive FIFO
     rssdoInstance_l[pInitParam_p->chanId_m].pRxFifoInst_m = fifo_create(
-            sizeof(rssdoInstance_l[pInitParam_p->chanId_m].prodRecvBuff_m.ssdoStubDataBuff_m),
-            SSDO_RECEIVE_FIFO_ELEM_COUNT);
+            (UINT8*)&rssdoInstance_l[pInitParam_p->chanId_m].rxFifoBuff_m[0],
+            sizeof(rssdoInstance_l[pInitParam_p->chanId_m].rxFifoBuff_m));
     if(rssdoInstance_l[pInitParam_p->chanId_m].pRxFifoInst_m == NULL)
     {
         goto Exit;
@@ -197,6 +197,10 @@ tRssdoInstance rssdo_create(tRssdoInitStruct* pInitParam_p)
         goto Exit;
     }
 
+    // Let the round trip time lower the timeout down to the floor
+    timeout_setMinCycleLimit(rssdoInstance_l[pInitParam_p->chanId_m].pTimeoutInst_m,
+            SSDO_RX_MIN_TIMEOUT_CYCLE_COUNT);
+
     // Remember channel id
     rssdoInstance_l[pInitParam_p->chanId_m].instId_m = pInitParam_p->chanId_m;
 
@@ -289,6 +293,8 @@ tPsiStatus rssdo_process(tRssdoInstance pInstance_p)
         chanRet = checkChannelStatus(pInstance_p);
         if(chanRet == kPsiSuccessful)
         {
+            // Adapt the timeout to the measured round trip time
+            timeout_updateRtt(pInstance_p->pTimeoutInst_m);
             timeout_stopTimer(pInstance_p->pTimeoutInst_m);
         }
     }
@@ -297,35 +303,6 @@ Exit:
     return ret;
 }
 
-//------------------------------------------------------------------------------
-/**
-\brief    Process the synchronous task of the receive SSDO channel
-
-\param[in] pInstance_p           Pointer to the instance
-
-\retval kPsiSuccessful               On success
-\retval kPsiSsdoInvalidParameter     On an invalid instance
-
-\ingroup module_ssdo
-*/
-//------------------------------------------------------------------------------
-tPsiStatus rssdo_processSync(tRssdoInstance pInstance_p)
-{
-    tPsiStatus ret = kPsiSuccessful;
-
-    if(pInstance_p == NULL)
-    {
-        ret = kPsiSsdoInvalidParameter;
-        goto Exit;
-    }
-
-    // Increment cycle count transmit timer
-    timeout_incrementCounter(pInstance_p->pTimeoutInst_m);
-
-Exit:
-    return ret;
-}
-
 //------------------------------------------------------------------------------
 /**
 \brief    SSDO module object access occurred
@@ -350,6 +327,7 @@ tOplkError rssdo_obdAccessCb(tObdAlConHdl* pParam_p)
     tPsiStatus ret = kPsiSuccessful;
     tOplkError oplkret = kErrorOk;
     tRssdoInstance  pInstance;
+    UINT8*          pRxElement;
 
     if(pParam_p == NULL)
     {
@@ -382,18 +360,19 @@ tOplkError rssdo_obdAccessCb(tObdAlConHdl* pParam_p)
         pInstance->objSize_m = pParam_p->totalPendSize;
     }
 
-    // Post frame to receive FIFO
-    ret = fifo_insertElement(pInstance->pRxFifoInst_m,
-                            (tFifoElement) pParam_p->pSrcData,
-                            pInstance->objSize_m);
-    if(ret != kPsiSuccessful)
+    // Write frame directly to the receive FIFO
+    ret = fifo_reserveElement(pInstance->pRxFifoInst_m, pInstance->objSize_m,
+                            &pRxElement);
+    if(ret == kPsiSuccessful)
     {
-        oplkret = kErrorObdAccessViolation;
+        PSI_MEMCPY(pRxElement, pParam_p->pSrcData, pInstance->objSize_m);
+
+        ret = fifo_commitElement(pInstance->pRxFifoInst_m, pInstance->objSize_m);
     }
-    else
+
+    if(ret != kPsiSuccessful)
     {
-        // Start timeout timer for this frame!
-        timeout_startTimer(pInstance->pTimeoutInst_m);
+        oplkret = kErrorObdAccessViolation;
     }
 
 Exit:
@@ -410,8 +389,8 @@ Exit:
 /**
 \brief    Process the frame receive state machine
 
-Implements the SSDO receive state machine. Reads the frame from the
-FIFO and forwards it to the triple buffer.
+Implements the SSDO receive state machine. Forwards the oldest frame of the
+FIFO to the triple buffer. The frame stays in the FIFO until it is posted.
 
 \param[in] pInstance_p               Pointer to the local instance
 
@@ -424,15 +403,16 @@ FIFO and forwards it to the triple buffer.
 static tPsiStatus processReceiveSm(tRssdoInstance pInstance_p)
 {
     tPsiStatus ret = kPsiSuccessful;
+    UINT8*     pRxElement;
+    UINT32     rxSize;
 
     switch(pInstance_p->prodRxState_m)
     {
         case kProdRxStateWaitForFrame:
         {
             // Get frame from receive FIFO
-            ret = fifo_getElement(pInstance_p->pRxFifoInst_m,
-                    (tFifoElement)&pInstance_p->prodRecvBuff_m.ssdoStubDataBuff_m,
-                    &pInstance_p->prodRecvBuff_m.ssdoStubSize_m);
+            ret = fifo_peekElement(pInstance_p->pRxFifoInst_m, &pRxElement,
+                    &rxSize);
             switch(ret)
             {
                 case kPsiFifoEmpty:
@@ -443,12 +423,11 @@ static tPsiStatus processReceiveSm(tRssdoInstance pInstance_p)
                 }
                 case kPsiSuccessful:
                 {
-                    ret = handleReceiveFrame(pInstance_p,
-                            pInstance_p->prodRecvBuff_m.ssdoStubDataBuff_m,
-                            pInstance_p->prodRecvBuff_m.ssdoStubSize_m);
+                    ret = handleReceiveFrame(pInstance_p, pRxElement, rxSize);
                     if(ret == kPsiSuccessful)
                     {
                         // Frame posted successfully -> Get next frame!
+                        ret = fifo_releaseElement(pInstance_p->pRxFifoInst_m);
                         pInstance_p->prodRxState_m = kProdRxStateWaitForFrame;
                     }
                     else if(kPsiSsdoNoFreeBuffer)
@@ -470,13 +449,20 @@ static tPsiStatus processReceiveSm(tRssdoInstance pInstance_p)
         }
         case kProdRxStateRepostFrame:
         {
+            // Frame is still the oldest element of the FIFO
+            ret = fifo_peekElement(pInstance_p->pRxFifoInst_m, &pRxElement,
+                    &rxSize);
+            if(ret != kPsiSuccessful)
+            {
+                goto Exit;
+            }
+
             // Try to post frame to local triple buffer
-            ret = handleReceiveFrame(pInstance_p,
-                    pInstance_p->prodRecvBuff_m.ssdoStubDataBuff_m,
-                    pInstance_p->prodRecvBuff_m.ssdoStubSize_m);
+            ret = handleReceiveFrame(pInstance_p, pRxElement, rxSize);
             if(ret == kPsiSuccessful)
             {
                 // Frame posted successfully -> Activate blocking mechanism
+                ret = fifo_releaseElement(pInstance_p->pRxFifoInst_m);
                 pInstance_p->prodRxState_m = kProdRxStateWaitForFrame;
             }
             else if(kPsiSsdoNoFreeBuffer)
@@ -577,6 +563,9 @@ static tPsiStatus handleReceiveFrame(tRssdoInstance pInstance_p,
         goto Exit;
     }
 
+    // Frame is posted -> Start timeout timer for the answer of the AP
+    timeout_startTimer(pInstance_p->pTimeoutInst_m);
+
 Exit:
     return ret;
 }
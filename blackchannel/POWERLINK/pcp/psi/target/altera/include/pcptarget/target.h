@@ -47,6 +47,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <unistd.h>    // for usleep
 #include <stdlib.h>    // for malloc, free
 #include <string.h>    // for memcpy() memset()
+#include <sys/alt_irq.h>    // for alt_irq_disable_all()
 
 //------------------------------------------------------------------------------
 // const defines
@@ -81,6 +82,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // Guard standard library functions
 #define PSI_MEMSET(ptr, bVal, bCnt)  memset(ptr, bVal, bCnt)
 #define PSI_MEMCPY(ptr, bVal, bSize) memcpy(ptr, bVal, bSize)
+#define PSI_MEMCMP(ptr1, ptr2, bSize) memcmp(ptr1, ptr2, bSize)
 #define PSI_USLEEP(x)                usleep(x)
 #define PSI_MALLOC(siz)              malloc(siz)
 #define PSI_FREE(ptr)                free(ptr)
@@ -89,6 +91,13 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #define PACK_STRUCT __attribute__((packed))
 
+#define PSI_INLINE static inline
+
+// Atomic operations for lock-free data structures (Nios II has no atomic
+// instructions, therefore the swap is guarded by masking all interrupts)
+#define PSI_ATOMIC_CAS(pVal, oldVal, newVal) target_atomicCas(pVal, oldVal, newVal)
+#define PSI_MEMORY_BARRIER()                 __asm__ __volatile__("" ::: "memory")
+
 //------------------------------------------------------------------------------
 // typedef
 //------------------------------------------------------------------------------
@@ -102,6 +111,37 @@ void target_setStatusLed(BOOL fOn_p);
 void target_setErrorLed(BOOL fOn_p);
 void target_criticalSection(BYTE fEnable_p);
 
+//------------------------------------------------------------------------------
+/**
+\brief    Atomically replace a value if it still holds the expected value
+
+\param[inout] pVal_p        Pointer to the value to swap
+\param[in]    oldVal_p      The expected current value
+\param[in]    newVal_p      The new value
+
+\retval TRUE     Value was swapped
+\retval FALSE    Value was changed by someone else
+*/
+//------------------------------------------------------------------------------
+PSI_INLINE BOOL target_atomicCas(volatile UINT32* pVal_p, UINT32 oldVal_p,
+        UINT32 newVal_p)
+{
+    BOOL fSwapped = FALSE;
+    alt_irq_context context;
+
+    context = alt_irq_disable_all();
+
+    if(*pVal_p == oldVal_p)
+    {
+        *pVal_p = newVal_p;
+        fSwapped = TRUE;
+    }
+
+    alt_irq_enable_all(context);
+
+    return fSwapped;
+}
+
 #endif /* _INC_pcptarget_H_ */
 
 
@@ -309,9 +309,6 @@ tPsiStatus tssdo_handleIncoming(tTssdoInstance pInstance_p)
         goto Exit;
     }
 
-    // Increment cycle counter for ARP retry timer
-    timeout_incrementCounter(pInstance_p->pArpTimeoutInst_m);
-
     if(pInstance_p->consTxState_m != kConsTxStateWaitForFrame)
     {
         // Object access is currently in progress -> do nothing here!
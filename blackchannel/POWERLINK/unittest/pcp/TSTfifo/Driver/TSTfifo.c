@@ -0,0 +1,464 @@
+/**
+********************************************************************************
+\file   TSTfifo.c
+
+\brief  Test the FIFO module of the PCP
+
+This driver tests the variable length elements of the FIFO, the padding at
+the end of the buffer and the running read and write counters.
+
+\ingroup module_unittests
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2013 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+//------------------------------------------------------------------------------
+// includes
+//------------------------------------------------------------------------------
+#include <cunit/CUnit.h>
+
+#include <Driver/TSTfifoConfig.h>
+
+#include <psi/fifo.h>
+#include <psi/internal/fifo.h>
+
+//============================================================================//
+//            G L O B A L   D E F I N I T I O N S                             //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// module global vars
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// global function prototypes
+//------------------------------------------------------------------------------
+
+//============================================================================//
+//            P R I V A T E   D E F I N I T I O N S                           //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+#define FIFO_BUFF_SIZE          64      ///< Size of the FIFO buffer under test
+#define FIFO_MAX_SIZE           FIFO_MAX_ELEM_SIZE(FIFO_BUFF_SIZE)  ///< Largest element
+
+//------------------------------------------------------------------------------
+// local types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local vars
+//------------------------------------------------------------------------------
+static UINT32 fifoBuff_l[FIFO_BUFF_SIZE / sizeof(UINT32)];
+
+//------------------------------------------------------------------------------
+// local function prototypes
+//------------------------------------------------------------------------------
+static tFifoInstance createFifo(void);
+static tPsiStatus pushElement(tFifoInstance pInstance_p, UINT32 elemSize_p,
+        UINT8 pattern_p);
+static void popElement(tFifoInstance pInstance_p, UINT32 elemSize_p,
+        UINT8 pattern_p);
+
+//============================================================================//
+//            P U B L I C   F U N C T I O N S                                 //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test the creation of FIFO instances with invalid buffers
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_fifoCreate(void)
+{
+    tFifoInstance pInstance;
+
+    CU_ASSERT_EQUAL( fifo_init(), kPsiSuccessful );
+
+    // Invalid buffer address
+    CU_ASSERT_PTR_NULL( fifo_create(NULL, FIFO_BUFF_SIZE) );
+    CU_ASSERT_PTR_NULL( fifo_create((UINT8*)fifoBuff_l + 1, FIFO_BUFF_SIZE) );
+
+    // Size is not a power of two or too small for one element
+    CU_ASSERT_PTR_NULL( fifo_create((UINT8*)fifoBuff_l, FIFO_BUFF_SIZE - 4) );
+    CU_ASSERT_PTR_NULL( fifo_create((UINT8*)fifoBuff_l, 2 * FIFO_ELEM_HEADER_SIZE) );
+
+    pInstance = fifo_create((UINT8*)fifoBuff_l, FIFO_BUFF_SIZE);
+
+    CU_ASSERT_PTR_NOT_NULL( pInstance );
+    CU_ASSERT_EQUAL( pInstance->maxElemSize_m, FIFO_MAX_SIZE );
+
+    // A destroyed instance is free for the next FIFO
+    fifo_destroy(pInstance);
+
+    CU_ASSERT_PTR_EQUAL( fifo_create((UINT8*)fifoBuff_l, FIFO_BUFF_SIZE), pInstance );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test the empty and the full FIFO
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_fifoEmptyFull(void)
+{
+    tFifoInstance pInstance;
+    UINT8* pElement;
+    UINT32 elemSize;
+    UINT8 i;
+
+    pInstance = createFifo();
+
+    CU_ASSERT_EQUAL( fifo_peekElement(pInstance, &pElement, &elemSize), kPsiFifoEmpty );
+    CU_ASSERT_EQUAL( fifo_releaseElement(pInstance), kPsiFifoEmpty );
+
+    // Five elements with header use 60 of 64 bytes
+    for(i = 0; i < 5; i++)
+    {
+        CU_ASSERT_EQUAL( pushElement(pInstance, 8, i), kPsiSuccessful );
+    }
+
+    // Only an element without payload fits into the rest of the buffer
+    CU_ASSERT_EQUAL( fifo_reserveElement(pInstance, 8, &pElement), kPsiFifoFull );
+    CU_ASSERT_EQUAL( pushElement(pInstance, 0, 0), kPsiSuccessful );
+    CU_ASSERT_EQUAL( pInstance->writeCnt_m - pInstance->readCnt_m, FIFO_BUFF_SIZE );
+    CU_ASSERT_EQUAL( fifo_reserveElement(pInstance, 0, &pElement), kPsiFifoFull );
+
+    // Elements are returned in the order of the commit
+    for(i = 0; i < 5; i++)
+    {
+        popElement(pInstance, 8, i);
+    }
+    popElement(pInstance, 0, 0);
+
+    CU_ASSERT_EQUAL( fifo_peekElement(pInstance, &pElement, &elemSize), kPsiFifoEmpty );
+    CU_ASSERT_EQUAL( pInstance->readCnt_m, pInstance->writeCnt_m );
+
+    // Invalid parameters
+    CU_ASSERT_EQUAL( fifo_reserveElement(NULL, 8, &pElement), kPsiFifoInvalidParam );
+    CU_ASSERT_EQUAL( fifo_reserveElement(pInstance, 8, NULL), kPsiFifoInvalidParam );
+    CU_ASSERT_EQUAL( fifo_peekElement(NULL, &pElement, &elemSize), kPsiFifoInvalidParam );
+    CU_ASSERT_EQUAL( fifo_peekElement(pInstance, &pElement, NULL), kPsiFifoInvalidParam );
+    CU_ASSERT_EQUAL( fifo_releaseElement(NULL), kPsiFifoInvalidParam );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test the padding of the rest of the buffer
+
+An element is never wrapped around the buffer end. If it doesn't fit into the
+rest of the buffer, this space is skipped and the element starts at the
+beginning of the buffer.
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_fifoWrapPadding(void)
+{
+    tFifoInstance pInstance;
+    UINT8* pElement;
+    UINT32 elemSize;
+
+    pInstance = createFifo();
+
+    // Two elements of 24 bytes leave 16 bytes at the buffer end
+    CU_ASSERT_EQUAL( pushElement(pInstance, 20, 0xA1), kPsiSuccessful );
+    CU_ASSERT_EQUAL( pushElement(pInstance, 20, 0xA2), kPsiSuccessful );
+
+    // Occupied buffer start -> Padding and element don't fit
+    CU_ASSERT_EQUAL( fifo_reserveElement(pInstance, 20, &pElement), kPsiFifoFull );
+
+    // The rest of the buffer is too small -> Element starts at the buffer begin
+    popElement(pInstance, 20, 0xA1);
+    CU_ASSERT_EQUAL( fifo_reserveElement(pInstance, 20, &pElement), kPsiSuccessful );
+    CU_ASSERT_PTR_EQUAL( pElement, (UINT8*)fifoBuff_l + FIFO_ELEM_HEADER_SIZE );
+
+    PSI_MEMSET(pElement, 0xA3, 20);
+    CU_ASSERT_EQUAL( fifo_commitElement(pInstance, 20), kPsiSuccessful );
+
+    // Padding and element are committed together
+    CU_ASSERT_EQUAL( pInstance->writeCnt_m, FIFO_BUFF_SIZE + 24 );
+
+    // The consumer skips the padding behind the second element
+    popElement(pInstance, 20, 0xA2);
+
+    CU_ASSERT_EQUAL( fifo_peekElement(pInstance, &pElement, &elemSize), kPsiSuccessful );
+    CU_ASSERT_PTR_EQUAL( pElement, (UINT8*)fifoBuff_l + FIFO_ELEM_HEADER_SIZE );
+    CU_ASSERT_EQUAL( elemSize, 20 );
+
+    popElement(pInstance, 20, 0xA3);
+
+    CU_ASSERT_EQUAL( pInstance->readCnt_m, pInstance->writeCnt_m );
+
+    // An element which exactly fills the rest of the buffer needs no padding
+    CU_ASSERT_EQUAL( pushElement(pInstance, 20, 0xB1), kPsiSuccessful );
+    CU_ASSERT_EQUAL( pushElement(pInstance, 12, 0xB2), kPsiSuccessful );
+    CU_ASSERT_EQUAL( pInstance->writeCnt_m, 2 * FIFO_BUFF_SIZE );
+
+    popElement(pInstance, 20, 0xB1);
+    popElement(pInstance, 12, 0xB2);
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test the maximum element size
+
+An element of maximum size fits into the empty FIFO at every buffer position.
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_fifoMaxElemSize(void)
+{
+    tFifoInstance pInstance;
+    UINT8* pElement;
+    UINT8 i;
+
+    pInstance = createFifo();
+
+    CU_ASSERT_EQUAL( fifo_reserveElement(pInstance, FIFO_MAX_SIZE + 1, &pElement),
+            kPsiFifoElementSizeOverflow );
+
+    for(i = 0; i < FIFO_BUFF_SIZE / FIFO_ELEM_HEADER_SIZE; i++)
+    {
+        CU_ASSERT_EQUAL( pushElement(pInstance, FIFO_MAX_SIZE, i), kPsiSuccessful );
+        popElement(pInstance, FIFO_MAX_SIZE, i);
+
+        // Move the empty FIFO to the next position with an empty element
+        CU_ASSERT_EQUAL( pushElement(pInstance, 0, 0), kPsiSuccessful );
+        popElement(pInstance, 0, 0);
+    }
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test the commit of reserved elements
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_fifoCommit(void)
+{
+    tFifoInstance pInstance;
+    UINT8* pElement;
+
+    pInstance = createFifo();
+
+    // Nothing reserved
+    CU_ASSERT_EQUAL( fifo_commitElement(pInstance, 4), kPsiFifoInvalidParam );
+    CU_ASSERT_EQUAL( fifo_commitElement(NULL, 4), kPsiFifoInvalidParam );
+
+    // Committed element is larger than the reservation
+    CU_ASSERT_EQUAL( fifo_reserveElement(pInstance, 8, &pElement), kPsiSuccessful );
+    CU_ASSERT_EQUAL( fifo_commitElement(pInstance, 12), kPsiFifoElementSizeOverflow );
+
+    // A smaller element only uses its own size
+    PSI_MEMSET(pElement, 0xC1, 5);
+    CU_ASSERT_EQUAL( fifo_commitElement(pInstance, 5), kPsiSuccessful );
+    CU_ASSERT_EQUAL( pInstance->writeCnt_m, FIFO_ELEM_HEADER_SIZE + 8 );
+
+    // The reservation is finished with the commit
+    CU_ASSERT_EQUAL( fifo_commitElement(pInstance, 5), kPsiFifoInvalidParam );
+
+    popElement(pInstance, 5, 0xC1);
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test the flush of the FIFO
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_fifoFlush(void)
+{
+    tFifoInstance pInstance;
+    UINT8* pElement;
+    UINT32 elemSize;
+
+    pInstance = createFifo();
+
+    CU_ASSERT_EQUAL( fifo_flush(NULL), kPsiFifoInvalidParam );
+
+    // Flush of the empty FIFO
+    CU_ASSERT_EQUAL( fifo_flush(pInstance), kPsiSuccessful );
+
+    CU_ASSERT_EQUAL( pushElement(pInstance, 20, 0xD1), kPsiSuccessful );
+    CU_ASSERT_EQUAL( pushElement(pInstance, 20, 0xD2), kPsiSuccessful );
+
+    CU_ASSERT_EQUAL( fifo_flush(pInstance), kPsiSuccessful );
+    CU_ASSERT_EQUAL( fifo_peekElement(pInstance, &pElement, &elemSize), kPsiFifoEmpty );
+
+    // The next element needs padding and is received after the flush
+    CU_ASSERT_EQUAL( pushElement(pInstance, 20, 0xD3), kPsiSuccessful );
+    popElement(pInstance, 20, 0xD3);
+
+    CU_ASSERT_EQUAL( fifo_peekElement(pInstance, &pElement, &elemSize), kPsiFifoEmpty );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test the overflow of the running read and write counters
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_fifoCounterOverflow(void)
+{
+    tFifoInstance pInstance;
+    UINT8 i;
+
+    pInstance = createFifo();
+
+    // Start the empty FIFO shortly before the counter overflow
+    pInstance->writeCnt_m = 0xFFFFFFC0U + 48;
+    pInstance->readCnt_m = pInstance->writeCnt_m;
+
+    for(i = 0; i < 8; i++)
+    {
+        CU_ASSERT_EQUAL( pushElement(pInstance, 20, 0xE0 + i), kPsiSuccessful );
+        CU_ASSERT_EQUAL( pushElement(pInstance, 12, 0xF0 + i), kPsiSuccessful );
+
+        popElement(pInstance, 20, 0xE0 + i);
+        popElement(pInstance, 12, 0xF0 + i);
+    }
+
+    CU_ASSERT_TRUE( pInstance->writeCnt_m < FIFO_BUFF_SIZE * 8 );
+    CU_ASSERT_EQUAL( pInstance->readCnt_m, pInstance->writeCnt_m );
+}
+
+//============================================================================//
+//            P R I V A T E   F U N C T I O N S                               //
+//============================================================================//
+/// \name Private Functions
+/// \{
+
+//------------------------------------------------------------------------------
+/**
+\brief    Create an empty FIFO with the test buffer
+
+\return tFifoInstance
+\retval Pointer     The created FIFO instance
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static tFifoInstance createFifo(void)
+{
+    tFifoInstance pInstance;
+
+    CU_ASSERT_EQUAL( fifo_init(), kPsiSuccessful );
+    PSI_MEMSET(fifoBuff_l, 0, sizeof(fifoBuff_l));
+
+    pInstance = fifo_create((UINT8*)fifoBuff_l, FIFO_BUFF_SIZE);
+    CU_ASSERT_PTR_NOT_NULL_FATAL( pInstance );
+
+    return pInstance;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Write one element filled with a pattern to the FIFO
+
+\param pInstance_p      The FIFO instance
+\param elemSize_p       Size of the element
+\param pattern_p        Value of all bytes of the element
+
+\return tPsiStatus
+\retval kPsiSuccessful  Element is committed
+\retval other           Error of fifo_reserveElement() or fifo_commitElement()
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static tPsiStatus pushElement(tFifoInstance pInstance_p, UINT32 elemSize_p,
+        UINT8 pattern_p)
+{
+    tPsiStatus ret;
+    UINT8* pElement = NULL;
+
+    ret = fifo_reserveElement(pInstance_p, elemSize_p, &pElement);
+    if(ret == kPsiSuccessful)
+    {
+        PSI_MEMSET(pElement, pattern_p, elemSize_p);
+
+        ret = fifo_commitElement(pInstance_p, elemSize_p);
+    }
+
+    return ret;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Read and check the oldest element of the FIFO and release it
+
+\param pInstance_p      The FIFO instance
+\param elemSize_p       Expected size of the element
+\param pattern_p        Expected value of all bytes of the element
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static void popElement(tFifoInstance pInstance_p, UINT32 elemSize_p,
+        UINT8 pattern_p)
+{
+    UINT8* pElement = NULL;
+    UINT32 elemSize = 0;
+    UINT32 i;
+
+    CU_ASSERT_EQUAL_FATAL( fifo_peekElement(pInstance_p, &pElement, &elemSize), kPsiSuccessful );
+    CU_ASSERT_EQUAL( elemSize, elemSize_p );
+
+    // The element is inside the buffer
+    CU_ASSERT_TRUE( pElement >= (UINT8*)fifoBuff_l + FIFO_ELEM_HEADER_SIZE );
+    CU_ASSERT_TRUE( pElement + elemSize <= (UINT8*)fifoBuff_l + FIFO_BUFF_SIZE );
+
+    for(i = 0; i < elemSize && i < elemSize_p; i++)
+    {
+        CU_ASSERT_EQUAL( pElement[i], pattern_p );
+    }
+
+    CU_ASSERT_EQUAL( fifo_releaseElement(pInstance_p), kPsiSuccessful );
+}
+
+/// \}
@@ -114,6 +114,17 @@ static CU_TestInfo ccReadWriteSuite[] = {
     CU_TEST_INFO_NULL,
 };
 
+static CU_TestInfo ccBatchSuite[] = {
+    { "Test packing of written objects", TST_ccWriteObjectBatch },
+    CU_TEST_INFO_NULL,
+};
+
+static CU_TestInfo ccRxBatchSuite[] = {
+    { "Test received batch is applied once", TST_ccReceiveObjectBatch },
+    { "Test batches received before cc_process are applied", TST_ccReceivePendingBatches },
+    CU_TEST_INFO_NULL,
+};
+
 static CU_SuiteInfo suites[] = {
     { "Process suite", TST_streamInit, TST_defaultClean, ccProcessSuite },
     { "Buffer in address invalid", TST_initCcInAddrInvalid, TST_defaultClean, ccInitInvalidSuite },
@@ -123,6 +134,8 @@ static CU_SuiteInfo suites[] = {
     { "Buffer out post action list full", TST_initOccPostActionListFull, TST_defaultClean, ccInitInvalidSuite },
     { "Buffer in with no timeout instance available", TST_initIccTimeoutInitFails, TST_defaultClean, ccInitInvalidSuite },
     { "Test read write API functions", TST_initFull, TST_defaultClean, ccReadWriteSuite },
+    { "Test object batch transfer", TST_initFull, TST_defaultClean, ccBatchSuite },
+    { "Test object batch reception", TST_initFull, TST_defaultClean, ccRxBatchSuite },
     CU_SUITE_INFO_NULL,
 };
 #else
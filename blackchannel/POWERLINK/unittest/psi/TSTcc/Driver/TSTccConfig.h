@@ -83,3 +83,6 @@ void TST_ccInitFail(void);
 int TST_initFull(void);
 void TST_ccReadObject(void);
 void TST_ccWriteObject(void);
+void TST_ccWriteObjectBatch(void);
+void TST_ccReceiveObjectBatch(void);
+void TST_ccReceivePendingBatches(void);
@@ -83,6 +83,7 @@
 #define OBJECT_INVALID_SUBINDEX     0xF
 
 #define VALID_DUMMY_OBJECT          0
+#define UINT16_ENTRY_SIZE           (CC_ENTRY_HEADER_SIZE + kTypeUint16Size)
 
 //------------------------------------------------------------------------------
 // local types
@@ -99,6 +100,9 @@ static UINT16 currObj_l = 0;
 // local function prototypes
 //------------------------------------------------------------------------------
 static BOOL streamHandlerRxObjects(tHandlerParam* pHandlParam_p);
+static BOOL ackIccBuffer(tSeqNrValue seqNr_p);
+static void postOccBatch(UINT8 seqNr_p, UINT8 objId_p, UINT16 payload_p);
+static void processCycles(UINT8 cycleCount_p);
 
 //============================================================================//
 //            P U B L I C   F U N C T I O N S                                 //
@@ -123,6 +127,7 @@ int TST_initFull(void)
     tStatusInitParam statusInitParam;
 
     stb_initBuffers();
+    PSI_MEMSET(&streamInitParam, 0, sizeof(tStreamInitParam));
 
     // Call init of stream module
     streamInitParam.pfnStreamHandler_m = streamHandlerRxObjects;
@@ -164,6 +169,7 @@ int TST_initFull(void)
 void TST_ccReadObject(void)
 {
     tConfChanObject* pReadObj;
+    tConfChanObject  readCopy;
     tCcObject        initObjList[CONF_CHAN_NUM_OBJECTS] = CCOBJECT_LIST_INIT_VECTOR;
     UINT16 objIdx;
     UINT8 objSubIdx;
@@ -180,6 +186,16 @@ void TST_ccReadObject(void)
     pReadObj = cc_readObject(objIdx, objSubIdx);
 
     CU_ASSERT_NOT_EQUAL( pReadObj, NULL );
+
+    // Copy object with invalid parameters
+    CU_ASSERT_FALSE( cc_copyObject(objIdx, objSubIdx, NULL) );
+    CU_ASSERT_FALSE( cc_copyObject(OBJECT_INVALID_INDEX, OBJECT_INVALID_SUBINDEX, &readCopy) );
+
+    // Copy existing object
+    CU_ASSERT_TRUE( cc_copyObject(objIdx, objSubIdx, &readCopy) );
+    CU_ASSERT_EQUAL( readCopy.objIdx_m, objIdx );
+    CU_ASSERT_EQUAL( readCopy.objSubIdx_m, objSubIdx );
+    CU_ASSERT_EQUAL( readCopy.objPayloadLow_m, pReadObj->objPayloadLow_m );
 }
 
 //------------------------------------------------------------------------------
@@ -279,6 +295,210 @@ void TST_ccWriteObject(void)
     cc_exit();
 }
 
+//------------------------------------------------------------------------------
+/**
+\brief Test packing of several written objects into one transmit buffer
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_ccWriteObjectBatch(void)
+{
+    tConfChanObject dummyObj;
+    tCcObject       initObjList[CONF_CHAN_NUM_OBJECTS] = CCOBJECT_LIST_INIT_VECTOR;
+    UINT8 i;
+    UINT8 objCount;
+    tCcWriteStatus writeState;
+    tBuffDescriptor* pBuffDesc;
+    tTbufCcStructure* pIccTxStruct;
+
+    pBuffDesc = stb_getDescElement(kTbufNumInputConfChan);
+    pIccTxStruct = (tTbufCcStructure*)pBuffDesc->pBuffBase_m;
+
+    enRxObject_l = FALSE;
+
+    // Write all objects of the list before processing the channel
+    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    {
+        dummyObj.objIdx_m = initObjList[i].objIdx;
+        dummyObj.objSubIdx_m = initObjList[i].objSubIdx;
+        dummyObj.objSize_m = initObjList[i].objSize;
+        dummyObj.objPayloadLow_m = 0x1100 + i;
+        dummyObj.objPayloadHigh_m = 0x00;
+
+        writeState = cc_writeObject(&dummyObj);
+
+        CU_ASSERT_EQUAL( writeState, kCcWriteStatusSuccessful );
+    }
+
+    cc_process();
+
+    // As many objects as fit are transmitted in the first buffer
+    objCount = CC_OBJDATA_SIZE / UINT16_ENTRY_SIZE;
+
+    CU_ASSERT_EQUAL( pIccTxStruct->seqNr_m, kSeqNrValueSecond );
+    CU_ASSERT_EQUAL( pIccTxStruct->objCount_m, objCount );
+
+    for(i=0; i < objCount; i++)
+    {
+        CU_ASSERT_EQUAL( pIccTxStruct->objData_m[i * UINT16_ENTRY_SIZE], CC_ENTRY_HEADER(i, 1) );
+        CU_ASSERT_EQUAL( ami_getUint16Le(&pIccTxStruct->objData_m[i * UINT16_ENTRY_SIZE + CC_ENTRY_HEADER_SIZE]), 0x1100 + i );
+    }
+
+    // Objects with an outstanding update can't be written
+    dummyObj.objIdx_m = initObjList[0].objIdx;
+    dummyObj.objSubIdx_m = initObjList[0].objSubIdx;
+    dummyObj.objSize_m = initObjList[0].objSize;
+
+    writeState = cc_writeObject(&dummyObj);
+
+    CU_ASSERT_EQUAL( writeState, kCcWriteStatusBusy );
+
+    // Acknowledge the buffer -> Remaining objects are transmitted
+    CU_ASSERT_TRUE( ackIccBuffer(kSeqNrValueSecond) );
+
+    cc_process();
+
+    CU_ASSERT_EQUAL( pIccTxStruct->seqNr_m, kSeqNrValueFirst );
+    CU_ASSERT_EQUAL( pIccTxStruct->objCount_m, CONF_CHAN_NUM_OBJECTS - objCount );
+    CU_ASSERT_EQUAL( pIccTxStruct->objData_m[0], CC_ENTRY_HEADER(objCount, 1) );
+
+    // Released objects can be written again
+    writeState = cc_writeObject(&dummyObj);
+
+    CU_ASSERT_EQUAL( writeState, kCcWriteStatusSuccessful );
+
+    // Cleanup cc module
+    cc_exit();
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Test that a received object batch is applied once in cc_process
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_ccReceiveObjectBatch(void)
+{
+    tConfChanObject dummyObj;
+    tConfChanObject readCopy;
+    tCcObject       initObjList[CONF_CHAN_NUM_OBJECTS] = CCOBJECT_LIST_INIT_VECTOR;
+    tCcWriteStatus writeState;
+
+    enRxObject_l = FALSE;
+
+    dummyObj.objIdx_m = initObjList[VALID_DUMMY_OBJECT].objIdx;
+    dummyObj.objSubIdx_m = initObjList[VALID_DUMMY_OBJECT].objSubIdx;
+    dummyObj.objSize_m = initObjList[VALID_DUMMY_OBJECT].objSize;
+    dummyObj.objPayloadLow_m = 0x5678;
+    dummyObj.objPayloadHigh_m = 0x00;
+
+    // PCP posts a batch which updates the object
+    postOccBatch(0x01, VALID_DUMMY_OBJECT, 0x1234);
+
+    // The stream post action only takes the batch
+    CU_ASSERT_TRUE( stream_processSync() );
+    CU_ASSERT_TRUE( stream_processPostActions() );
+
+    CU_ASSERT_TRUE( cc_copyObject(dummyObj.objIdx_m, dummyObj.objSubIdx_m, &readCopy) );
+    CU_ASSERT_EQUAL( readCopy.objPayloadLow_m, 0x0 );
+
+    // The batch is applied in the background
+    cc_process();
+
+    CU_ASSERT_TRUE( cc_copyObject(dummyObj.objIdx_m, dummyObj.objSubIdx_m, &readCopy) );
+    CU_ASSERT_EQUAL( readCopy.objPayloadLow_m, 0x1234 );
+
+    // Application overwrites the object of the last batch
+    writeState = cc_writeObject(&dummyObj);
+
+    CU_ASSERT_EQUAL( writeState, kCcWriteStatusSuccessful );
+
+    // The PCP leaves the old batch in the buffer -> Value of the application stays
+    processCycles(3);
+
+    CU_ASSERT_TRUE( cc_copyObject(dummyObj.objIdx_m, dummyObj.objSubIdx_m, &readCopy) );
+    CU_ASSERT_EQUAL( readCopy.objPayloadLow_m, 0x5678 );
+
+    // The next batch of the PCP is applied again
+    postOccBatch(0x02, VALID_DUMMY_OBJECT, 0x9ABC);
+    processCycles(1);
+
+    CU_ASSERT_TRUE( cc_copyObject(dummyObj.objIdx_m, dummyObj.objSubIdx_m, &readCopy) );
+    CU_ASSERT_EQUAL( readCopy.objPayloadLow_m, 0x9ABC );
+
+    // Cleanup cc module
+    cc_exit();
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Test that batches received before cc_process runs are all applied
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_ccReceivePendingBatches(void)
+{
+    tConfChanObject readCopy;
+    tCcObject       initObjList[CONF_CHAN_NUM_OBJECTS] = CCOBJECT_LIST_INIT_VECTOR;
+    UINT8 i;
+
+    enRxObject_l = FALSE;
+
+    // Three batches are taken while the first one waits for cc_process
+    postOccBatch(0x01, 0, 0x1111);
+    CU_ASSERT_TRUE( stream_processSync() );
+    CU_ASSERT_TRUE( stream_processPostActions() );
+
+    postOccBatch(0x02, 1, 0x2222);
+    CU_ASSERT_TRUE( stream_processSync() );
+    CU_ASSERT_TRUE( stream_processPostActions() );
+
+    postOccBatch(0x03, 0, 0x3333);
+    CU_ASSERT_TRUE( stream_processSync() );
+    CU_ASSERT_TRUE( stream_processPostActions() );
+
+    cc_process();
+
+    // The second batch is not lost and the last value of object 0 wins
+    CU_ASSERT_TRUE( cc_copyObject(initObjList[0].objIdx, initObjList[0].objSubIdx, &readCopy) );
+    CU_ASSERT_EQUAL( readCopy.objPayloadLow_m, 0x3333 );
+    CU_ASSERT_TRUE( cc_copyObject(initObjList[1].objIdx, initObjList[1].objSubIdx, &readCopy) );
+    CU_ASSERT_EQUAL( readCopy.objPayloadLow_m, 0x2222 );
+
+    // Fill the queue -> The next batch stays in the buffer until a slot is free
+    for(i = 0; i <= CC_RX_BATCH_QUEUE_SIZE; i++)
+    {
+        postOccBatch(0x04 + i, (i == CC_RX_BATCH_QUEUE_SIZE) ? 1 : 0, 0x4000 + i);
+        CU_ASSERT_TRUE( stream_processSync() );
+        CU_ASSERT_TRUE( stream_processPostActions() );
+    }
+
+    cc_process();
+
+    CU_ASSERT_TRUE( cc_copyObject(initObjList[1].objIdx, initObjList[1].objSubIdx, &readCopy) );
+    CU_ASSERT_EQUAL( readCopy.objPayloadLow_m, 0x2222 );
+
+    processCycles(1);
+
+    CU_ASSERT_TRUE( cc_copyObject(initObjList[1].objIdx, initObjList[1].objSubIdx, &readCopy) );
+    CU_ASSERT_EQUAL( readCopy.objPayloadLow_m, 0x4000 + CC_RX_BATCH_QUEUE_SIZE );
+
+    // The sequence number wraps around without dropping a batch
+    postOccBatch(0xFF, 1, 0x5555);
+    processCycles(1);
+    postOccBatch(0x00, 1, 0x6666);
+    processCycles(1);
+
+    CU_ASSERT_TRUE( cc_copyObject(initObjList[1].objIdx, initObjList[1].objSubIdx, &readCopy) );
+    CU_ASSERT_EQUAL( readCopy.objPayloadLow_m, 0x6666 );
+
+    // Cleanup cc module
+    cc_exit();
+}
+
 //============================================================================//
 //            P R I V A T E   F U N C T I O N S                               //
 //============================================================================//
@@ -302,6 +522,7 @@ static BOOL streamHandlerRxObjects(tHandlerParam* pHandlParam_p)
 {
     tBuffDescriptor* pBuffDesc;
     tTbufCcStructure* pOccRxStruct;
+    UINT8 sizeCode;
 
     UNUSED_PARAMETER(pHandlParam_p);
 
@@ -312,15 +533,17 @@ static BOOL streamHandlerRxObjects(tHandlerParam* pHandlParam_p)
 
         pOccRxStruct = (tTbufCcStructure*)pBuffDesc->pBuffBase_m;
 
-        // Object RX test enabled
-        pOccRxStruct->objIdx_m = objRxStateList_l[currObj_l].objIdx;
-        pOccRxStruct->objSubIdx_m = objRxStateList_l[currObj_l].objSubIdx;
-        pOccRxStruct->objPayloadLow_m = 0;
-        pOccRxStruct->objPayloadHigh_m = 0;
+        // Object RX test enabled (One object with zero payload per batch)
+        for(sizeCode = 0; (1 << sizeCode) < objRxStateList_l[currObj_l].objSize; sizeCode++);
+
+        PSI_MEMSET(&pOccRxStruct->objData_m[0], 0, CC_OBJDATA_SIZE);
+        pOccRxStruct->seqNr_m++;
+        pOccRxStruct->objCount_m = 1;
+        pOccRxStruct->objData_m[0] = CC_ENTRY_HEADER(currObj_l, sizeCode);
 
         currObj_l++;
 
-        if(currObj_l > CONF_CHAN_NUM_OBJECTS)
+        if(currObj_l >= CONF_CHAN_NUM_OBJECTS)
         {
             currObj_l = 0;
         }
@@ -329,6 +552,96 @@ static BOOL streamHandlerRxObjects(tHandlerParam* pHandlParam_p)
     return TRUE;
 }
 
+//------------------------------------------------------------------------------
+/**
+\brief Simulate the acknowledge of the ICC buffer by the PCP
+
+\param seqNr_p      Sequence number written to the ICC status field
+
+\return BOOL
+\retval TRUE    Processing success
+\retval FALSE   Error on processing
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL ackIccBuffer(tSeqNrValue seqNr_p)
+{
+    BOOL fReturn;
+    tBuffDescriptor* pBuffDesc;
+    tTbufStatusOutStructure* pStatusOut;
+
+    pBuffDesc = stb_getDescElement(kTbufNumStatusOut);
+    pStatusOut = (tTbufStatusOutStructure*)pBuffDesc->pBuffBase_m;
+
+    if(seqNr_p == kSeqNrValueSecond)
+    {
+        pStatusOut->iccStatus_m |= (1 << STATUS_ICC_BUSY_FLAG_POS);
+    }
+    else
+    {
+        pStatusOut->iccStatus_m &= ~(1 << STATUS_ICC_BUSY_FLAG_POS);
+    }
+
+    // Process sync task and post actions to update the status register
+    fReturn = stream_processSync();
+
+    if(fReturn != FALSE)
+    {
+        fReturn = stream_processPostActions();
+    }
+
+    return fReturn;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Simulate a batch with one object in the OCC buffer
+
+\param seqNr_p      Sequence number of the batch
+\param objId_p      Id of the object in the batch
+\param payload_p    Payload of the object
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static void postOccBatch(UINT8 seqNr_p, UINT8 objId_p, UINT16 payload_p)
+{
+    tBuffDescriptor* pBuffDesc;
+    tTbufCcStructure* pOccRxStruct;
+
+    pBuffDesc = stb_getDescElement(kTbufNumOutputConfChan);
+    pOccRxStruct = (tTbufCcStructure*)pBuffDesc->pBuffBase_m;
+
+    PSI_MEMSET(&pOccRxStruct->objData_m[0], 0, CC_OBJDATA_SIZE);
+    pOccRxStruct->seqNr_m = seqNr_p;
+    pOccRxStruct->objCount_m = 1;
+    pOccRxStruct->objData_m[0] = CC_ENTRY_HEADER(objId_p, 1);
+    ami_setUint16Le(&pOccRxStruct->objData_m[CC_ENTRY_HEADER_SIZE], payload_p);
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Process a number of cycles of the stream and the cc module
+
+\param cycleCount_p     Number of cycles to process
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static void processCycles(UINT8 cycleCount_p)
+{
+    UINT8 i;
+
+    for(i=0; i < cycleCount_p; i++)
+    {
+        CU_ASSERT_TRUE( stream_processSync() );
+        CU_ASSERT_TRUE( stream_processPostActions() );
+
+        cc_process();
+    }
+}
+
 /// \}
 
 #endif // #if (((PSI_MODULE_INTEGRATION) & (PSI_MODULE_CC)) != 0)
\ No newline at end of file
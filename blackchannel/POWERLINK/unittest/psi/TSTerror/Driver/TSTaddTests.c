@@ -105,6 +105,8 @@ static int TST_defaultClean(void)
 
 static CU_TestInfo errorSuite[] = {
     { "Test error module", TST_error },
+    { "Test error coalescing", TST_errorCoalesce },
+    { "Test error ring overflow", TST_errorOverflow },
     CU_TEST_INFO_NULL,
 };
 
@@ -73,6 +73,9 @@
 //------------------------------------------------------------------------------
 // const defines
 //------------------------------------------------------------------------------
+#define TEST_REPEAT_COUNT       100     ///< Number of repetitions of one error
+#define TEST_LOST_COUNT         5       ///< Number of errors posted to the full ring
+#define TEST_MAX_REPORTS        (ERROR_RING_SIZE + 1)   ///< Reports recorded by the test handler
 
 //------------------------------------------------------------------------------
 // local types
@@ -81,11 +84,14 @@
 //------------------------------------------------------------------------------
 // local vars
 //------------------------------------------------------------------------------
+static tPsiErrorInfo    reports_l[TEST_MAX_REPORTS];
+static UINT8            reportCount_l;
 
 //------------------------------------------------------------------------------
 // local function prototypes
 //------------------------------------------------------------------------------
 static void dummyErrorHandler (tPsiErrorInfo* pErrorInfo_p);
+static void recordErrorHandler (tPsiErrorInfo* pErrorInfo_p);
 
 //============================================================================//
 //            P U B L I C   F U N C T I O N S                                 //
@@ -122,6 +128,115 @@ void TST_error(void)
     error_exit();
 }
 
+//------------------------------------------------------------------------------
+/**
+\brief Test the deferred reporting and the coalescing of repeated errors
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_errorCoalesce(void)
+{
+    UINT8 i;
+
+    reportCount_l = 0;
+    error_init(recordErrorHandler);
+
+    // Errors are not reported in the raising context
+    for(i=0; i < TEST_REPEAT_COUNT; i++)
+    {
+        error_setError(kPsiModuleStream, kPsiStreamTransferTimeout);
+    }
+
+    error_setError(kPsiModuleSsdo, kPsiSsdoChannelBusy);
+    error_setError(kPsiModuleStream, kPsiStreamTransferTimeout);
+
+    CU_ASSERT_EQUAL(reportCount_l, 0);
+
+    // Repeated errors are reported once with their count
+    error_process();
+
+    CU_ASSERT_EQUAL(reportCount_l, 3);
+    CU_ASSERT_EQUAL(reports_l[0].srcModule_m, kPsiModuleStream);
+    CU_ASSERT_EQUAL(reports_l[0].errCode_m, kPsiStreamTransferTimeout);
+    CU_ASSERT_EQUAL(reports_l[0].count_m, TEST_REPEAT_COUNT);
+    CU_ASSERT_EQUAL(reports_l[1].srcModule_m, kPsiModuleSsdo);
+    CU_ASSERT_EQUAL(reports_l[1].errCode_m, kPsiSsdoChannelBusy);
+    CU_ASSERT_EQUAL(reports_l[1].count_m, 1);
+    CU_ASSERT_EQUAL(reports_l[2].srcModule_m, kPsiModuleStream);
+    CU_ASSERT_EQUAL(reports_l[2].count_m, 1);
+
+    // Reported errors are not coalesced with new ones
+    reportCount_l = 0;
+    error_setError(kPsiModuleStream, kPsiStreamTransferTimeout);
+    error_process();
+
+    CU_ASSERT_EQUAL(reportCount_l, 1);
+    CU_ASSERT_EQUAL(reports_l[0].count_m, 1);
+
+    // Nothing left to report
+    reportCount_l = 0;
+    error_process();
+
+    CU_ASSERT_EQUAL(reportCount_l, 0);
+
+    error_exit();
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Test the report of lost errors on a full error ring
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_errorOverflow(void)
+{
+    UINT8 i;
+
+    reportCount_l = 0;
+    error_init(recordErrorHandler);
+
+    // Fill the ring with alternating errors
+    for(i=0; i < ERROR_RING_SIZE; i++)
+    {
+        error_setError(kPsiModulePdo, (tPsiStatus)(kPsiPdoInitError + (i & 1)));
+    }
+
+    // Ring is full -> Other errors are lost
+    for(i=0; i < TEST_LOST_COUNT; i++)
+    {
+        error_setError(kPsiModuleSsdo, kPsiSsdoNoFreeBuffer);
+    }
+
+    // Repetition of the newest entry is still counted
+    error_setError(kPsiModulePdo, (tPsiStatus)(kPsiPdoInitError + ((ERROR_RING_SIZE - 1) & 1)));
+
+    error_process();
+
+    CU_ASSERT_EQUAL(reportCount_l, ERROR_RING_SIZE + 1);
+
+    for(i=0; i < ERROR_RING_SIZE; i++)
+    {
+        CU_ASSERT_EQUAL(reports_l[i].srcModule_m, kPsiModulePdo);
+        CU_ASSERT_EQUAL(reports_l[i].errCode_m, (tPsiStatus)(kPsiPdoInitError + (i & 1)));
+    }
+
+    CU_ASSERT_EQUAL(reports_l[ERROR_RING_SIZE - 1].count_m, 2);
+
+    // The lost errors are reported as ring overflow
+    CU_ASSERT_EQUAL(reports_l[ERROR_RING_SIZE].srcModule_m, kPsiModuleInternal);
+    CU_ASSERT_EQUAL(reports_l[ERROR_RING_SIZE].errCode_m, kPsiErrorRingOverflow);
+    CU_ASSERT_EQUAL(reports_l[ERROR_RING_SIZE].count_m, TEST_LOST_COUNT);
+
+    // Ring is usable again
+    reportCount_l = 0;
+    error_setError(kPsiModulePdo, kPsiPdoInitError);
+    error_exit();
+
+    CU_ASSERT_EQUAL(reportCount_l, 1);
+}
+
 //============================================================================//
 //            P R I V A T E   F U N C T I O N S                               //
 //============================================================================//
@@ -142,4 +257,23 @@ void dummyErrorHandler (tPsiErrorInfo* pErrorInfo_p)
     UNUSED_PARAMETER(pErrorInfo_p);
 }
 
+//------------------------------------------------------------------------------
+/**
+\brief    Error handler which records the reported errors
+
+\param pErrorInfo_p    Error info structure
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static void recordErrorHandler (tPsiErrorInfo* pErrorInfo_p)
+{
+    if(reportCount_l < TEST_MAX_REPORTS)
+    {
+        reports_l[reportCount_l] = *pErrorInfo_p;
+    }
+
+    reportCount_l++;
+}
+
 /// \}
\ No newline at end of file
@@ -62,3 +62,5 @@ The configuration header provides the function prototypes for each module test
 //------------------------------------------------------------------------------
 
 void TST_error(void);
+void TST_errorCoalesce(void);
+void TST_errorOverflow(void);
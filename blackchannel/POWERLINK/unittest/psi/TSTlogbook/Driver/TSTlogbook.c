@@ -0,0 +1,502 @@
+/**
+********************************************************************************
+\file   TSTlogbook.c
+
+\brief  Test the entry ring of the logbook module
+
+\ingroup module_unittests
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2013 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+//------------------------------------------------------------------------------
+// includes
+//------------------------------------------------------------------------------
+#include <cunit/CUnit.h>
+
+#include <Driver/TSTlogbookConfig.h>
+#include <Stubs/STBdescList.h>
+#include <Stubs/STBdummyHandler.h>
+
+#include <libpsi/internal/logbook.h>
+#include <libpsi/internal/stream.h>
+#include <libpsi/internal/status.h>
+
+#if (((PSI_MODULE_INTEGRATION) & (PSI_MODULE_LOGBOOK)) != 0)
+
+//============================================================================//
+//            G L O B A L   D E F I N I T I O N S                             //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// module global vars
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+// global function prototypes
+//------------------------------------------------------------------------------
+
+//============================================================================//
+//            P R I V A T E   D E F I N I T I O N S                           //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+#define LOG_TEST_CODE_BASE      0x10000     ///< Code of the first test entry (Not compact)
+
+//------------------------------------------------------------------------------
+// local types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local vars
+//------------------------------------------------------------------------------
+static tLogInstance pLogInst_l = NULL;
+
+//------------------------------------------------------------------------------
+// local function prototypes
+//------------------------------------------------------------------------------
+static void fillEntry(tLogFormat* pLogData_p, tLogLevel level_p, UINT32 code_p);
+static UINT32 getSentCode(void);
+static BOOL ackEntry(void);
+
+//============================================================================//
+//            P U B L I C   F U N C T I O N S                                 //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+/**
+\brief    Init the stream, status and logbook module for the ring tests
+
+\return int
+\retval 0       Init successful
+\retval other   Init failed
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+int TST_initLogRing(void)
+{
+    BOOL fReturn;
+    tStreamInitParam streamInitParam;
+    tStatusInitParam statusInitParam;
+    tLogInitParam logInitParam;
+
+    stb_initBuffers();
+    PSI_MEMSET(&streamInitParam, 0, sizeof(tStreamInitParam));
+
+    // Call init of stream module
+    streamInitParam.pfnStreamHandler_m = stb_streamHandlerSuccess;
+    streamInitParam.pBuffDescList_m = stb_getDescList();
+    streamInitParam.idConsAck_m = (tTbufNumLayout)0;
+    streamInitParam.idFirstProdBuffer_m = (tTbufNumLayout)(TBUF_NUM_CON + 1);
+
+    fReturn = stream_init(&streamInitParam);
+
+    if(fReturn != FALSE)
+    {
+        statusInitParam.buffInId_m = kTbufNumStatusIn;
+        statusInitParam.buffOutId_m = kTbufNumStatusOut;
+        statusInitParam.pfnProcSyncCb_m = stb_dummySyncHandlerSuccess;
+
+        fReturn = status_init(&statusInitParam);
+
+        if(fReturn != FALSE)
+        {
+            log_init();
+
+            // Call init of logbook module (One entry per transfer)
+            logInitParam.buffIdTx_m = kTbufNumLogbook0;
+            logInitParam.fBatchMode_m = FALSE;
+
+            pLogInst_l = log_create(kNumLogChan0, &logInitParam);
+            if(pLogInst_l == NULL)
+            {
+                fReturn = FALSE;
+            }
+        }
+    }
+
+    return (fReturn != FALSE) ? 0 : 1;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Destroy the logbook instance of the ring tests
+
+\return int
+\retval 0       Cleanup successful
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+int TST_cleanLogRing(void)
+{
+    log_destroy(pLogInst_l);
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Test reserving buffers until all slots of the ring are used
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_logRingFull(void)
+{
+    BOOL fReturn;
+    UINT32 i;
+    tLogFormat* apLogData[LOG_RING_SIZE];
+    tLogFormat* pLogData;
+    tLogTxStatus txState;
+
+    for(i=0; i < LOG_RING_SIZE; i++)
+    {
+        fReturn = log_getCurrentLogBuffer(pLogInst_l, &apLogData[i]);
+
+        CU_ASSERT_TRUE( fReturn );
+    }
+
+    // All slots are reserved -> No buffer available
+    fReturn = log_getCurrentLogBuffer(pLogInst_l, &pLogData);
+
+    CU_ASSERT_FALSE( fReturn );
+
+    // Invalid parameters
+    fReturn = log_getCurrentLogBuffer(NULL, &pLogData);
+
+    CU_ASSERT_FALSE( fReturn );
+
+    fReturn = log_getCurrentLogBuffer(pLogInst_l, NULL);
+
+    CU_ASSERT_FALSE( fReturn );
+
+    // Release all slots again
+    for(i=0; i < LOG_RING_SIZE; i++)
+    {
+        fillEntry(apLogData[i], kLogLevelInvalid, 0);
+
+        txState = log_postLogEntry(pLogInst_l, apLogData[i]);
+
+        CU_ASSERT_EQUAL( txState, kLogTxStatusSuccessful );
+    }
+
+    fReturn = log_process(pLogInst_l);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    // Released entries are not sent
+    CU_ASSERT_EQUAL( getSentCode(), 0 );
+
+    fReturn = log_getCurrentLogBuffer(pLogInst_l, &pLogData);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    fillEntry(pLogData, kLogLevelInvalid, 0);
+    log_postLogEntry(pLogInst_l, pLogData);
+    log_process(pLogInst_l);
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Test entries which are committed in a different order than reserved
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_logRingCommitOrder(void)
+{
+    BOOL fReturn;
+    UINT32 i;
+    tLogFormat* apLogData[LOG_RING_SIZE];
+    tLogFormat* pLogData;
+    tLogTxStatus txState;
+
+    for(i=0; i < LOG_RING_SIZE; i++)
+    {
+        fReturn = log_getCurrentLogBuffer(pLogInst_l, &apLogData[i]);
+
+        CU_ASSERT_TRUE( fReturn );
+
+        fillEntry(apLogData[i], kLogLevelInfo, LOG_TEST_CODE_BASE + i);
+    }
+
+    // Commit the newest entry first -> Older entries are still missing
+    txState = log_postLogEntry(pLogInst_l, apLogData[LOG_RING_SIZE - 1]);
+
+    CU_ASSERT_EQUAL( txState, kLogTxStatusSuccessful );
+
+    log_process(pLogInst_l);
+
+    CU_ASSERT_EQUAL( getSentCode(), 0 );
+
+    // Commit the oldest entry -> It is sent and its slot is free again
+    txState = log_postLogEntry(pLogInst_l, apLogData[0]);
+
+    CU_ASSERT_EQUAL( txState, kLogTxStatusSuccessful );
+
+    log_process(pLogInst_l);
+
+    CU_ASSERT_EQUAL( getSentCode(), LOG_TEST_CODE_BASE );
+
+    fReturn = log_getCurrentLogBuffer(pLogInst_l, &pLogData);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    fillEntry(pLogData, kLogLevelInfo, LOG_TEST_CODE_BASE + LOG_RING_SIZE);
+
+    fReturn = log_getCurrentLogBuffer(pLogInst_l, &apLogData[0]);
+
+    CU_ASSERT_FALSE( fReturn );
+
+    // Commit the remaining entries
+    for(i=1; i < LOG_RING_SIZE - 1; i++)
+    {
+        txState = log_postLogEntry(pLogInst_l, apLogData[i]);
+
+        CU_ASSERT_EQUAL( txState, kLogTxStatusSuccessful );
+    }
+
+    txState = log_postLogEntry(pLogInst_l, pLogData);
+
+    CU_ASSERT_EQUAL( txState, kLogTxStatusSuccessful );
+
+    // Each acknowledge moves the next entry in reservation order to the channel
+    for(i=1; i <= LOG_RING_SIZE; i++)
+    {
+        fReturn = ackEntry();
+
+        CU_ASSERT_TRUE( fReturn );
+        CU_ASSERT_EQUAL( getSentCode(), LOG_TEST_CODE_BASE + i );
+    }
+
+    fReturn = ackEntry();
+
+    CU_ASSERT_TRUE( fReturn );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Test entries which only release the buffer
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_logRingDropInvalid(void)
+{
+    BOOL fReturn;
+    tLogFormat* pLogData;
+    tLogTxStatus txState;
+
+    fReturn = log_getCurrentLogBuffer(pLogInst_l, &pLogData);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    fillEntry(pLogData, kLogLevelInvalid, LOG_TEST_CODE_BASE);
+    txState = log_postLogEntry(pLogInst_l, pLogData);
+
+    CU_ASSERT_EQUAL( txState, kLogTxStatusSuccessful );
+
+    fReturn = log_getCurrentLogBuffer(pLogInst_l, &pLogData);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    fillEntry(pLogData, kLogLevelMinor, LOG_TEST_CODE_BASE + 1);
+    txState = log_postLogEntry(pLogInst_l, pLogData);
+
+    CU_ASSERT_EQUAL( txState, kLogTxStatusSuccessful );
+
+    // Released entry is skipped -> Next entry is sent
+    fReturn = log_process(pLogInst_l);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( getSentCode(), LOG_TEST_CODE_BASE + 1 );
+
+    fReturn = ackEntry();
+
+    CU_ASSERT_TRUE( fReturn );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Test posting a buffer which is not part of the ring
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_logRingPostInvalid(void)
+{
+    tLogFormat logData;
+    tLogFormat* pLogData;
+    tLogTxStatus txState;
+    BOOL fReturn;
+
+    fillEntry(&logData, kLogLevelInfo, LOG_TEST_CODE_BASE);
+
+    txState = log_postLogEntry(pLogInst_l, &logData);
+
+    CU_ASSERT_EQUAL( txState, kLogTxStatusError );
+
+    // Pointer into the ring which is not the start of a buffer
+    fReturn = log_getCurrentLogBuffer(pLogInst_l, &pLogData);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    txState = log_postLogEntry(pLogInst_l, (tLogFormat*)((UINT8*)pLogData + 1));
+
+    CU_ASSERT_EQUAL( txState, kLogTxStatusError );
+
+    // Release the reserved buffer again
+    fillEntry(pLogData, kLogLevelInvalid, LOG_TEST_CODE_BASE);
+    txState = log_postLogEntry(pLogInst_l, pLogData);
+
+    CU_ASSERT_EQUAL( txState, kLogTxStatusSuccessful );
+
+    txState = log_postLogEntry(pLogInst_l, NULL);
+
+    CU_ASSERT_EQUAL( txState, kLogTxStatusError );
+
+    txState = log_postLogEntry(NULL, &logData);
+
+    CU_ASSERT_EQUAL( txState, kLogTxStatusError );
+}
+
+//============================================================================//
+//            P R I V A T E   F U N C T I O N S                               //
+//============================================================================//
+/// \name Private Functions
+/// \{
+
+//------------------------------------------------------------------------------
+/**
+\brief Fill a logbook entry with test data
+
+\param pLogData_p       Pointer to the entry
+\param level_p          Level of the entry
+\param code_p           Code of the entry
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static void fillEntry(tLogFormat* pLogData_p, tLogLevel level_p, UINT32 code_p)
+{
+    ami_setUint8Le((UINT8 *)&pLogData_p->level_m, (UINT8)level_p);
+    ami_setUint16Le((UINT8 *)&pLogData_p->source_m, 0x0102);
+    ami_setUint32Le((UINT8 *)&pLogData_p->code_m, code_p);
+    ami_setUint32Le((UINT8 *)&pLogData_p->addInfo_m, 0);
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Get the code of the entry in the logbook transmit buffer
+
+\return UINT32
+\retval Code    The code of the entry currently sent
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static UINT32 getSentCode(void)
+{
+    tBuffDescriptor* pBuffDesc;
+    tTbufLogStructure* pLogTxStruct;
+
+    pBuffDesc = stb_getDescElement(kTbufNumLogbook0);
+    pLogTxStruct = (tTbufLogStructure*)pBuffDesc->pBuffBase_m;
+
+    return ami_getUint32Le((UINT8 *)&pLogTxStruct->logData_m.code_m);
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Simulate the acknowledge of the PCP and process the logbook module
+
+\return BOOL
+\retval TRUE    Processing success
+\retval FALSE   Error on processing
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL ackEntry(void)
+{
+    BOOL fReturn;
+    tBuffDescriptor* pBuffDesc;
+    tTbufStatusOutStructure* pStatusOut;
+    tTbufLogStructure* pLogTxStruct;
+
+    pBuffDesc = stb_getDescElement(kTbufNumStatusOut);
+    pStatusOut = (tTbufStatusOutStructure*)pBuffDesc->pBuffBase_m;
+
+    pBuffDesc = stb_getDescElement(kTbufNumLogbook0);
+    pLogTxStruct = (tTbufLogStructure*)pBuffDesc->pBuffBase_m;
+
+    // Return the sequence number of the sent entry
+    if(pLogTxStruct->seqNr_m == kSeqNrValueSecond)
+    {
+        pStatusOut->logConsStatus_m |= (1 << kNumLogChan0);
+    }
+    else
+    {
+        pStatusOut->logConsStatus_m &= ~(1 << kNumLogChan0);
+    }
+
+    // Process sync task and post actions to update the status register
+    fReturn = stream_processSync();
+
+    if(fReturn != FALSE)
+    {
+        fReturn = stream_processPostActions();
+    }
+
+    if(fReturn != FALSE)
+    {
+        // Process async task to send the next entry
+        fReturn = log_process(pLogInst_l);
+    }
+
+    return fReturn;
+}
+
+/// \}
+
+#endif // #if (((PSI_MODULE_INTEGRATION) & (PSI_MODULE_LOGBOOK)) != 0)
@@ -102,6 +102,15 @@ static CU_TestInfo pdoProcessSuite[] = {
     { "Test module processing with both PDOs", TST_pdoProcessBoth },
     { "Test module processing with RPDO only", TST_pdoProcessRpdoOnly },
     { "Test module processing with TPDO only", TST_pdoProcessTpdoOnly },
+    { "Test channel images and destruction", TST_pdoChannelImages },
+    { "Test recreating a channel", TST_pdoRecreate },
+    { "Test module processing on changed RPDO only", TST_pdoProcessChangeOnly },
+    CU_TEST_INFO_NULL,
+};
+
+static CU_TestInfo pdoMappedObjSuite[] = {
+    { "Test generated object linking lists", TST_pdoMappedObjLinking },
+    { "Test generated object accessors", TST_pdoMappedObjAccess },
     CU_TEST_INFO_NULL,
 };
 
@@ -112,6 +121,7 @@ static CU_TestInfo pdoInitInvalidSuite[] = {
 
 static CU_SuiteInfo suites[] = {
     { "Process suite", TST_validInit, TST_defaultClean, pdoProcessSuite },
+    { "Mapped object suite", TST_validInit, TST_defaultClean, pdoMappedObjSuite },
     { "Rpdo address invalid", TST_initRpdoAddrInvalid, TST_defaultClean, pdoInitInvalidSuite },
     { "Tpdo address invalid", TST_initTpdoAddrInvalid, TST_defaultClean, pdoInitInvalidSuite },
     { "Rpdo size invalid", TST_initRpdoSizeInvalid, TST_defaultClean, pdoInitInvalidSuite },
@@ -70,6 +70,13 @@ void TST_pdoInit(void);
 void TST_pdoProcessBoth(void);
 void TST_pdoProcessRpdoOnly(void);
 void TST_pdoProcessTpdoOnly(void);
+void TST_pdoChannelImages(void);
+void TST_pdoRecreate(void);
+void TST_pdoProcessChangeOnly(void);
+
+// Test functions for the generated mapped objects
+void TST_pdoMappedObjLinking(void);
+void TST_pdoMappedObjAccess(void);
 
 // Test functions for the PDO init failed test
 int TST_initRpdoAddrInvalid(void);
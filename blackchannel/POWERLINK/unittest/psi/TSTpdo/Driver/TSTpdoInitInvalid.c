@@ -253,7 +253,7 @@ int TST_initTpdoPostActionListFull(void)
 //------------------------------------------------------------------------------
 void TST_pdoInitFail(void)
 {
-    BOOL fReturn;
+    tPdoInstance pInstance;
     tPdoInitParam InitParam;
 
     PSI_MEMSET(&InitParam, 0, sizeof(tPdoInitParam));
@@ -262,9 +262,9 @@ void TST_pdoInitFail(void)
     InitParam.buffIdRpdo_m = kTbufNumRpdoImage;
     InitParam.buffIdTpdo_m = kTbufNumTpdoImage;
 
-    fReturn = pdo_init(stb_dummyPdoCbSuccess, &InitParam);
+    pInstance = pdo_create(kNumPdoChan0, stb_dummyPdoCbSuccess, &InitParam);
 
-    CU_ASSERT_FALSE( fReturn );
+    CU_ASSERT_EQUAL( pInstance, NULL );
 }
 
 //============================================================================//
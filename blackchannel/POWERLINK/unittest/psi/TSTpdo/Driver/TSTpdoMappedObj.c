@@ -0,0 +1,178 @@
+/**
+********************************************************************************
+\file   TSTpdoMappedObj.c
+
+\brief  Test the generated layout and accessors of the mapped PDO objects
+
+\ingroup module_unittests
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2013 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+//------------------------------------------------------------------------------
+// includes
+//------------------------------------------------------------------------------
+#include <cunit/CUnit.h>
+
+#include <Driver/TSTpdoConfig.h>
+
+#include <libpsicommon/rpdo.h>
+#include <libpsicommon/tpdo.h>
+
+#if (((PSI_MODULE_INTEGRATION) & (PSI_MODULE_PDO)) != 0)
+
+//============================================================================//
+//            G L O B A L   D E F I N I T I O N S                             //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// module global vars
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+// global function prototypes
+//------------------------------------------------------------------------------
+
+//============================================================================//
+//            P R I V A T E   D E F I N I T I O N S                           //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local types
+//------------------------------------------------------------------------------
+
+/**
+ * \brief Object linking list element (Same layout as on the PCP)
+ */
+typedef struct {
+    UINT16 objIdx;
+    UINT8  objSubIdx;
+    UINT32 objDestOffset;
+    UINT16 objSize;
+} tTstObjLinkingData;
+
+//------------------------------------------------------------------------------
+// local vars
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local function prototypes
+//------------------------------------------------------------------------------
+
+//============================================================================//
+//            P U B L I C   F U N C T I O N S                                 //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+/**
+\brief Test the generated object linking lists
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_pdoMappedObjLinking(void)
+{
+    tTstObjLinkingData rpdoLinkList[RPDO_NUM_OBJECTS] = RPDO_LINKING_LIST_INIT_VECTOR;
+    tTstObjLinkingData tpdoLinkList[TPDO_NUM_OBJECTS] = TPDO_LINKING_LIST_INIT_VECTOR;
+
+    CU_ASSERT_EQUAL( RPDO_NUM_OBJECTS, 1 );
+    CU_ASSERT_EQUAL( TPDO_NUM_OBJECTS, 1 );
+
+    CU_ASSERT_EQUAL( rpdoLinkList[0].objIdx, 0x4001 );
+    CU_ASSERT_EQUAL( rpdoLinkList[0].objSubIdx, 0x01 );
+    CU_ASSERT_EQUAL( rpdoLinkList[0].objDestOffset, TBUF_RPDO_SPDO0_OFF );
+    CU_ASSERT_EQUAL( rpdoLinkList[0].objSize, RX_SPDO0_SIZE );
+
+    CU_ASSERT_EQUAL( tpdoLinkList[0].objIdx, 0x4000 );
+    CU_ASSERT_EQUAL( tpdoLinkList[0].objSubIdx, 0x01 );
+    CU_ASSERT_EQUAL( tpdoLinkList[0].objDestOffset, TBUF_TPDO_SPDO0_OFF );
+    CU_ASSERT_EQUAL( tpdoLinkList[0].objSize, TX_SPDO_SIZE );
+
+    // Generated structures are packed
+    CU_ASSERT_EQUAL( sizeof(tRpdoMappedObj), RX_SPDO0_SIZE );
+    CU_ASSERT_EQUAL( sizeof(tTpdoMappedObj), TX_SPDO_SIZE );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Test the generated accessors of the mapped objects
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_pdoMappedObjAccess(void)
+{
+    tRpdoMappedObj rpdoImage;
+    tTpdoMappedObj tpdoImage;
+    UINT8* pRaw;
+
+    PSI_MEMSET(&rpdoImage, 0, sizeof(tRpdoMappedObj));
+    PSI_MEMSET(&tpdoImage, 0, sizeof(tTpdoMappedObj));
+
+    // Base address of the objects
+    CU_ASSERT_EQUAL( rpdo_getSpdo0Addr(&rpdoImage), (UINT8 *)&rpdoImage + TBUF_RPDO_SPDO0_OFF );
+    CU_ASSERT_EQUAL( tpdo_getSpdo0Addr(&tpdoImage), (UINT8 *)&tpdoImage + TBUF_TPDO_SPDO0_OFF );
+
+    // Write single elements and read back the image
+    rpdo_setSpdo0(&rpdoImage, RX_SPDO0_SIZE - 1, 0xA5);
+    tpdo_setSpdo0(&tpdoImage, 0, 0x5A);
+
+    pRaw = (UINT8 *)&rpdoImage;
+    CU_ASSERT_EQUAL( pRaw[TBUF_RPDO_SPDO0_OFF + RX_SPDO0_SIZE - 1], 0xA5 );
+    pRaw = (UINT8 *)&tpdoImage;
+    CU_ASSERT_EQUAL( pRaw[TBUF_TPDO_SPDO0_OFF], 0x5A );
+
+    CU_ASSERT_EQUAL( rpdo_getSpdo0(&rpdoImage, RX_SPDO0_SIZE - 1), 0xA5 );
+    CU_ASSERT_EQUAL( rpdo_getSpdo0(&rpdoImage, 0), 0 );
+    CU_ASSERT_EQUAL( tpdo_getSpdo0(&tpdoImage, 0), 0x5A );
+}
+
+//============================================================================//
+//            P R I V A T E   F U N C T I O N S                               //
+//============================================================================//
+/// \name Private Functions
+/// \{
+
+/// \}
+
+#endif // #if (((PSI_MODULE_INTEGRATION) & (PSI_MODULE_PDO)) != 0)
@@ -87,10 +87,13 @@
 //------------------------------------------------------------------------------
 // local vars
 //------------------------------------------------------------------------------
+static UINT8 pdoCbCount_l;
 
 //------------------------------------------------------------------------------
 // local function prototypes
 //------------------------------------------------------------------------------
+static BOOL countPdoCb(UINT32 rpdoRelTimeLow_p, tRpdoMappedObj* pRpdoImage_p,
+        tTpdoMappedObj* pTpdoImage_p);
 
 //============================================================================//
 //            P U B L I C   F U N C T I O N S                                 //
@@ -116,6 +119,8 @@ int TST_validInit(void)
     // Call init successfully
     fReturn = stb_initStreamModule();
 
+    pdo_init();
+
     return (fReturn != FALSE) ? 0 : 1;
 }
 
@@ -128,36 +133,44 @@ int TST_validInit(void)
 //------------------------------------------------------------------------------
 void TST_pdoInit(void)
 {
-    BOOL fReturn;
+    tPdoInstance pInstance;
     tPdoInitParam InitParam;
 
     PSI_MEMSET(&InitParam, 0 , sizeof(tPdoInitParam));
 
     // Init with no parameters
-    fReturn = pdo_init(NULL, NULL);
+    pInstance = pdo_create(kNumPdoChan0, NULL, NULL);
 
-    CU_ASSERT_FALSE( fReturn );
+    CU_ASSERT_EQUAL( pInstance, NULL );
 
     // Init with no init parameter structure
-    fReturn = pdo_init(stb_dummyPdoCbSuccess, NULL);
+    pInstance = pdo_create(kNumPdoChan0, stb_dummyPdoCbSuccess, NULL);
 
-    CU_ASSERT_FALSE( fReturn );
+    CU_ASSERT_EQUAL( pInstance, NULL );
 
     // Init with unset init parameter structure (rpdoid = tpdoid)
-    fReturn = pdo_init(stb_dummyPdoCbSuccess, &InitParam);
+    pInstance = pdo_create(kNumPdoChan0, stb_dummyPdoCbSuccess, &InitParam);
 
-    CU_ASSERT_FALSE( fReturn );
+    CU_ASSERT_EQUAL( pInstance, NULL );
 
     // Init with rpdo and tpdo invalid
     InitParam.buffIdRpdo_m = kTbufCount;
     InitParam.buffIdTpdo_m = kTbufCount;
 
-    fReturn = pdo_init(stb_dummyPdoCbSuccess, &InitParam);
+    pInstance = pdo_create(kNumPdoChan0, stb_dummyPdoCbSuccess, &InitParam);
 
-    CU_ASSERT_FALSE( fReturn );
+    CU_ASSERT_EQUAL( pInstance, NULL );
+
+    // Init with invalid channel id
+    InitParam.buffIdRpdo_m = kTbufNumRpdoImage;
+    InitParam.buffIdTpdo_m = kTbufNumTpdoImage;
+
+    pInstance = pdo_create(kNumPdoInstCount, stb_dummyPdoCbSuccess, &InitParam);
 
-    // Call dummy exit function
-    pdo_exit();
+    CU_ASSERT_EQUAL( pInstance, NULL );
+
+    // Destroy invalid instance
+    pdo_destroy(NULL);
 }
 
 //------------------------------------------------------------------------------
@@ -170,24 +183,26 @@ void TST_pdoInit(void)
 void TST_pdoProcessBoth(void)
 {
     BOOL fReturn;
+    tPdoInstance pInstance;
     tPdoInitParam InitParam;
 
     // Init pdo module successfully
     InitParam.buffIdRpdo_m = kTbufNumRpdoImage;
     InitParam.buffIdTpdo_m = kTbufNumTpdoImage;
+    InitParam.fRpdoChangeOnly_m = FALSE;
 
-    fReturn = pdo_init(stb_dummyPdoCbSuccess, &InitParam);
+    pInstance = pdo_create(kNumPdoChan0, stb_dummyPdoCbSuccess, &InitParam);
 
-    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_NOT_EQUAL( pInstance, NULL );
 
     fReturn = stream_processSync();
 
     CU_ASSERT_TRUE( fReturn );
 
     // Init PDO module with failing PDO callback
-    fReturn = pdo_init(stb_dummyPdoCbFail, &InitParam);
+    pInstance = pdo_create(kNumPdoChan0, stb_dummyPdoCbFail, &InitParam);
 
-    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_NOT_EQUAL( pInstance, NULL );
 
     fReturn = stream_processPostActions();
 
@@ -204,24 +219,26 @@ void TST_pdoProcessBoth(void)
 void TST_pdoProcessRpdoOnly(void)
 {
     BOOL fReturn;
+    tPdoInstance pInstance;
     tPdoInitParam InitParam;
 
     // Init with rpdo id init parameter set
     InitParam.buffIdRpdo_m = kTbufNumRpdoImage;
     InitParam.buffIdTpdo_m = kTbufCount;
+    InitParam.fRpdoChangeOnly_m = FALSE;
 
-    fReturn = pdo_init(stb_dummyPdoCbSuccess, &InitParam);
+    pInstance = pdo_create(kNumPdoChan0, stb_dummyPdoCbSuccess, &InitParam);
 
-    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_NOT_EQUAL( pInstance, NULL );
 
     fReturn = stream_processSync();
 
     CU_ASSERT_TRUE( fReturn );
 
     // Init PDO module with failing PDO callback
-    fReturn = pdo_init(stb_dummyPdoCbFail, &InitParam);
+    pInstance = pdo_create(kNumPdoChan0, stb_dummyPdoCbFail, &InitParam);
 
-    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_NOT_EQUAL( pInstance, NULL );
 
     fReturn = stream_processPostActions();
 
@@ -238,24 +255,26 @@ void TST_pdoProcessRpdoOnly(void)
 void TST_pdoProcessTpdoOnly(void)
 {
     BOOL fReturn;
+    tPdoInstance pInstance;
     tPdoInitParam InitParam;
 
     // Init with tpdo id init parameter set
     InitParam.buffIdRpdo_m = kTbufCount;
     InitParam.buffIdTpdo_m = kTbufNumTpdoImage;
+    InitParam.fRpdoChangeOnly_m = FALSE;
 
-    fReturn = pdo_init(stb_dummyPdoCbSuccess, &InitParam);
+    pInstance = pdo_create(kNumPdoChan0, stb_dummyPdoCbSuccess, &InitParam);
 
-    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_NOT_EQUAL( pInstance, NULL );
 
     fReturn = stream_processSync();
 
     CU_ASSERT_TRUE( fReturn );
 
     // Init PDO module with failing PDO callback
-    fReturn = pdo_init(stb_dummyPdoCbFail, &InitParam);
+    pInstance = pdo_create(kNumPdoChan0, stb_dummyPdoCbFail, &InitParam);
 
-    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_NOT_EQUAL( pInstance, NULL );
 
     fReturn = stream_processPostActions();
 
@@ -263,12 +282,185 @@ void TST_pdoProcessTpdoOnly(void)
 }
 
 
+//------------------------------------------------------------------------------
+/**
+\brief Test the images and the destruction of a pdo channel
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_pdoChannelImages(void)
+{
+    BOOL fReturn;
+    tPdoInstance pInstance;
+    tPdoInitParam InitParam;
+    tBuffDescriptor* pDescList;
+
+    pDescList = stb_getDescList();
+
+    // Create channel with a failing callback
+    InitParam.buffIdRpdo_m = kTbufNumRpdoImage;
+    InitParam.buffIdTpdo_m = kTbufNumTpdoImage;
+    InitParam.fRpdoChangeOnly_m = FALSE;
+
+    pInstance = pdo_create(kNumPdoChan0, stb_dummyPdoCbFail, &InitParam);
+
+    CU_ASSERT_NOT_EQUAL( pInstance, NULL );
+
+    // Images point to the mapped objects of the channel buffers
+    CU_ASSERT_EQUAL( pdo_getRpdoImage(pInstance),
+            &((tTbufRpdoImage *)pDescList[kTbufNumRpdoImage].pBuffBase_m)->mappedObjList_m );
+    CU_ASSERT_EQUAL( pdo_getTpdoImage(pInstance),
+            &((tTbufTpdoImage *)pDescList[kTbufNumTpdoImage].pBuffBase_m)->mappedObjList_m );
+
+    fReturn = stream_processPostActions();
+
+    CU_ASSERT_FALSE( fReturn );
+
+    // Callback of a destroyed channel is not called anymore
+    pdo_destroy(pInstance);
+
+    fReturn = stream_processPostActions();
+
+    CU_ASSERT_TRUE( fReturn );
+
+    CU_ASSERT_EQUAL( pdo_getRpdoImage(pInstance), NULL );
+    CU_ASSERT_EQUAL( pdo_getTpdoImage(NULL), NULL );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Test recreating a pdo channel more often than actions fit the stream module
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_pdoRecreate(void)
+{
+    BOOL fReturn;
+    UINT8 i;
+    tPdoInstance pInstance;
+    tPdoInitParam InitParam;
+
+    InitParam.buffIdRpdo_m = kTbufNumRpdoImage;
+    InitParam.buffIdTpdo_m = kTbufNumTpdoImage;
+    InitParam.fRpdoChangeOnly_m = FALSE;
+
+    // Each destroy removes the rpdo action of the channel
+    for(i=0; i < kTbufCount + 1; i++)
+    {
+        pInstance = pdo_create(kNumPdoChan0, countPdoCb, &InitParam);
+
+        CU_ASSERT_NOT_EQUAL( pInstance, NULL );
+
+        pdo_destroy(pInstance);
+    }
+
+    // Last channel is called exactly once
+    pInstance = pdo_create(kNumPdoChan0, countPdoCb, &InitParam);
+
+    CU_ASSERT_NOT_EQUAL( pInstance, NULL );
+
+    pdoCbCount_l = 0;
+
+    fReturn = stream_processPostActions();
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( pdoCbCount_l, 1 );
+
+    pdo_destroy(pInstance);
+}
+
+
+//------------------------------------------------------------------------------
+/**
+\brief Test pdo channel which calls the user callback only on changed rpdo
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_pdoProcessChangeOnly(void)
+{
+    BOOL fReturn;
+    tPdoInstance pInstance;
+    tPdoInitParam InitParam;
+    tTbufRpdoImage* pRpdoBuff;
+
+    pRpdoBuff = (tTbufRpdoImage *)stb_getDescList()[kTbufNumRpdoImage].pBuffBase_m;
+
+    InitParam.buffIdRpdo_m = kTbufNumRpdoImage;
+    InitParam.buffIdTpdo_m = kTbufNumTpdoImage;
+    InitParam.fRpdoChangeOnly_m = TRUE;
+
+    pInstance = pdo_create(kNumPdoChan0, countPdoCb, &InitParam);
+
+    CU_ASSERT_NOT_EQUAL( pInstance, NULL );
+
+    // First cycle always calls the user callback
+    pdoCbCount_l = 0;
+
+    fReturn = stream_processPostActions();
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( pdoCbCount_l, 1 );
+
+    // Unchanged rpdo objects and new relative time
+    ami_setUint32Le((UINT8 *)&pRpdoBuff->relativeTimeLow_m, 0x1000);
+
+    fReturn = stream_processPostActions();
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( pdoCbCount_l, 1 );
+
+    // Changed rpdo objects
+    ((UINT8 *)&pRpdoBuff->mappedObjList_m)[sizeof(tRpdoMappedObj) - 1] ^= 0xFF;
+
+    fReturn = stream_processPostActions();
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( pdoCbCount_l, 2 );
+
+    fReturn = stream_processPostActions();
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( pdoCbCount_l, 2 );
+
+    pdo_destroy(pInstance);
+}
+
+
 //============================================================================//
 //            P R I V A T E   F U N C T I O N S                               //
 //============================================================================//
 /// \name Private Functions
 /// \{
 
+//------------------------------------------------------------------------------
+/**
+\brief    PDO user callback which counts its calls
+
+\param[in] rpdoRelTimeLow_p     Relative time low value
+\param[in] pRpdoImage_p         Pointer to the RPDO objects
+\param[in] pTpdoImage_p         Pointer to the TPDO objects
+
+\return BOOL
+\retval TRUE        Always successful
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL countPdoCb(UINT32 rpdoRelTimeLow_p, tRpdoMappedObj* pRpdoImage_p,
+        tTpdoMappedObj* pTpdoImage_p)
+{
+    UNUSED_PARAMETER(rpdoRelTimeLow_p);
+    UNUSED_PARAMETER(pRpdoImage_p);
+    UNUSED_PARAMETER(pTpdoImage_p);
+
+    pdoCbCount_l++;
+
+    return TRUE;
+}
+
 /// \}
 
 #endif // #if (((PSI_MODULE_INTEGRATION) & (PSI_MODULE_PDO)) != 0)
@@ -122,6 +122,16 @@ static CU_TestInfo ssdoSuite[] = {
     CU_TEST_INFO_NULL,
 };
 
+static CU_TestInfo ssdoTxQueueSuite[] = {
+    { "Post several frames before acknowledge", TST_ssdoTxQueue },
+    CU_TEST_INFO_NULL,
+};
+
+static CU_TestInfo ssdoRxQueueSuite[] = {
+    { "Receive several frames while the user is busy", TST_ssdoRxQueue },
+    CU_TEST_INFO_NULL,
+};
+
 static CU_SuiteInfo suites[] = {
     { "Process suite", TST_streamInit, TST_defaultClean, ssdoProcessSuite },
     { "Buffer rx address invalid", TST_initSsdoRxAddrInvalid, TST_defaultClean, ssdoInitInvalidSuite },
@@ -132,6 +142,8 @@ static CU_SuiteInfo suites[] = {
     { "Buffer tx with no timeout instance available", TST_initTxTimeoutInitFails, TST_defaultClean, ssdoInitInvalidSuite },
     { "Test read write API functions", TST_initFull, TST_defaultClean, ssdoReadWriteSuite },
     { "Ssdo module suite", TST_initInternal, TST_defaultClean, ssdoSuite },
+    { "Transmit queue suite", TST_initTxQueue, TST_defaultClean, ssdoTxQueueSuite },
+    { "Receive queue suite", TST_initRxQueue, TST_defaultClean, ssdoRxQueueSuite },
     CU_SUITE_INFO_NULL,
 };
 #else
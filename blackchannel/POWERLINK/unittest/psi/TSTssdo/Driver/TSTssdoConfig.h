@@ -90,3 +90,11 @@ void TST_receivePayloadInvalidHandler(void);
 int TST_initInternal(void);
 void TST_internalProcess(void);
 void TST_internalProcessRxHandlerFail(void);
+
+// Tests for the transmit queue
+int TST_initTxQueue(void);
+void TST_ssdoTxQueue(void);
+
+// Tests for the receive queue
+int TST_initRxQueue(void);
+void TST_ssdoRxQueue(void);
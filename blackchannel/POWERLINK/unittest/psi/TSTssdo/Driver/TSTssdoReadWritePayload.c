@@ -118,6 +118,7 @@ int TST_initFull(void)
     tStatusInitParam statusInitParam;
 
     stb_initBuffers();
+    PSI_MEMSET(&streamInitParam, 0, sizeof(tStreamInitParam));
 
     // Call init of stream module
     streamInitParam.pfnStreamHandler_m = streamHandlerRxPayload;
@@ -195,7 +196,15 @@ void TST_ssdoWritePayload(void)
 
     CU_ASSERT_TRUE( fReturn );
 
-    // Perform second write to signal channel busy
+    // Fill the remaining slots of the transmit queue
+    for(i=1; i < SSDO_TX_QUEUE_SIZE; i++)
+    {
+        txState = ssdo_postPayload(pSsdoInst_l, &asyncPayload[0], sizeof(asyncPayload));
+
+        CU_ASSERT_EQUAL( txState, kSsdoTxStatusSuccessful );
+    }
+
+    // Perform next write to signal channel busy
     txState = ssdo_postPayload(pSsdoInst_l, &asyncPayload[0], sizeof(asyncPayload));
 
     CU_ASSERT_EQUAL( txState, kSsdoTxStatusBusy );
@@ -0,0 +1,371 @@
+/**
+********************************************************************************
+\file   TSTssdoRxQueue.c
+
+\brief  Test SSDO module receive queue
+
+\ingroup module_unittests
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2013 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+//------------------------------------------------------------------------------
+// includes
+//------------------------------------------------------------------------------
+#include <cunit/CUnit.h>
+
+#include <Driver/TSTssdoConfig.h>
+#include <Stubs/STBdescList.h>
+#include <Stubs/STBdummyHandler.h>
+
+#include <libpsi/internal/ssdo.h>
+#include <libpsi/internal/stream.h>
+
+#if (((PSI_MODULE_INTEGRATION) & (PSI_MODULE_SSDO)) != 0)
+
+//============================================================================//
+//            G L O B A L   D E F I N I T I O N S                             //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// module global vars
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+// global function prototypes
+//------------------------------------------------------------------------------
+
+//============================================================================//
+//            P R I V A T E   D E F I N I T I O N S                           //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+#define RX_PAYLOAD_LENGTH       16      ///< Size of the dummy rx data
+
+//------------------------------------------------------------------------------
+// local types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local vars
+//------------------------------------------------------------------------------
+static tSsdoInstance pSsdoInst_l = NULL;
+static tSeqNrValue rxSeqNr_l = kSeqNrValueInvalid;
+static UINT8 rxHandlerCount_l = 0;
+static UINT8 rxLastData_l = 0;
+
+//------------------------------------------------------------------------------
+// local function prototypes
+//------------------------------------------------------------------------------
+static BOOL rxHandlerQueue(UINT8* pPayload_p, UINT16 size_p);
+static BOOL receiveFrame(UINT8 fillByte_p, UINT16 paylSize_p);
+static BOOL processCycles(void);
+static BOOL isFrameAcknowledged(void);
+
+//============================================================================//
+//            P U B L I C   F U N C T I O N S                                 //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+/**
+\brief    Init the stream, status and SSDO module for the receive queue tests
+
+\return int
+\retval 0       Init successful
+\retval other   Init failed
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+int TST_initRxQueue(void)
+{
+    BOOL fReturn;
+    tStreamInitParam streamInitParam;
+    tSsdoInitParam ssdoInitParam;
+    tStatusInitParam statusInitParam;
+
+    stb_initBuffers();
+    PSI_MEMSET(&streamInitParam, 0, sizeof(tStreamInitParam));
+
+    // Call init of stream module
+    streamInitParam.pfnStreamHandler_m = stb_streamHandlerSuccess;
+    streamInitParam.pBuffDescList_m = stb_getDescList();
+    streamInitParam.idConsAck_m = (tTbufNumLayout)0;
+    streamInitParam.idFirstProdBuffer_m = (tTbufNumLayout)(TBUF_NUM_CON + 1);
+
+    fReturn = stream_init(&streamInitParam);
+
+    if(fReturn != FALSE)
+    {
+        statusInitParam.buffInId_m = kTbufNumStatusIn;
+        statusInitParam.buffOutId_m = kTbufNumStatusOut;
+        statusInitParam.pfnProcSyncCb_m = stb_dummySyncHandlerSuccess;
+
+        fReturn = status_init(&statusInitParam);
+
+        if(fReturn != FALSE)
+        {
+            ssdo_init();
+
+            // Call init of SSDO module
+            ssdoInitParam.buffIdRx_m = kTbufNumSsdoReceive0;
+            ssdoInitParam.buffIdTx_m = kTbufNumSsdoTransmit0;
+            ssdoInitParam.pfnRxHandler_m = rxHandlerQueue;
+
+            pSsdoInst_l = ssdo_create(kNumSsdoChan0, &ssdoInitParam);
+            if(pSsdoInst_l == NULL)
+            {
+                fReturn = FALSE;
+            }
+        }
+    }
+
+    return (fReturn != FALSE) ? 0 : 1;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Test receiving several frames while the user is busy
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_ssdoRxQueue(void)
+{
+    BOOL fReturn;
+    UINT8 i;
+
+    // Receive a full queue of frames without processing the user side
+    for(i=0; i < SSDO_RX_QUEUE_SIZE; i++)
+    {
+        fReturn = receiveFrame(i + 1, RX_PAYLOAD_LENGTH);
+
+        CU_ASSERT_TRUE( fReturn );
+        CU_ASSERT_TRUE( isFrameAcknowledged() );
+    }
+
+    CU_ASSERT_EQUAL( rxHandlerCount_l, 0 );
+
+    // Queue is full -> Next frame stays unacknowledged
+    fReturn = receiveFrame(SSDO_RX_QUEUE_SIZE + 1, RX_PAYLOAD_LENGTH);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_FALSE( isFrameAcknowledged() );
+
+    // User consumes the first frame -> Held back frame is taken over
+    fReturn = ssdo_process(pSsdoInst_l);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( rxHandlerCount_l, 1 );
+    CU_ASSERT_EQUAL( rxLastData_l, 1 );
+
+    ssdo_receiveMsgFinished(pSsdoInst_l);
+
+    fReturn = processCycles();
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_TRUE( isFrameAcknowledged() );
+
+    // All frames are forwarded in order of arrival
+    for(i=2; i <= SSDO_RX_QUEUE_SIZE + 1; i++)
+    {
+        fReturn = ssdo_process(pSsdoInst_l);
+
+        CU_ASSERT_TRUE( fReturn );
+        CU_ASSERT_EQUAL( rxHandlerCount_l, i );
+        CU_ASSERT_EQUAL( rxLastData_l, i );
+
+        ssdo_receiveMsgFinished(pSsdoInst_l);
+    }
+
+    // Queue is empty -> Nothing is forwarded
+    fReturn = ssdo_process(pSsdoInst_l);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( rxHandlerCount_l, SSDO_RX_QUEUE_SIZE + 1 );
+
+    // Frame larger than the receive buffer is acknowledged but not forwarded
+    fReturn = receiveFrame(SSDO_RX_QUEUE_SIZE + 2, SSDO_STUB_DATA_DOM_SIZE + 1);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_TRUE( isFrameAcknowledged() );
+
+    fReturn = ssdo_process(pSsdoInst_l);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( rxHandlerCount_l, SSDO_RX_QUEUE_SIZE + 1 );
+
+    // destroy instance
+    ssdo_destroy(pSsdoInst_l);
+}
+
+//============================================================================//
+//            P R I V A T E   F U N C T I O N S                               //
+//============================================================================//
+/// \name Private Functions
+/// \{
+
+//------------------------------------------------------------------------------
+/**
+\brief SSDO receive handler which counts the forwarded frames
+
+\param pPayload_p       Pointer to the received payload
+\param size_p           Size of the received payload
+
+\return BOOL
+\retval TRUE        Payload stored
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL rxHandlerQueue(UINT8* pPayload_p, UINT16 size_p)
+{
+    rxHandlerCount_l++;
+
+    if(size_p == RX_PAYLOAD_LENGTH)
+    {
+        rxLastData_l = pPayload_p[RX_PAYLOAD_LENGTH - 1];
+    }
+
+    return TRUE;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Simulate an arriving frame and process the stream
+
+\param fillByte_p       Content of the frame payload
+\param paylSize_p       Payload size written to the frame header
+
+\return BOOL
+\retval TRUE    Processing success
+\retval FALSE   Error on processing
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL receiveFrame(UINT8 fillByte_p, UINT16 paylSize_p)
+{
+    tBuffDescriptor* pBuffDesc;
+    tTbufSsdoRxStructure* pSsdoRxStruct;
+
+    pBuffDesc = stb_getDescElement(kTbufNumSsdoReceive0);
+    pSsdoRxStruct = (tTbufSsdoRxStructure*)pBuffDesc->pBuffBase_m;
+
+    rxSeqNr_l = (rxSeqNr_l == kSeqNrValueSecond) ? kSeqNrValueFirst : kSeqNrValueSecond;
+
+    PSI_MEMSET(&pSsdoRxStruct->ssdoStubDataDom_m[0], fillByte_p, RX_PAYLOAD_LENGTH);
+    ami_setUint16Le((UINT8*)&pSsdoRxStruct->paylSize_m, paylSize_p);
+    pSsdoRxStruct->seqNr_m = rxSeqNr_l;
+
+    return processCycles();
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Run two stream cycles
+
+The first cycle takes over the incoming frame, the second one writes its
+acknowledge to the status register.
+
+\return BOOL
+\retval TRUE    Processing success
+\retval FALSE   Error on processing
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL processCycles(void)
+{
+    BOOL fReturn = TRUE;
+    UINT8 i;
+
+    for(i=0; i < 2; i++)
+    {
+        if(fReturn != FALSE)
+        {
+            fReturn = stream_processSync();
+        }
+
+        if(fReturn != FALSE)
+        {
+            fReturn = stream_processPostActions();
+        }
+    }
+
+    return fReturn;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Check if the last received frame is acknowledged in the status register
+
+\return BOOL
+\retval TRUE    Frame is acknowledged
+\retval FALSE   Frame is not acknowledged
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL isFrameAcknowledged(void)
+{
+    tBuffDescriptor* pBuffDesc;
+    tTbufStatusInStructure* pStatusIn;
+    tSeqNrValue ackSeqNr;
+
+    pBuffDesc = stb_getDescElement(kTbufNumStatusIn);
+    pStatusIn = (tTbufStatusInStructure*)pBuffDesc->pBuffBase_m;
+
+    if((ami_getUint16Le((UINT8*)&pStatusIn->ssdoProdStatus_m) & (1 << kNumSsdoChan0)) != 0)
+    {
+        ackSeqNr = kSeqNrValueSecond;
+    }
+    else
+    {
+        ackSeqNr = kSeqNrValueFirst;
+    }
+
+    return (ackSeqNr == rxSeqNr_l) ? TRUE : FALSE;
+}
+
+/// \}
+
+#endif // #if (((PSI_MODULE_INTEGRATION) & (PSI_MODULE_SSDO)) != 0)
@@ -0,0 +1,309 @@
+/**
+********************************************************************************
+\file   TSTssdoTxQueue.c
+
+\brief  Test SSDO module transmit queue
+
+\ingroup module_unittests
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2013 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+//------------------------------------------------------------------------------
+// includes
+//------------------------------------------------------------------------------
+#include <cunit/CUnit.h>
+
+#include <Driver/TSTssdoConfig.h>
+#include <Stubs/STBdescList.h>
+#include <Stubs/STBdummyHandler.h>
+
+#include <libpsi/internal/ssdo.h>
+#include <libpsi/internal/ssdoinst.h>
+#include <libpsi/internal/stream.h>
+
+#if (((PSI_MODULE_INTEGRATION) & (PSI_MODULE_SSDO)) != 0)
+
+//============================================================================//
+//            G L O B A L   D E F I N I T I O N S                             //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// module global vars
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+// global function prototypes
+//------------------------------------------------------------------------------
+
+//============================================================================//
+//            P R I V A T E   D E F I N I T I O N S                           //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+#define TX_PAYLOAD_LENGTH       16      ///< Size of the dummy tx data
+
+//------------------------------------------------------------------------------
+// local types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local vars
+//------------------------------------------------------------------------------
+static tSsdoInstance pSsdoInst_l = NULL;
+
+//------------------------------------------------------------------------------
+// local function prototypes
+//------------------------------------------------------------------------------
+static BOOL ackFrame(tSeqNrValue seqNr_p);
+
+//============================================================================//
+//            P U B L I C   F U N C T I O N S                                 //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+/**
+\brief    Init the stream, status and SSDO module for the queue tests
+
+\return int
+\retval 0       Init successful
+\retval other   Init failed
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+int TST_initTxQueue(void)
+{
+    BOOL fReturn;
+    tStreamInitParam streamInitParam;
+    tSsdoInitParam ssdoInitParam;
+    tStatusInitParam statusInitParam;
+
+    stb_initBuffers();
+    PSI_MEMSET(&streamInitParam, 0, sizeof(tStreamInitParam));
+
+    // Call init of stream module
+    streamInitParam.pfnStreamHandler_m = stb_streamHandlerSuccess;
+    streamInitParam.pBuffDescList_m = stb_getDescList();
+    streamInitParam.idConsAck_m = (tTbufNumLayout)0;
+    streamInitParam.idFirstProdBuffer_m = (tTbufNumLayout)(TBUF_NUM_CON + 1);
+
+    fReturn = stream_init(&streamInitParam);
+
+    if(fReturn != FALSE)
+    {
+        statusInitParam.buffInId_m = kTbufNumStatusIn;
+        statusInitParam.buffOutId_m = kTbufNumStatusOut;
+        statusInitParam.pfnProcSyncCb_m = stb_dummySyncHandlerSuccess;
+
+        fReturn = status_init(&statusInitParam);
+
+        if(fReturn != FALSE)
+        {
+            ssdo_init();
+
+            // Call init of SSDO module
+            ssdoInitParam.buffIdRx_m = kTbufNumSsdoReceive0;
+            ssdoInitParam.buffIdTx_m = kTbufNumSsdoTransmit0;
+            ssdoInitParam.pfnRxHandler_m = stb_dummySsdoReceiveHandlerSuccess;
+
+            pSsdoInst_l = ssdo_create(kNumSsdoChan0, &ssdoInitParam);
+            if(pSsdoInst_l == NULL)
+            {
+                fReturn = FALSE;
+            }
+        }
+    }
+
+    return (fReturn != FALSE) ? 0 : 1;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Test posting several frames before the first one is acknowledged
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_ssdoTxQueue(void)
+{
+    BOOL fReturn;
+    UINT8 txPayload[TX_PAYLOAD_LENGTH];
+    UINT8* pTxBuffer;
+    UINT16 txBuffLen;
+    UINT16 i;
+    tSsdoTxStatus txState;
+    tBuffDescriptor* pBuffDesc;
+    tTbufSsdoTxStructure* pSsdoTxStruct;
+
+    pBuffDesc = stb_getDescElement(kTbufNumSsdoTransmit0);
+    pSsdoTxStruct = (tTbufSsdoTxStructure*)pBuffDesc->pBuffBase_m;
+
+    // Fill the queue with frames of different content
+    for(i=0; i < SSDO_TX_QUEUE_SIZE; i++)
+    {
+        PSI_MEMSET(&txPayload, (UINT8)(i + 1), sizeof(txPayload));
+
+        txState = ssdo_postPayload(pSsdoInst_l, &txPayload[0], sizeof(txPayload));
+
+        CU_ASSERT_EQUAL( txState, kSsdoTxStatusSuccessful );
+    }
+
+    // Queue is full -> Channel is busy
+    txState = ssdo_postPayload(pSsdoInst_l, &txPayload[0], sizeof(txPayload));
+
+    CU_ASSERT_EQUAL( txState, kSsdoTxStatusBusy );
+
+    fReturn = ssdo_getCurrentTxBuffer(pSsdoInst_l, &pTxBuffer, &txBuffLen);
+
+    CU_ASSERT_FALSE( fReturn );
+
+    // First frame is posted to the transmit buffer
+    CU_ASSERT_EQUAL( pSsdoTxStruct->seqNr_m, kSeqNrValueSecond );
+    CU_ASSERT_EQUAL( pSsdoTxStruct->paylSize_m, sizeof(txPayload) );
+    CU_ASSERT_EQUAL( pSsdoTxStruct->tssdoTransmitData_m[0], 1 );
+    CU_ASSERT_EQUAL( timeout_getCycleLimit(pSsdoInst_l->txBuffParam_m.pTimeoutInst_m),
+            SSDO_TX_TIMEOUT_CYCLE_COUNT );
+
+    // Without acknowledge the same frame stays in the buffer
+    fReturn = ackFrame(kSeqNrValueFirst);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( pSsdoTxStruct->tssdoTransmitData_m[0], 1 );
+
+    // Acknowledge first frame -> Second frame is posted with toggled sequence number
+    fReturn = ackFrame(kSeqNrValueSecond);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( pSsdoTxStruct->seqNr_m, kSeqNrValueFirst );
+    CU_ASSERT_EQUAL( pSsdoTxStruct->tssdoTransmitData_m[0], 2 );
+
+    // Fast acknowledge lowers the timeout down to the floor
+    CU_ASSERT_EQUAL( timeout_getCycleLimit(pSsdoInst_l->txBuffParam_m.pTimeoutInst_m),
+            SSDO_TX_MIN_TIMEOUT_CYCLE_COUNT );
+
+    // Released slot can be filled in place
+    fReturn = ssdo_getCurrentTxBuffer(pSsdoInst_l, &pTxBuffer, &txBuffLen);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( txBuffLen, TSSDO_TRANSMIT_DATA_SIZE );
+
+    PSI_MEMSET(pTxBuffer, 0xCC, TX_PAYLOAD_LENGTH);
+
+    txState = ssdo_postPayload(pSsdoInst_l, pTxBuffer, TX_PAYLOAD_LENGTH);
+
+    CU_ASSERT_EQUAL( txState, kSsdoTxStatusSuccessful );
+
+    // Acknowledge all remaining frames in order
+    for(i=2; i < SSDO_TX_QUEUE_SIZE; i++)
+    {
+        fReturn = ackFrame((tSeqNrValue)pSsdoTxStruct->seqNr_m);
+
+        CU_ASSERT_TRUE( fReturn );
+        CU_ASSERT_EQUAL( pSsdoTxStruct->tssdoTransmitData_m[0], i + 1 );
+    }
+
+    fReturn = ackFrame((tSeqNrValue)pSsdoTxStruct->seqNr_m);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( pSsdoTxStruct->tssdoTransmitData_m[0], 0xCC );
+
+    // destroy instance
+    ssdo_destroy(pSsdoInst_l);
+}
+
+//============================================================================//
+//            P R I V A T E   F U N C T I O N S                               //
+//============================================================================//
+/// \name Private Functions
+/// \{
+
+//------------------------------------------------------------------------------
+/**
+\brief Simulate the acknowledge of the PCP and process the SSDO module
+
+\param seqNr_p      Sequence number written to the SSDO status field
+
+\return BOOL
+\retval TRUE    Processing success
+\retval FALSE   Error on processing
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL ackFrame(tSeqNrValue seqNr_p)
+{
+    BOOL fReturn;
+    tBuffDescriptor* pBuffDesc;
+    tTbufStatusOutStructure* pStatusOut;
+
+    pBuffDesc = stb_getDescElement(kTbufNumStatusOut);
+    pStatusOut = (tTbufStatusOutStructure*)pBuffDesc->pBuffBase_m;
+
+    if(seqNr_p == kSeqNrValueSecond)
+    {
+        pStatusOut->ssdoConsStatus_m |= (1 << kNumSsdoChan0);
+    }
+    else
+    {
+        pStatusOut->ssdoConsStatus_m &= ~(1 << kNumSsdoChan0);
+    }
+
+    // Process sync task and post actions to update the status register
+    fReturn = stream_processSync();
+
+    if(fReturn != FALSE)
+    {
+        fReturn = stream_processPostActions();
+    }
+
+    if(fReturn != FALSE)
+    {
+        // Process async task to post the next frame of the queue
+        fReturn = ssdo_process(pSsdoInst_l);
+    }
+
+    return fReturn;
+}
+
+/// \}
+
+#endif // #if (((PSI_MODULE_INTEGRATION) & (PSI_MODULE_SSDO)) != 0)
@@ -115,6 +115,7 @@ int TST_asyncInitStatus(void)
 
     // Initialize image of the transfer buffers
     stb_initBuffers();
+    PSI_MEMSET(&StreamInitParam, 0, sizeof(tStreamInitParam));
 
     // Init Stream module
     StreamInitParam.pfnStreamHandler_m = streamHandler;
@@ -121,10 +121,42 @@ static CU_TestInfo streamProcessFail[] = {
 };
 
 
+static CU_TestInfo streamDoubleBuff[] = {
+    { "Init stream module with transfer image", TST_doubleBuffInit },
+    { "Process stream module with transfer image", TST_doubleBuffProcess },
+    { "Trigger action only on changed buffer", TST_doubleBuffActionChanged },
+    { "Segment lists of the stream handler", TST_doubleBuffSegments },
+    CU_TEST_INFO_NULL,
+};
+
+static CU_TestInfo streamActionTable[] = {
+    { "Trigger actions ordered by priority", TST_actionPriority },
+    { "Register action with invalid parameters", TST_actionInvalidParam },
+    { "Remove a registered action", TST_actionUnregister },
+    { "Trigger actions with cycle divider", TST_actionRate },
+    CU_TEST_INFO_NULL,
+};
+
+static CU_TestInfo streamTiming[] = {
+    { "Measure execution time of actions", TST_timingMeasure },
+    { "Timing statistics with invalid parameters", TST_timingInvalid },
+    CU_TEST_INFO_NULL,
+};
+
+static CU_TestInfo streamSplitTrans[] = {
+    { "Finish asynchronous transfer", TST_splitTransFinish },
+    { "Unexpected and timed out asynchronous transfer", TST_splitTransInvalid },
+    CU_TEST_INFO_NULL,
+};
+
 static CU_SuiteInfo suites[] = {
     { "Stream module init suite", TST_defaultInit, TST_defaultClean, streamInit },
     { "Stream module process suite", TST_processInit, TST_defaultClean, streamProcess },
     { "Stream module process fail suite", TST_defaultInit, TST_defaultClean, streamProcessFail },
+    { "Stream module double buffer suite", TST_defaultInit, TST_defaultClean, streamDoubleBuff },
+    { "Stream module action table suite", TST_defaultInit, TST_defaultClean, streamActionTable },
+    { "Stream module timing suite", TST_defaultInit, TST_defaultClean, streamTiming },
+    { "Stream module asynchronous transfer suite", TST_defaultInit, TST_defaultClean, streamSplitTrans },
     CU_SUITE_INFO_NULL,
 };
 
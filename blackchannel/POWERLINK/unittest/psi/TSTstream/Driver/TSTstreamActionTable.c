@@ -0,0 +1,350 @@
+/**
+********************************************************************************
+\file   TSTstreamActionTable.c
+
+\brief  Test the action dispatch table of the stream module
+
+Test that buffer actions are triggered in the order of their priority and
+with their cycle divider and that invalid parameters are rejected.
+
+\ingroup module_unittests
+*******************************************************************************/
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2013 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+//------------------------------------------------------------------------------
+// includes
+//------------------------------------------------------------------------------
+#include <cunit/CUnit.h>
+
+#include <Driver/TSTstreamConfig.h>
+#include <Stubs/STBdescList.h>
+#include <Stubs/STBdummyHandler.h>
+#include <Stubs/STBinitStream.h>
+
+#include <libpsi/internal/stream.h>
+
+//============================================================================//
+//            G L O B A L   D E F I N I T I O N S                             //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// module global vars
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// global function prototypes
+//------------------------------------------------------------------------------
+
+
+//============================================================================//
+//            P R I V A T E   D E F I N I T I O N S                           //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+#define ACTION_ORDER_SIZE       4       ///< Maximum number of recorded actions
+#define RATE_TEST_CYCLES        6       ///< Number of cycles of the action rate test
+
+//------------------------------------------------------------------------------
+// local types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local vars
+//------------------------------------------------------------------------------
+static UINT8 actionOrder_l[ACTION_ORDER_SIZE];
+static UINT8 actionCount_l;
+
+//------------------------------------------------------------------------------
+// local function prototypes
+//------------------------------------------------------------------------------
+static BOOL recordAction(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_p);
+
+//============================================================================//
+//            P U B L I C   F U N C T I O N S                                 //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+/**
+\brief    Trigger actions in the order of their priority test
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_actionPriority(void)
+{
+    BOOL fReturn;
+    static UINT8 idAsync = 0;
+    static UINT8 idPdo = 1;
+    static UINT8 idStatus = 2;
+    static UINT8 idStatusSecond = 3;
+
+    stb_initBuffers();
+
+    fReturn = stb_initStreamModule();
+    CU_ASSERT_TRUE ( fReturn );
+
+    actionCount_l = 0;
+
+    // Register actions in reverse order of their priority
+    fReturn = stream_registerAction(kStreamActionPost, 0, recordAction, &idAsync,
+            kStreamActionPrioAsync, kStreamActionCondAlways);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_registerAction(kStreamActionPost, 0, recordAction, &idPdo,
+            kStreamActionPrioPdo, kStreamActionCondAlways);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_registerAction(kStreamActionPost, 0, recordAction, &idStatus,
+            kStreamActionPrioStatus, kStreamActionCondAlways);
+    CU_ASSERT_TRUE ( fReturn );
+
+    // Same priority is triggered in the order of registration
+    fReturn = stream_registerAction(kStreamActionPost, 0, recordAction, &idStatusSecond,
+            kStreamActionPrioStatus, kStreamActionCondAlways);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_processPostActions();
+    CU_ASSERT_TRUE ( fReturn );
+
+    CU_ASSERT_EQUAL ( actionCount_l, ACTION_ORDER_SIZE );
+    CU_ASSERT_EQUAL ( actionOrder_l[0], idStatus );
+    CU_ASSERT_EQUAL ( actionOrder_l[1], idStatusSecond );
+    CU_ASSERT_EQUAL ( actionOrder_l[2], idPdo );
+    CU_ASSERT_EQUAL ( actionOrder_l[3], idAsync );
+
+    // Pre actions are not affected by post actions
+    actionCount_l = 0;
+
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( actionCount_l, 0 );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Remove a registered action test
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_actionUnregister(void)
+{
+    BOOL fReturn;
+    static UINT8 idFirst = 0;
+    static UINT8 idSecond = 1;
+    static UINT8 idThird = 2;
+
+    stb_initBuffers();
+
+    fReturn = stb_initStreamModule();
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_registerAction(kStreamActionPost, 0, recordAction, &idFirst,
+            kStreamActionPrioAsync, kStreamActionCondAlways);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_registerAction(kStreamActionPost, 0, recordAction, &idSecond,
+            kStreamActionPrioAsync, kStreamActionCondAlways);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_registerAction(kStreamActionPost, 0, recordAction, &idThird,
+            kStreamActionPrioAsync, kStreamActionCondAlways);
+    CU_ASSERT_TRUE ( fReturn );
+
+    // Remove the action in the middle
+    fReturn = stream_unregisterAction(kStreamActionPost, 0, recordAction, &idSecond);
+    CU_ASSERT_TRUE ( fReturn );
+
+    actionCount_l = 0;
+
+    fReturn = stream_processPostActions();
+    CU_ASSERT_TRUE ( fReturn );
+
+    CU_ASSERT_EQUAL ( actionCount_l, 2 );
+    CU_ASSERT_EQUAL ( actionOrder_l[0], idFirst );
+    CU_ASSERT_EQUAL ( actionOrder_l[1], idThird );
+
+    // Action is not registered anymore
+    fReturn = stream_unregisterAction(kStreamActionPost, 0, recordAction, &idSecond);
+    CU_ASSERT_FALSE ( fReturn );
+
+    // Wrong action type
+    fReturn = stream_unregisterAction(kStreamActionPre, 0, recordAction, &idFirst);
+    CU_ASSERT_FALSE ( fReturn );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Register action with invalid priority or condition test
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_actionInvalidParam(void)
+{
+    BOOL fReturn;
+
+    stb_initBuffers();
+
+    fReturn = stb_initStreamModule();
+    CU_ASSERT_TRUE ( fReturn );
+
+    // Invalid priority
+    fReturn = stream_registerAction(kStreamActionPost, 0, stb_dummyActionSuccess, NULL,
+            kStreamActionPrioCount, kStreamActionCondAlways);
+    CU_ASSERT_FALSE ( fReturn );
+
+    // Invalid condition
+    fReturn = stream_registerAction(kStreamActionPost, 0, stb_dummyActionSuccess, NULL,
+            kStreamActionPrioAsync, kStreamActionCondCount);
+    CU_ASSERT_FALSE ( fReturn );
+
+    // Invalid buffer
+    fReturn = stream_registerAction(kStreamActionPost, kTbufCount, stb_dummyActionSuccess, NULL,
+            kStreamActionPrioAsync, kStreamActionCondAlways);
+    CU_ASSERT_FALSE ( fReturn );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Trigger actions with a cycle divider and phase test
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_actionRate(void)
+{
+    BOOL fReturn;
+    UINT8 i;
+    static UINT8 idEach = 0;
+    static UINT8 idPhase0 = 1;
+    static UINT8 idPhase2 = 2;
+    UINT8 expCount[RATE_TEST_CYCLES] = { 2, 1, 2, 2, 1, 2 };
+    UINT8 expSecond[RATE_TEST_CYCLES] = { 1, 0, 2, 1, 0, 2 };
+
+    stb_initBuffers();
+
+    fReturn = stb_initStreamModule();
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_registerAction(kStreamActionPost, 0, recordAction, &idEach,
+            kStreamActionPrioStatus, kStreamActionCondAlways);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_registerAction(kStreamActionPost, 1, recordAction, &idPhase0,
+            kStreamActionPrioAsync, kStreamActionCondAlways);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_registerAction(kStreamActionPost, 2, recordAction, &idPhase2,
+            kStreamActionPrioAsync, kStreamActionCondAlways);
+    CU_ASSERT_TRUE ( fReturn );
+
+    // Both slow actions every third cycle in different phases
+    fReturn = stream_setActionRate(kStreamActionPost, 1, 3, 0);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_setActionRate(kStreamActionPost, 2, 3, 2);
+    CU_ASSERT_TRUE ( fReturn );
+
+    for(i=0; i < RATE_TEST_CYCLES; i++)
+    {
+        actionCount_l = 0;
+
+        fReturn = stream_processPostActions();
+        CU_ASSERT_TRUE ( fReturn );
+
+        CU_ASSERT_EQUAL ( actionCount_l, expCount[i] );
+        CU_ASSERT_EQUAL ( actionOrder_l[0], idEach );
+
+        if(expCount[i] > 1)
+        {
+            CU_ASSERT_EQUAL ( actionOrder_l[1], expSecond[i] );
+        }
+    }
+
+    // Invalid divider
+    fReturn = stream_setActionRate(kStreamActionPost, 1, 0, 0);
+    CU_ASSERT_FALSE ( fReturn );
+
+    // Phase exceeds the divider
+    fReturn = stream_setActionRate(kStreamActionPost, 1, 3, 3);
+    CU_ASSERT_FALSE ( fReturn );
+
+    // No action registered to the buffer
+    fReturn = stream_setActionRate(kStreamActionPre, 1, 3, 0);
+    CU_ASSERT_FALSE ( fReturn );
+}
+
+//============================================================================//
+//            P R I V A T E   F U N C T I O N S                               //
+//============================================================================//
+/// \name Private Functions
+/// \{
+
+//------------------------------------------------------------------------------
+/**
+\brief    Action which records the order of its calls
+
+\param[in] pBuffer_p      Pointer to the buffer
+\param[in] bufSize_p      Size of the buffer
+\param[in] pUserArg_p     Pointer to the id of the action
+
+\return BOOL
+\retval TRUE        Always successful
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL recordAction(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_p)
+{
+    UNUSED_PARAMETER(pBuffer_p);
+    UNUSED_PARAMETER(bufSize_p);
+
+    if(actionCount_l < ACTION_ORDER_SIZE)
+    {
+        actionOrder_l[actionCount_l] = *(UINT8 *)pUserArg_p;
+    }
+
+    actionCount_l++;
+
+    return TRUE;
+}
+
+/// \}
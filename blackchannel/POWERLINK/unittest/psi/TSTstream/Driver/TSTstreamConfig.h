@@ -75,3 +75,23 @@ void TST_processFail(void);
 // Process failed tests
 void TST_processHandlerFail(void);
 void TST_processActionFail(void);
+
+// Double buffered image tests
+void TST_doubleBuffInit(void);
+void TST_doubleBuffProcess(void);
+void TST_doubleBuffActionChanged(void);
+void TST_doubleBuffSegments(void);
+
+// Action table tests
+void TST_actionPriority(void);
+void TST_actionInvalidParam(void);
+void TST_actionUnregister(void);
+void TST_actionRate(void);
+
+// Timing statistic tests
+void TST_timingMeasure(void);
+void TST_timingInvalid(void);
+
+// Asynchronous transfer tests
+void TST_splitTransFinish(void);
+void TST_splitTransInvalid(void);
@@ -0,0 +1,492 @@
+/**
+********************************************************************************
+\file   TSTstreamDoubleBuffer.c
+
+\brief  Test the double buffered transfer image of the stream module
+
+Test that the stream handler only works on the transfer image and that the
+working image is updated in the pre and post transfer phase.
+
+\ingroup module_unittests
+*******************************************************************************/
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2013 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+//------------------------------------------------------------------------------
+// includes
+//------------------------------------------------------------------------------
+#include <cunit/CUnit.h>
+
+#include <Driver/TSTstreamConfig.h>
+#include <Stubs/STBdescList.h>
+#include <Stubs/STBdummyHandler.h>
+
+#include <libpsi/internal/stream.h>
+
+//============================================================================//
+//            G L O B A L   D E F I N I T I O N S                             //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// module global vars
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// global function prototypes
+//------------------------------------------------------------------------------
+
+
+//============================================================================//
+//            P R I V A T E   D E F I N I T I O N S                           //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+#define TRANS_IMAGE_SIZE     ( TBUF_OFFSET_PROACK + TBUF_SIZE_PROACK )   ///< Size of the transfer image
+
+#define TEST_PATTERN_PROD    0xA5      ///< Pattern written to the producing buffers
+#define TEST_PATTERN_CONS    0x5A      ///< Pattern written to the consuming buffers
+
+//------------------------------------------------------------------------------
+// local types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local vars
+//------------------------------------------------------------------------------
+static UINT8 transImage_l[TRANS_IMAGE_SIZE + kTbufCount];
+static tBuffDescriptor transDescList_l[kTbufCount];
+static tHandlerParam handlParam_l;
+static UINT8 actionCallCount_l;
+
+//------------------------------------------------------------------------------
+// local function prototypes
+//------------------------------------------------------------------------------
+static void initTransImage(void);
+static void initScatteredTransImage(void);
+static BOOL initDoubleBuffered(tBuffDescriptor* pTransDescList_p);
+static BOOL streamHandlerFillCons(tHandlerParam* pHandlParam_p);
+static BOOL isFilled(UINT8* pBuffer_p, UINT16 size_p, UINT8 pattern_p);
+static BOOL countAction(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_p);
+
+//============================================================================//
+//            P U B L I C   F U N C T I O N S                                 //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+/**
+\brief    Initialize the stream module in double buffered mode test
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_doubleBuffInit(void)
+{
+    BOOL fReturn;
+
+    // Transfer image with a different layout
+    initTransImage();
+    transDescList_l[kTbufCount - 1].buffSize_m++;
+
+    fReturn = initDoubleBuffered(&transDescList_l[0]);
+    CU_ASSERT_FALSE ( fReturn );
+
+    // Transfer image with a missing buffer
+    initTransImage();
+    transDescList_l[0].pBuffBase_m = NULL;
+
+    fReturn = initDoubleBuffered(&transDescList_l[0]);
+    CU_ASSERT_FALSE ( fReturn );
+
+    // Transfer image with a valid layout
+    initTransImage();
+
+    fReturn = initDoubleBuffered(&transDescList_l[0]);
+    CU_ASSERT_TRUE ( fReturn );
+
+    stream_exit();
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Process the stream module in double buffered mode test
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_doubleBuffProcess(void)
+{
+    BOOL fReturn;
+    UINT8 i;
+    tBuffDescriptor* pWorkDesc;
+
+    initTransImage();
+
+    fReturn = initDoubleBuffered(&transDescList_l[0]);
+    CU_ASSERT_TRUE ( fReturn );
+
+    // Fill producing buffers of the working image
+    for(i = TBUF_NUM_CON + 1; i < kTbufCount; i++)
+    {
+        pWorkDesc = stb_getDescElement((tTbufNumLayout)i);
+        PSI_MEMSET(pWorkDesc->pBuffBase_m, TEST_PATTERN_PROD, pWorkDesc->buffSize_m);
+    }
+
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+
+    // Stream handler is only allowed to see the transfer image
+    CU_ASSERT_EQUAL ( handlParam_l.prodDesc_m.pBuffBase_m, transDescList_l[TBUF_NUM_CON + 1].pBuffBase_m );
+
+    // Producing buffers are handed over to the transfer image
+    for(i = TBUF_NUM_CON + 1; i < kTbufCount; i++)
+    {
+        CU_ASSERT_TRUE ( isFilled(transDescList_l[i].pBuffBase_m,
+                transDescList_l[i].buffSize_m, TEST_PATTERN_PROD) );
+    }
+
+    // Working image consuming buffers are untouched by the transfer
+    for(i = 0; i < TBUF_NUM_CON + 1; i++)
+    {
+        pWorkDesc = stb_getDescElement((tTbufNumLayout)i);
+        CU_ASSERT_FALSE ( isFilled(pWorkDesc->pBuffBase_m,
+                pWorkDesc->buffSize_m, TEST_PATTERN_CONS) );
+    }
+
+    fReturn = stream_processPostActions();
+    CU_ASSERT_TRUE ( fReturn );
+
+    // Consuming buffers are taken over after the transfer
+    for(i = 0; i < TBUF_NUM_CON + 1; i++)
+    {
+        pWorkDesc = stb_getDescElement((tTbufNumLayout)i);
+        CU_ASSERT_TRUE ( isFilled(pWorkDesc->pBuffBase_m,
+                pWorkDesc->buffSize_m, TEST_PATTERN_CONS) );
+    }
+
+    stream_exit();
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Trigger action only on a changed buffer test
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_doubleBuffActionChanged(void)
+{
+    BOOL fReturn;
+
+    initTransImage();
+
+    fReturn = initDoubleBuffered(&transDescList_l[0]);
+    CU_ASSERT_TRUE ( fReturn );
+
+    actionCallCount_l = 0;
+
+    fReturn = stream_registerAction(kStreamActionPost, 1, countAction, NULL,
+            kStreamActionPrioAsync, kStreamActionCondChanged);
+    CU_ASSERT_TRUE ( fReturn );
+
+    // Consuming buffer is filled by the first transfer
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+    fReturn = stream_processPostActions();
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( actionCallCount_l, 1 );
+
+    // Second transfer receives the same content
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+    fReturn = stream_processPostActions();
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( actionCallCount_l, 1 );
+
+    // Content changes in the transfer image
+    transDescList_l[1].pBuffBase_m[0]++;
+
+    fReturn = stream_processPostActions();
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( actionCallCount_l, 2 );
+
+    stream_exit();
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Segment lists of the stream handler parameters test
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_doubleBuffSegments(void)
+{
+    BOOL fReturn;
+    UINT8 i;
+    tBuffDescriptor* pWorkDesc;
+    tTbufNumLayout idFirstProd = (tTbufNumLayout)(TBUF_NUM_CON + 1);
+    UINT16 consSize = 0;
+
+    // Contiguous transfer image provides both descriptors and segments
+    initTransImage();
+
+    fReturn = initDoubleBuffered(&transDescList_l[0]);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+
+    CU_ASSERT_EQUAL ( handlParam_l.consSegs_m.segCount_m, idFirstProd );
+    CU_ASSERT_EQUAL ( handlParam_l.prodSegs_m.segCount_m, kTbufCount - idFirstProd );
+    CU_ASSERT_EQUAL ( handlParam_l.consDesc_m.pBuffBase_m, transDescList_l[0].pBuffBase_m );
+    CU_ASSERT_EQUAL ( handlParam_l.prodDesc_m.pBuffBase_m, transDescList_l[idFirstProd].pBuffBase_m );
+
+    for(i=0; i < handlParam_l.consSegs_m.segCount_m; i++)
+    {
+        CU_ASSERT_EQUAL ( handlParam_l.consSegs_m.pSegList_m[i].pBuffBase_m,
+                transDescList_l[i].pBuffBase_m );
+    }
+
+    for(i=0; i < handlParam_l.prodSegs_m.segCount_m; i++)
+    {
+        CU_ASSERT_EQUAL ( handlParam_l.prodSegs_m.pSegList_m[i].pBuffBase_m,
+                transDescList_l[idFirstProd + i].pBuffBase_m );
+    }
+
+    // Scattered transfer image is only described by the segments
+    initScatteredTransImage();
+
+    for(i = 0; i < idFirstProd; i++)
+    {
+        consSize += transDescList_l[i].buffSize_m;
+    }
+
+    fReturn = initDoubleBuffered(&transDescList_l[0]);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+
+    CU_ASSERT_EQUAL ( handlParam_l.consDesc_m.pBuffBase_m, NULL );
+    CU_ASSERT_EQUAL ( handlParam_l.prodDesc_m.pBuffBase_m, NULL );
+    CU_ASSERT_EQUAL ( handlParam_l.consDesc_m.buffSize_m, consSize );
+    CU_ASSERT_EQUAL ( handlParam_l.consSegs_m.pSegList_m[1].pBuffBase_m,
+            transDescList_l[1].pBuffBase_m );
+
+    fReturn = stream_processPostActions();
+    CU_ASSERT_TRUE ( fReturn );
+
+    // Consuming buffers are received through the segments
+    for(i = 0; i < idFirstProd; i++)
+    {
+        pWorkDesc = stb_getDescElement((tTbufNumLayout)i);
+        CU_ASSERT_TRUE ( isFilled(pWorkDesc->pBuffBase_m,
+                pWorkDesc->buffSize_m, TEST_PATTERN_CONS) );
+    }
+
+    stream_exit();
+}
+
+//============================================================================//
+//            P R I V A T E   F U N C T I O N S                               //
+//============================================================================//
+/// \name Private Functions
+/// \{
+
+//------------------------------------------------------------------------------
+/**
+\brief    Initialize the transfer image and its descriptor list
+
+The transfer image has the same layout as the working image of the
+descriptor list stub.
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static void initTransImage(void)
+{
+    UINT8 i;
+    tTbufDescriptor tbufDescList[kTbufCount] = TBUF_INIT_VEC;
+
+    PSI_MEMSET(&transImage_l, 0, sizeof(transImage_l));
+
+    for(i=0; i < kTbufCount; i++)
+    {
+        transDescList_l[i].pBuffBase_m = &transImage_l[tbufDescList[i].buffOffset_m];
+        transDescList_l[i].buffSize_m = tbufDescList[i].buffSize_m;
+    }
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Initialize a transfer image with a gap after each buffer
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static void initScatteredTransImage(void)
+{
+    UINT8 i;
+    tTbufDescriptor tbufDescList[kTbufCount] = TBUF_INIT_VEC;
+
+    PSI_MEMSET(&transImage_l, 0, sizeof(transImage_l));
+
+    for(i=0; i < kTbufCount; i++)
+    {
+        transDescList_l[i].pBuffBase_m = &transImage_l[tbufDescList[i].buffOffset_m + i];
+        transDescList_l[i].buffSize_m = tbufDescList[i].buffSize_m;
+    }
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Initialize the stream module with a transfer image
+
+\param[in] pTransDescList_p      Descriptor list of the transfer image
+
+\return BOOL
+\retval TRUE        Stream module initialized successfully
+\retval FALSE       Initialization failed
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL initDoubleBuffered(tBuffDescriptor* pTransDescList_p)
+{
+    tStreamInitParam InitParam;
+
+    stb_initBuffers();
+
+    PSI_MEMSET(&InitParam, 0, sizeof(tStreamInitParam));
+
+    InitParam.pfnStreamHandler_m = streamHandlerFillCons;
+    InitParam.pBuffDescList_m = stb_getDescList();
+    InitParam.idConsAck_m = (tTbufNumLayout)0;
+    InitParam.idFirstProdBuffer_m = (tTbufNumLayout)(TBUF_NUM_CON + 1);
+    InitParam.pTransDescList_m = pTransDescList_p;
+
+    return stream_init(&InitParam);
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Stream handler which simulates the reception of consuming data
+
+\param[in] pHandlParam_p      Parameters of the stream handler
+
+\return BOOL
+\retval TRUE        Always successful
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL streamHandlerFillCons(tHandlerParam* pHandlParam_p)
+{
+    UINT8 i;
+    tBuffDescriptor* pSeg;
+
+    handlParam_l = *pHandlParam_p;
+
+    for(i=0; i < pHandlParam_p->consSegs_m.segCount_m; i++)
+    {
+        pSeg = &pHandlParam_p->consSegs_m.pSegList_m[i];
+        PSI_MEMSET(pSeg->pBuffBase_m, TEST_PATTERN_CONS, pSeg->buffSize_m);
+    }
+
+    return TRUE;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Check if a buffer is filled with a pattern
+
+\param[in] pBuffer_p      Pointer to the buffer
+\param[in] size_p         Size of the buffer
+\param[in] pattern_p      Expected pattern
+
+\return BOOL
+\retval TRUE        Buffer contains only the pattern
+\retval FALSE       Buffer differs from the pattern
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL isFilled(UINT8* pBuffer_p, UINT16 size_p, UINT8 pattern_p)
+{
+    BOOL fReturn = TRUE;
+    UINT16 i;
+
+    for(i=0; i < size_p; i++)
+    {
+        if(pBuffer_p[i] != pattern_p)
+        {
+            fReturn = FALSE;
+            break;
+        }
+    }
+
+    return fReturn;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Action which counts its calls
+
+\param[in] pBuffer_p      Pointer to the buffer
+\param[in] bufSize_p      Size of the buffer
+\param[in] pUserArg_p     User argument of the action
+
+\return BOOL
+\retval TRUE        Always successful
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL countAction(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_p)
+{
+    UNUSED_PARAMETER(pBuffer_p);
+    UNUSED_PARAMETER(bufSize_p);
+    UNUSED_PARAMETER(pUserArg_p);
+
+    actionCallCount_l++;
+
+    return TRUE;
+}
+
+/// \}
@@ -113,6 +113,7 @@ int TST_processInit(void)
 
     // Create image of the transfer buffers
     stb_initBuffers();
+    PSI_MEMSET(&InitParam, 0, sizeof(tStreamInitParam));
 
     // Init module
     InitParam.pfnStreamHandler_m = stb_streamHandlerSuccess;
@@ -138,13 +139,15 @@ void TST_addAction(void)
     UINT8 i;
 
     // Register action invalid parameter
-    fReturn = stream_registerAction(kStreamActionPre, 0, NULL, NULL);
+    fReturn = stream_registerAction(kStreamActionPre, 0, NULL, NULL,
+            kStreamActionPrioAsync, kStreamActionCondAlways);
 
     CU_ASSERT_FALSE ( fReturn );
 
     // Another invalid parameter
     fReturn = stream_registerAction(kStreamActionInvalid, 0,
-        stb_dummyActionSuccess, NULL);
+        stb_dummyActionSuccess, NULL,
+        kStreamActionPrioAsync, kStreamActionCondAlways);
 
     CU_ASSERT_FALSE ( fReturn );
 
@@ -152,7 +155,8 @@ void TST_addAction(void)
     for(i=0; i < kTbufCount; i++)
     {
         fReturn = stream_registerAction(kStreamActionPre, 0,
-            stb_dummyActionSuccess, NULL);
+            stb_dummyActionSuccess, NULL,
+        kStreamActionPrioAsync, kStreamActionCondAlways);
     }
 
     CU_ASSERT_TRUE ( fReturn );
@@ -161,20 +165,23 @@ void TST_addAction(void)
     for(i=0; i < kTbufCount; i++)
     {
         fReturn = stream_registerAction(kStreamActionPost, 0,
-            stb_dummyActionSuccess, NULL);
+            stb_dummyActionSuccess, NULL,
+        kStreamActionPrioAsync, kStreamActionCondAlways);
     }
 
     CU_ASSERT_TRUE ( fReturn );
 
     // Register one more pre action
     fReturn = stream_registerAction(kStreamActionPre, 0,
-            stb_dummyActionSuccess, NULL);
+            stb_dummyActionSuccess, NULL,
+        kStreamActionPrioAsync, kStreamActionCondAlways);
 
     CU_ASSERT_FALSE ( fReturn );
 
     // Register one more post action
     fReturn = stream_registerAction(kStreamActionPost, 0,
-            stb_dummyActionSuccess, NULL);
+            stb_dummyActionSuccess, NULL,
+        kStreamActionPrioAsync, kStreamActionCondAlways);
 
     CU_ASSERT_FALSE ( fReturn );
 }
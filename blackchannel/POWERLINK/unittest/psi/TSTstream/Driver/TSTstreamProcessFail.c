@@ -108,6 +108,7 @@ void TST_processHandlerFail(void)
 
     // Create image of the transfer buffers
     stb_initBuffers();
+    PSI_MEMSET(&InitParam, 0, sizeof(tStreamInitParam));
 
     // Init module with failing stream handler
     InitParam.pfnStreamHandler_m = stb_streamHandlerFail;
@@ -159,6 +160,7 @@ static void actionFailTest(tActionType action_p)
     tStreamInitParam InitParam;
 
     stb_initBuffers();
+    PSI_MEMSET(&InitParam, 0, sizeof(tStreamInitParam));
 
     // Init module with failing stream handler
     InitParam.pfnStreamHandler_m = stb_streamHandlerSuccess;
@@ -172,7 +174,8 @@ static void actionFailTest(tActionType action_p)
 
     CU_ASSERT_TRUE ( fReturn );
 
-    fReturn = stream_registerAction(action_p, 0, stb_dummyActionFail, NULL);
+    fReturn = stream_registerAction(action_p, 0, stb_dummyActionFail, NULL,
+            kStreamActionPrioAsync, kStreamActionCondAlways);
 
     CU_ASSERT_TRUE ( fReturn );
 
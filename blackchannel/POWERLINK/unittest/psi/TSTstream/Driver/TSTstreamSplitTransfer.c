@@ -0,0 +1,321 @@
+/**
+********************************************************************************
+\file   TSTstreamSplitTransfer.c
+
+\brief  Test the asynchronous transfer of the stream module
+
+Test that the post actions are triggered by the transfer finished event and
+that a transfer which does not finish is aborted after a timeout.
+
+\ingroup module_unittests
+*******************************************************************************/
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2013 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+//------------------------------------------------------------------------------
+// includes
+//------------------------------------------------------------------------------
+#include <cunit/CUnit.h>
+
+#include <Driver/TSTstreamConfig.h>
+#include <Stubs/STBdescList.h>
+#include <Stubs/STBdummyHandler.h>
+
+#include <libpsi/internal/stream.h>
+
+//============================================================================//
+//            G L O B A L   D E F I N I T I O N S                             //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// module global vars
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// global function prototypes
+//------------------------------------------------------------------------------
+
+
+//============================================================================//
+//            P R I V A T E   D E F I N I T I O N S                           //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local vars
+//------------------------------------------------------------------------------
+static UINT8 preCount_l;
+static UINT8 postCount_l;
+
+//------------------------------------------------------------------------------
+// local function prototypes
+//------------------------------------------------------------------------------
+static BOOL initAsyncStream(UINT8 transTimeoutCycles_p);
+static BOOL countPreAction(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_p);
+static BOOL countPostAction(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_p);
+
+//============================================================================//
+//            P U B L I C   F U N C T I O N S                                 //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+/**
+\brief    Finish an asynchronous transfer test
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_splitTransFinish(void)
+{
+    BOOL fReturn;
+
+    fReturn = initAsyncStream(0);
+    CU_ASSERT_TRUE ( fReturn );
+
+    // Start the transfer
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( preCount_l, 1 );
+    CU_ASSERT_EQUAL ( postCount_l, 0 );
+
+    // Transfer still in progress -> Cycle is skipped
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( preCount_l, 1 );
+
+    // Transfer finished -> Post actions are processed
+    fReturn = stream_transferFinished(FALSE);
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( postCount_l, 1 );
+
+    // Next transfer is started
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( preCount_l, 2 );
+
+    // Failed transfer -> No post actions
+    fReturn = stream_transferFinished(TRUE);
+    CU_ASSERT_FALSE ( fReturn );
+    CU_ASSERT_EQUAL ( postCount_l, 1 );
+
+    // A failed transfer is not pending anymore
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( preCount_l, 3 );
+
+    stream_exit();
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Unexpected and timed out asynchronous transfer test
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_splitTransInvalid(void)
+{
+    BOOL fReturn;
+    UINT8 i;
+
+    fReturn = initAsyncStream(0);
+    CU_ASSERT_TRUE ( fReturn );
+
+    // No transfer in progress
+    fReturn = stream_transferFinished(FALSE);
+    CU_ASSERT_FALSE ( fReturn );
+    CU_ASSERT_EQUAL ( postCount_l, 0 );
+
+    // Start a transfer which never finishes
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+
+    for(i = 0; i < STREAM_TRANS_TIMEOUT_CYCLE_COUNT; i++)
+    {
+        fReturn = stream_processSync();
+        CU_ASSERT_TRUE ( fReturn );
+    }
+
+    // Transfer is aborted
+    fReturn = stream_processSync();
+    CU_ASSERT_FALSE ( fReturn );
+    CU_ASSERT_EQUAL ( preCount_l, 1 );
+
+    // Late finished event of the aborted transfer
+    fReturn = stream_transferFinished(FALSE);
+    CU_ASSERT_FALSE ( fReturn );
+    CU_ASSERT_EQUAL ( postCount_l, 0 );
+
+    // Next cycle starts a new transfer
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( preCount_l, 2 );
+
+    stream_exit();
+
+    // Configured timeout replaces the default
+    fReturn = initAsyncStream(STREAM_TRANS_TIMEOUT_CYCLE_COUNT + 3);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+
+    for(i = 0; i < STREAM_TRANS_TIMEOUT_CYCLE_COUNT + 3; i++)
+    {
+        fReturn = stream_processSync();
+        CU_ASSERT_TRUE ( fReturn );
+    }
+
+    fReturn = stream_processSync();
+    CU_ASSERT_FALSE ( fReturn );
+    CU_ASSERT_EQUAL ( preCount_l, 1 );
+
+    stream_exit();
+}
+
+//============================================================================//
+//            P R I V A T E   F U N C T I O N S                               //
+//============================================================================//
+/// \name Private Functions
+/// \{
+
+//------------------------------------------------------------------------------
+/**
+\brief    Initialize the stream module with an asynchronous transfer
+
+\param transTimeoutCycles_p     Cycles the transfer may be in progress (0: Default)
+
+\return BOOL
+\retval TRUE        Stream module initialized successfully
+\retval FALSE       Initialization failed
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL initAsyncStream(UINT8 transTimeoutCycles_p)
+{
+    BOOL fReturn = FALSE;
+    tStreamInitParam InitParam;
+
+    stb_initBuffers();
+
+    preCount_l = 0;
+    postCount_l = 0;
+
+    PSI_MEMSET(&InitParam, 0, sizeof(tStreamInitParam));
+
+    InitParam.pfnStreamHandler_m = stb_streamHandlerSuccess;
+    InitParam.pBuffDescList_m = stb_getDescList();
+    InitParam.idConsAck_m = (tTbufNumLayout)0;
+    InitParam.idFirstProdBuffer_m = (tTbufNumLayout)(TBUF_NUM_CON + 1);
+    InitParam.fAsyncTransfer_m = TRUE;
+    InitParam.transTimeoutCycles_m = transTimeoutCycles_p;
+
+    if(stream_init(&InitParam))
+    {
+        stream_registerSyncCb(stb_dummySyncCbSuccess);
+
+        if(stream_registerAction(kStreamActionPre, 1, countPreAction, NULL,
+                kStreamActionPrioAsync, kStreamActionCondAlways) &&
+           stream_registerAction(kStreamActionPost, 1, countPostAction, NULL,
+                kStreamActionPrioAsync, kStreamActionCondAlways))
+        {
+            fReturn = TRUE;
+        }
+    }
+
+    return fReturn;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Pre action which counts its calls
+
+\param[in] pBuffer_p      Pointer to the buffer
+\param[in] bufSize_p      Size of the buffer
+\param[in] pUserArg_p     User argument of the action
+
+\return BOOL
+\retval TRUE        Always successful
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL countPreAction(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_p)
+{
+    UNUSED_PARAMETER(pBuffer_p);
+    UNUSED_PARAMETER(bufSize_p);
+    UNUSED_PARAMETER(pUserArg_p);
+
+    preCount_l++;
+
+    return TRUE;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Post action which counts its calls
+
+\param[in] pBuffer_p      Pointer to the buffer
+\param[in] bufSize_p      Size of the buffer
+\param[in] pUserArg_p     User argument of the action
+
+\return BOOL
+\retval TRUE        Always successful
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL countPostAction(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_p)
+{
+    UNUSED_PARAMETER(pBuffer_p);
+    UNUSED_PARAMETER(bufSize_p);
+    UNUSED_PARAMETER(pUserArg_p);
+
+    postCount_l++;
+
+    return TRUE;
+}
+
+/// \}
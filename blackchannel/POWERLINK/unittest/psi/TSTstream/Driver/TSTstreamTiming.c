@@ -0,0 +1,312 @@
+/**
+********************************************************************************
+\file   TSTstreamTiming.c
+
+\brief  Test the timing statistics of the stream module
+
+Test that the execution time of the buffer actions and of the stream handler
+is measured with the cycle counter passed on initialization.
+
+\ingroup module_unittests
+*******************************************************************************/
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2013 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+//------------------------------------------------------------------------------
+// includes
+//------------------------------------------------------------------------------
+#include <cunit/CUnit.h>
+
+#include <Driver/TSTstreamConfig.h>
+#include <Stubs/STBdescList.h>
+#include <Stubs/STBdummyHandler.h>
+
+#include <libpsi/internal/stream.h>
+
+//============================================================================//
+//            G L O B A L   D E F I N I T I O N S                             //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// module global vars
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// global function prototypes
+//------------------------------------------------------------------------------
+
+
+//============================================================================//
+//            P R I V A T E   D E F I N I T I O N S                           //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+#define HANDLER_COST        50      ///< Cycles consumed by the stream handler
+
+//------------------------------------------------------------------------------
+// local types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local vars
+//------------------------------------------------------------------------------
+static UINT32 cycleCount_l;
+static UINT32 actionCost_l;
+
+//------------------------------------------------------------------------------
+// local function prototypes
+//------------------------------------------------------------------------------
+static BOOL initTimedStream(tStreamCycleCount pfnCycleCount_p);
+static UINT32 getCycleCount(void);
+static BOOL costlyAction(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_p);
+static BOOL costlyHandler(tHandlerParam* pHandlParam_p);
+
+//============================================================================//
+//            P U B L I C   F U N C T I O N S                                 //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+/**
+\brief    Measure the execution time of actions and handler test
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_timingMeasure(void)
+{
+    BOOL fReturn;
+    tStreamTiming timing;
+
+    fReturn = initTimedStream(getCycleCount);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_registerAction(kStreamActionPre, 1, costlyAction, NULL,
+            kStreamActionPrioAsync, kStreamActionCondAlways);
+    CU_ASSERT_TRUE ( fReturn );
+
+    // Counter wraps during the measurement
+    cycleCount_l = 0xFFFFFFF0;
+
+    actionCost_l = 10;
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+
+    actionCost_l = 100;
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+
+    actionCost_l = 1000;
+    fReturn = stream_processSync();
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_getTiming(kStreamTimingPreAction, 1, &timing);
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( timing.count_m, 3 );
+    CU_ASSERT_EQUAL ( timing.min_m, 10 );
+    CU_ASSERT_EQUAL ( timing.max_m, 1000 );
+    CU_ASSERT_EQUAL ( timing.mean_m, 370 );
+
+    // Bins are limited by 64, 128, 256, 512, 1024 cycles
+    CU_ASSERT_EQUAL ( timing.hist_m[0], 1 );
+    CU_ASSERT_EQUAL ( timing.hist_m[1], 1 );
+    CU_ASSERT_EQUAL ( timing.hist_m[4], 1 );
+
+    fReturn = stream_getTiming(kStreamTimingHandler, 0, &timing);
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( timing.count_m, 3 );
+    CU_ASSERT_EQUAL ( timing.min_m, HANDLER_COST );
+    CU_ASSERT_EQUAL ( timing.max_m, HANDLER_COST );
+
+    // Reset all statistics
+    stream_resetTiming();
+
+    fReturn = stream_getTiming(kStreamTimingPreAction, 1, &timing);
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( timing.count_m, 0 );
+    CU_ASSERT_EQUAL ( timing.mean_m, 0 );
+    CU_ASSERT_EQUAL ( timing.hist_m[4], 0 );
+
+    stream_exit();
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Timing statistics without cycle counter and invalid parameters test
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_timingInvalid(void)
+{
+    BOOL fReturn;
+    tStreamTiming timing;
+
+    fReturn = initTimedStream(NULL);
+    CU_ASSERT_TRUE ( fReturn );
+
+    fReturn = stream_registerAction(kStreamActionPost, 1, costlyAction, NULL,
+            kStreamActionPrioAsync, kStreamActionCondAlways);
+    CU_ASSERT_TRUE ( fReturn );
+
+    actionCost_l = 10;
+    fReturn = stream_processPostActions();
+    CU_ASSERT_TRUE ( fReturn );
+
+    // Nothing is measured without a cycle counter
+    fReturn = stream_getTiming(kStreamTimingPostAction, 1, &timing);
+    CU_ASSERT_TRUE ( fReturn );
+    CU_ASSERT_EQUAL ( timing.count_m, 0 );
+
+    // No action registered to the buffer
+    fReturn = stream_getTiming(kStreamTimingPreAction, 1, &timing);
+    CU_ASSERT_FALSE ( fReturn );
+
+    // Invalid parameters
+    fReturn = stream_getTiming(kStreamTimingPostAction, 1, NULL);
+    CU_ASSERT_FALSE ( fReturn );
+
+    fReturn = stream_getTiming((tStreamTimingSrc)0xFF, 1, &timing);
+    CU_ASSERT_FALSE ( fReturn );
+
+    stream_exit();
+}
+
+//============================================================================//
+//            P R I V A T E   F U N C T I O N S                               //
+//============================================================================//
+/// \name Private Functions
+/// \{
+
+//------------------------------------------------------------------------------
+/**
+\brief    Initialize the stream module with a cycle counter
+
+\param[in] pfnCycleCount_p      Cycle counter of the statistics
+
+\return BOOL
+\retval TRUE        Stream module initialized successfully
+\retval FALSE       Initialization failed
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL initTimedStream(tStreamCycleCount pfnCycleCount_p)
+{
+    BOOL fReturn;
+    tStreamInitParam InitParam;
+
+    stb_initBuffers();
+
+    PSI_MEMSET(&InitParam, 0, sizeof(tStreamInitParam));
+
+    InitParam.pfnStreamHandler_m = costlyHandler;
+    InitParam.pBuffDescList_m = stb_getDescList();
+    InitParam.idConsAck_m = (tTbufNumLayout)0;
+    InitParam.idFirstProdBuffer_m = (tTbufNumLayout)(TBUF_NUM_CON + 1);
+    InitParam.pfnCycleCount_m = pfnCycleCount_p;
+
+    fReturn = stream_init(&InitParam);
+
+    stream_registerSyncCb(stb_dummySyncCbSuccess);
+
+    return fReturn;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Simulated cycle counter of the target
+
+\return UINT32
+\retval Current value of the simulated counter
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static UINT32 getCycleCount(void)
+{
+    return cycleCount_l;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Action which consumes a configurable amount of cycles
+
+\param[in] pBuffer_p      Pointer to the buffer
+\param[in] bufSize_p      Size of the buffer
+\param[in] pUserArg_p     User argument of the action
+
+\return BOOL
+\retval TRUE        Always successful
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL costlyAction(UINT8* pBuffer_p, UINT16 bufSize_p, void * pUserArg_p)
+{
+    UNUSED_PARAMETER(pBuffer_p);
+    UNUSED_PARAMETER(bufSize_p);
+    UNUSED_PARAMETER(pUserArg_p);
+
+    cycleCount_l += actionCost_l;
+
+    return TRUE;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Stream handler which consumes a fixed amount of cycles
+
+\param[in] pHandlParam_p      Parameters of the stream handler
+
+\return BOOL
+\retval TRUE        Always successful
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL costlyHandler(tHandlerParam* pHandlParam_p)
+{
+    UNUSED_PARAMETER(pHandlParam_p);
+
+    cycleCount_l += HANDLER_COST;
+
+    return TRUE;
+}
+
+/// \}
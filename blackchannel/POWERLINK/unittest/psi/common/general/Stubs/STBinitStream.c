@@ -104,6 +104,8 @@ BOOL stb_initStreamModule(void)
     BOOL fReturn;
     tStreamInitParam InitParam;
 
+    PSI_MEMSET(&InitParam, 0, sizeof(tStreamInitParam));
+
         // Setup stream module init parameters
     InitParam.pfnStreamHandler_m = stb_streamHandlerSuccess;
     InitParam.pBuffDescList_m = stb_getDescList();
@@ -137,7 +139,8 @@ BOOL stb_initAllActions(tTbufNumLayout buffId_p, tActionType actionType_p, UINT8
 
     for(i=0; i < actCount_p; i++)
     {
-        fReturn = stream_registerAction(actionType_p, buffId_p, stb_dummyActionSuccess, NULL);
+        fReturn = stream_registerAction(actionType_p, buffId_p, stb_dummyActionSuccess, NULL,
+            kStreamActionPrioAsync, kStreamActionCondAlways);
         if(fReturn == FALSE)
             break;
     }
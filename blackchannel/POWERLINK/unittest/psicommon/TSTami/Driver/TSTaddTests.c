@@ -106,6 +106,8 @@ static CU_TestInfo amiSuite[] = {
     { "Uint16 conversion function", TST_amiUint16 },
     { "Uint32 conversion function", TST_amiUint32 },
     { "Uint64 conversion function", TST_amiUint64 },
+    { "Unaligned conversion function", TST_amiUnaligned },
+    { "Array conversion function", TST_amiArray },
     CU_TEST_INFO_NULL,
 };
 
@@ -117,6 +117,9 @@
   #define UINT64_OUT_DATA_GET_FROM_LE   UINT64_IN_DATA
 #endif
 
+#define TEST_UNALIGNED_OFFSET           1       ///< Offset of the unaligned accesses
+#define TEST_ARRAY_COUNT                5       ///< Number of values of the array tests
+
 
 //------------------------------------------------------------------------------
 // local types
@@ -234,6 +237,130 @@ void TST_amiUint64(void)
     CU_ASSERT_EQUAL(outData, UINT64_OUT_DATA_GET_FROM_LE);
 }
 
+//------------------------------------------------------------------------------
+/**
+\brief    Test ami conversion functions on unaligned addresses
+
+The resulting byte order is checked directly in the buffer.
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_amiUnaligned(void)
+{
+    UINT8 buffer[sizeof(UINT64) * 2];
+    UINT8* pAddr = &buffer[TEST_UNALIGNED_OFFSET];
+
+    // Test uint16 on an odd address
+    ami_setUint16Be(pAddr, UINT16_IN_DATA);
+
+    CU_ASSERT_EQUAL(pAddr[0], 0xAA);
+    CU_ASSERT_EQUAL(pAddr[1], 0xBB);
+    CU_ASSERT_EQUAL(ami_getUint16Be(pAddr), UINT16_IN_DATA);
+
+    ami_setUint16Le(pAddr, UINT16_IN_DATA);
+
+    CU_ASSERT_EQUAL(pAddr[0], 0xBB);
+    CU_ASSERT_EQUAL(pAddr[1], 0xAA);
+    CU_ASSERT_EQUAL(ami_getUint16Le(pAddr), UINT16_IN_DATA);
+
+    // Test uint32 on an odd address
+    ami_setUint32Be(pAddr, UINT32_IN_DATA);
+
+    CU_ASSERT_EQUAL(pAddr[0], 0xAA);
+    CU_ASSERT_EQUAL(pAddr[3], 0xDD);
+    CU_ASSERT_EQUAL(ami_getUint32Be(pAddr), UINT32_IN_DATA);
+
+    ami_setUint32Le(pAddr, UINT32_IN_DATA);
+
+    CU_ASSERT_EQUAL(pAddr[0], 0xDD);
+    CU_ASSERT_EQUAL(pAddr[3], 0xAA);
+    CU_ASSERT_EQUAL(ami_getUint32Le(pAddr), UINT32_IN_DATA);
+
+    // Test uint64 on an odd address
+    ami_setUint64Be(pAddr, UINT64_IN_DATA);
+
+    CU_ASSERT_EQUAL(pAddr[0], 0x11);
+    CU_ASSERT_EQUAL(pAddr[7], 0x88);
+    CU_ASSERT_EQUAL(ami_getUint64Be(pAddr), UINT64_IN_DATA);
+
+    ami_setUint64Le(pAddr, UINT64_IN_DATA);
+
+    CU_ASSERT_EQUAL(pAddr[0], 0x88);
+    CU_ASSERT_EQUAL(pAddr[7], 0x11);
+    CU_ASSERT_EQUAL(ami_getUint64Le(pAddr), UINT64_IN_DATA);
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test ami array conversion functions
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_amiArray(void)
+{
+    UINT8 buffer[(TEST_ARRAY_COUNT * sizeof(UINT32)) + TEST_UNALIGNED_OFFSET];
+    UINT8* pAddr = &buffer[TEST_UNALIGNED_OFFSET];
+    UINT16 inData16[TEST_ARRAY_COUNT];
+    UINT16 outData16[TEST_ARRAY_COUNT];
+    UINT32 inData32[TEST_ARRAY_COUNT];
+    UINT32 outData32[TEST_ARRAY_COUNT];
+    UINT8 i;
+
+    for(i=0; i < TEST_ARRAY_COUNT; i++)
+    {
+        inData16[i] = (UINT16)(UINT16_IN_DATA + i);
+        inData32[i] = UINT32_IN_DATA + i;
+    }
+
+    // Test uint16 arrays in both byte orders
+    ami_setUint16ArrayBe(pAddr, inData16, TEST_ARRAY_COUNT);
+
+    for(i=0; i < TEST_ARRAY_COUNT; i++)
+    {
+        CU_ASSERT_EQUAL(ami_getUint16Be(&pAddr[i * sizeof(UINT16)]), inData16[i]);
+    }
+
+    ami_getUint16ArrayBe(outData16, pAddr, TEST_ARRAY_COUNT);
+
+    CU_ASSERT_EQUAL(PSI_MEMCMP(outData16, inData16, sizeof(inData16)), 0);
+
+    ami_setUint16ArrayLe(pAddr, inData16, TEST_ARRAY_COUNT);
+
+    for(i=0; i < TEST_ARRAY_COUNT; i++)
+    {
+        CU_ASSERT_EQUAL(ami_getUint16Le(&pAddr[i * sizeof(UINT16)]), inData16[i]);
+    }
+
+    ami_getUint16ArrayLe(outData16, pAddr, TEST_ARRAY_COUNT);
+
+    CU_ASSERT_EQUAL(PSI_MEMCMP(outData16, inData16, sizeof(inData16)), 0);
+
+    // Test uint32 arrays in both byte orders
+    ami_setUint32ArrayBe(pAddr, inData32, TEST_ARRAY_COUNT);
+
+    for(i=0; i < TEST_ARRAY_COUNT; i++)
+    {
+        CU_ASSERT_EQUAL(ami_getUint32Be(&pAddr[i * sizeof(UINT32)]), inData32[i]);
+    }
+
+    ami_getUint32ArrayBe(outData32, pAddr, TEST_ARRAY_COUNT);
+
+    CU_ASSERT_EQUAL(PSI_MEMCMP(outData32, inData32, sizeof(inData32)), 0);
+
+    ami_setUint32ArrayLe(pAddr, inData32, TEST_ARRAY_COUNT);
+
+    for(i=0; i < TEST_ARRAY_COUNT; i++)
+    {
+        CU_ASSERT_EQUAL(ami_getUint32Le(&pAddr[i * sizeof(UINT32)]), inData32[i]);
+    }
+
+    ami_getUint32ArrayLe(outData32, pAddr, TEST_ARRAY_COUNT);
+
+    CU_ASSERT_EQUAL(PSI_MEMCMP(outData32, inData32, sizeof(inData32)), 0);
+}
+
 //============================================================================//
 //            P R I V A T E   F U N C T I O N S                               //
 //============================================================================//
@@ -64,3 +64,5 @@ The configuration header provides the function prototypes for each module test
 void TST_amiUint16(void);
 void TST_amiUint32(void);
 void TST_amiUint64(void);
+void TST_amiUnaligned(void);
+void TST_amiArray(void);
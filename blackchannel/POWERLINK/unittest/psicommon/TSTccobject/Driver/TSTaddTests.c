@@ -108,6 +108,7 @@ static CU_TestInfo ccobjectGeneral[] = {
     { "Write all objects", TST_writeObject },
     { "Read all objects", TST_readObject },
     { "Get the size of an object", TST_getObjectSize },
+    { "Lookup objects by index and subindex", TST_lookupObject },
     CU_TEST_INFO_NULL,
 };
 
@@ -120,9 +121,24 @@ static CU_TestInfo ccobjectCurrent[] = {
     CU_TEST_INFO_NULL,
 };
 
+static CU_TestInfo ccobjectBatch[] = {
+    { "Test pack and write of an object batch", TST_ccobjectBatchPackWrite },
+    { "Test invalid object batches", TST_ccobjectBatchInvalid },
+    { "Test transfer of changed objects only", TST_ccobjectDirtyPack },
+    { "Test refresh of unchanged objects", TST_ccobjectRefresh },
+    CU_TEST_INFO_NULL,
+};
+
+static CU_TestInfo ccobjectConcurrent[] = {
+    { "Test object access from two threads", TST_ccobjectConcurrentAccess },
+    CU_TEST_INFO_NULL,
+};
+
 static CU_SuiteInfo suites[] = {
     { "Basic ccobject module suite", TST_defaultInit, TST_defaultClean, ccobjectGeneral },
     { "Test ccobject list functionality", TST_defaultInit, TST_defaultClean, ccobjectCurrent },
+    { "Test ccobject batch functionality", TST_defaultInit, TST_defaultClean, ccobjectBatch },
+    { "Test ccobject concurrent access", TST_defaultInit, TST_defaultClean, ccobjectConcurrent },
     CU_SUITE_INFO_NULL,
 };
 
@@ -255,6 +255,67 @@ void TST_getObjectSize(void)
     CU_ASSERT_NOT_EQUAL( size, DUMMY_OBJECT_SIZE );
 }
 
+//------------------------------------------------------------------------------
+/**
+\brief    Tests for the object lookup by index and subindex
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_lookupObject(void)
+{
+    BOOL fReturn;
+    UINT8 i;
+    UINT8 objId;
+    tConfChanObject dummyObject;
+
+    fReturn = stb_initAllObjects(DUMMY_OBJECT_IDX, DUMMY_OBJECT_SIZE, 0x0);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    // Every object is found at its position in the list
+    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    {
+        fReturn = ccobject_getObjectId(DUMMY_OBJECT_IDX, i, &objId);
+
+        CU_ASSERT_TRUE( fReturn );
+        CU_ASSERT_EQUAL( objId, i );
+        CU_ASSERT_EQUAL( ccobject_readObject(DUMMY_OBJECT_IDX, i), ccobject_readObjectById(i) );
+    }
+
+    fReturn = ccobject_getObjectId(DUMMY_INVALID_OBJECT_IDX, DUMMY_OBJECT_SUBIDX, &objId);
+
+    CU_ASSERT_FALSE( fReturn );
+
+    // Configure the last object twice -> Lookup still finds the first one
+    dummyObject.objIdx_m = DUMMY_OBJECT_IDX;
+    dummyObject.objSubIdx_m = 0;
+    dummyObject.objSize_m = DUMMY_OBJECT_SIZE;
+    dummyObject.objPayloadLow_m = 0;
+    dummyObject.objPayloadHigh_m = 0;
+
+    fReturn = ccobject_initObject(CONF_CHAN_NUM_OBJECTS - 1, &dummyObject);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    for(i=0; i < CONF_CHAN_NUM_OBJECTS - 1; i++)
+    {
+        fReturn = ccobject_getObjectId(DUMMY_OBJECT_IDX, i, &objId);
+
+        CU_ASSERT_TRUE( fReturn );
+        CU_ASSERT_EQUAL( objId, i );
+    }
+
+    fReturn = ccobject_getObjectId(DUMMY_OBJECT_IDX, CONF_CHAN_NUM_OBJECTS - 1, &objId);
+
+    CU_ASSERT_FALSE( fReturn );
+
+    // Restore object list
+    fReturn = stb_initAllObjects(DUMMY_OBJECT_IDX, DUMMY_OBJECT_SIZE, 0x0);
+
+    CU_ASSERT_TRUE( fReturn );
+}
+
 //============================================================================//
 //            P R I V A T E   F U N C T I O N S                               //
 //============================================================================//
@@ -0,0 +1,373 @@
+/**
+********************************************************************************
+\file   TSTccobjectBatch.c
+
+\brief  Test drivers for the ccobject module object batches
+
+\ingroup module_unittests
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2013 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+
+//------------------------------------------------------------------------------
+// includes
+//------------------------------------------------------------------------------
+#include <cunit/CUnit.h>
+
+#include <Driver/TSTccobjectConfig.h>
+#include <Stubs/STBinitObjects.h>
+#include <Stubs/STBcritSec.h>
+
+#include <libpsicommon/ccobject.h>
+
+//============================================================================//
+//            G L O B A L   D E F I N I T I O N S                             //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// module global vars
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+// global function prototypes
+//------------------------------------------------------------------------------
+
+//============================================================================//
+//            P R I V A T E   D E F I N I T I O N S                           //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+#define DUMMY_OBJECT_IDX              0x6000
+#define DUMMY_OBJECT_SIZE             sizeof(UINT16)
+#define DUMMY_ENTRY_SIZE              (CC_ENTRY_HEADER_SIZE + DUMMY_OBJECT_SIZE)
+
+#define DUMMY_DATA                    0x1100U
+
+//------------------------------------------------------------------------------
+// local types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local vars
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local function prototypes
+//------------------------------------------------------------------------------
+static void initBatchObjects(void);
+
+//============================================================================//
+//            P U B L I C   F U N C T I O N S                                 //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test packing the object list and writing the batch back
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_ccobjectBatchPackWrite(void)
+{
+    BOOL fReturn;
+    UINT8 i;
+    UINT8 objData[CC_OBJDATA_SIZE];
+    UINT8 objIdList[CC_MAX_BATCH_OBJECTS];
+    UINT8 objCount;
+    UINT8 expCount;
+    UINT8 dataSize;
+    tConfChanObject* pReadObject;
+
+    initBatchObjects();
+
+    expCount = CC_OBJDATA_SIZE / DUMMY_ENTRY_SIZE;
+    if(expCount > CONF_CHAN_NUM_OBJECTS)
+    {
+        expCount = CONF_CHAN_NUM_OBJECTS;
+    }
+
+    // Pack as many objects as fit into the batch
+    dataSize = ccobject_packCurrObjects(&objData[0], sizeof(objData), &objCount);
+
+    CU_ASSERT_EQUAL( objCount, expCount );
+    CU_ASSERT_EQUAL( dataSize, expCount * DUMMY_ENTRY_SIZE );
+
+    for(i=0; i < objCount; i++)
+    {
+        CU_ASSERT_EQUAL( objData[i * DUMMY_ENTRY_SIZE], CC_ENTRY_HEADER(i, 1) );
+        CU_ASSERT_EQUAL( ami_getUint16Le(&objData[i * DUMMY_ENTRY_SIZE + CC_ENTRY_HEADER_SIZE]), DUMMY_DATA + i );
+    }
+
+    // Read pointer is moved behind the packed objects
+    pReadObject = ccobject_readCurrObject();
+
+    CU_ASSERT_EQUAL( pReadObject, ccobject_readObjectById(objCount % CONF_CHAN_NUM_OBJECTS) );
+
+    // Clear the list and write the batch back
+    fReturn = stb_initAllObjects(DUMMY_OBJECT_IDX, DUMMY_OBJECT_SIZE, 0x0);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    fReturn = ccobject_writeObjectBatch(&objData[0], dataSize, objCount, &objIdList[0]);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    for(i=0; i < objCount; i++)
+    {
+        CU_ASSERT_EQUAL( objIdList[i], i );
+
+        pReadObject = ccobject_readObjectById(i);
+
+        CU_ASSERT_EQUAL( pReadObject->objPayloadLow_m, DUMMY_DATA + i );
+    }
+
+    // Empty batch is valid
+    fReturn = ccobject_writeObjectBatch(&objData[0], sizeof(objData), 0, NULL);
+
+    CU_ASSERT_TRUE( fReturn );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test that an invalid batch leaves the object list untouched
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_ccobjectBatchInvalid(void)
+{
+    BOOL fReturn;
+    UINT8 objData[CC_OBJDATA_SIZE];
+    UINT8 entrySize;
+    tConfChanObject* pReadObject;
+
+    initBatchObjects();
+
+    // Valid first entry for object 0
+    entrySize = ccobject_packObject(0, &objData[0], sizeof(objData));
+
+    CU_ASSERT_EQUAL( entrySize, DUMMY_ENTRY_SIZE );
+
+    ami_setUint16Le(&objData[CC_ENTRY_HEADER_SIZE], 0xFFFF);
+
+    // Second entry with invalid object id
+    objData[entrySize] = CC_ENTRY_HEADER(CC_ENTRY_ID_MASK, 1);
+
+    fReturn = ccobject_writeObjectBatch(&objData[0], sizeof(objData), 2, NULL);
+
+    CU_ASSERT_FALSE( fReturn );
+
+    // Second entry with wrong object size
+    objData[entrySize] = CC_ENTRY_HEADER(1, 2);
+
+    fReturn = ccobject_writeObjectBatch(&objData[0], sizeof(objData), 2, NULL);
+
+    CU_ASSERT_FALSE( fReturn );
+
+    // More entries than data
+    fReturn = ccobject_writeObjectBatch(&objData[0], entrySize, 2, NULL);
+
+    CU_ASSERT_FALSE( fReturn );
+
+    // First object is not updated by any of the batches
+    pReadObject = ccobject_readObjectById(0);
+
+    CU_ASSERT_EQUAL( pReadObject->objPayloadLow_m, DUMMY_DATA );
+
+    // Entry doesn't fit into the destination
+    entrySize = ccobject_packObject(0, &objData[0], DUMMY_ENTRY_SIZE - 1);
+
+    CU_ASSERT_EQUAL( entrySize, 0 );
+
+    // Invalid object id
+    entrySize = ccobject_packObject(CONF_CHAN_NUM_OBJECTS, &objData[0], sizeof(objData));
+
+    CU_ASSERT_EQUAL( entrySize, 0 );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test that only changed objects are packed
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_ccobjectDirtyPack(void)
+{
+    BOOL fReturn;
+    UINT8 i;
+    UINT8 objData[CC_OBJDATA_SIZE];
+    UINT8 objCount;
+    UINT8 totalCount = 0;
+    UINT8 dataSize;
+    tConfChanObject object;
+
+    initBatchObjects();
+
+    // All objects are transferred once after the initialization
+    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    {
+        dataSize = ccobject_packDirtyObjects(&objData[0], sizeof(objData), &objCount);
+
+        CU_ASSERT_EQUAL( dataSize, objCount * DUMMY_ENTRY_SIZE );
+
+        totalCount += objCount;
+        if(objCount == 0)
+        {
+            break;
+        }
+    }
+
+    CU_ASSERT_EQUAL( totalCount, CONF_CHAN_NUM_OBJECTS );
+
+    // Nothing changed -> Nothing to transfer
+    dataSize = ccobject_packDirtyObjects(&objData[0], sizeof(objData), &objCount);
+
+    CU_ASSERT_EQUAL( objCount, 0 );
+    CU_ASSERT_EQUAL( dataSize, 0 );
+
+    // Change the last object of the list
+    object.objIdx_m = DUMMY_OBJECT_IDX;
+    object.objSubIdx_m = CONF_CHAN_NUM_OBJECTS - 1;
+    object.objSize_m = DUMMY_OBJECT_SIZE;
+    object.objPayloadLow_m = 0x5AA5;
+    object.objPayloadHigh_m = 0;
+
+    fReturn = ccobject_writeObject(&object);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    // Only the changed object is transferred in the next cycle
+    dataSize = ccobject_packDirtyObjects(&objData[0], sizeof(objData), &objCount);
+
+    CU_ASSERT_EQUAL( objCount, 1 );
+    CU_ASSERT_EQUAL( dataSize, DUMMY_ENTRY_SIZE );
+    CU_ASSERT_EQUAL( objData[0], CC_ENTRY_HEADER(CONF_CHAN_NUM_OBJECTS - 1, 1) );
+    CU_ASSERT_EQUAL( ami_getUint16Le(&objData[CC_ENTRY_HEADER_SIZE]), 0x5AA5 );
+
+    dataSize = ccobject_packDirtyObjects(&objData[0], sizeof(objData), &objCount);
+
+    CU_ASSERT_EQUAL( objCount, 0 );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test the periodic refresh of unchanged objects
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_ccobjectRefresh(void)
+{
+#if (CC_REFRESH_CYCLE_COUNT != 0)
+    UINT16 cycle = 0;
+    UINT8 objData[CC_OBJDATA_SIZE];
+    UINT8 objCount;
+    UINT8 i;
+
+    initBatchObjects();
+
+    // Transfer the initial values
+    do
+    {
+        ccobject_packDirtyObjects(&objData[0], sizeof(objData), &objCount);
+        cycle++;
+    } while(objCount != 0 && cycle < CC_REFRESH_CYCLE_COUNT);
+
+    CU_ASSERT( cycle < CC_REFRESH_CYCLE_COUNT );
+
+    // Each refresh period one unchanged object is sent again
+    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    {
+        for( ; cycle < (i + 1) * CC_REFRESH_CYCLE_COUNT - 1; cycle++)
+        {
+            ccobject_packDirtyObjects(&objData[0], sizeof(objData), &objCount);
+
+            CU_ASSERT_EQUAL( objCount, 0 );
+        }
+
+        ccobject_packDirtyObjects(&objData[0], sizeof(objData), &objCount);
+        cycle++;
+
+        CU_ASSERT_EQUAL( objCount, 1 );
+        CU_ASSERT_EQUAL( objData[0], CC_ENTRY_HEADER(i, 1) );
+        CU_ASSERT_EQUAL( ami_getUint16Le(&objData[CC_ENTRY_HEADER_SIZE]), DUMMY_DATA + i );
+    }
+#endif
+}
+
+//============================================================================//
+//            P R I V A T E   F U N C T I O N S                               //
+//============================================================================//
+/// \name Private Functions
+/// \{
+
+//------------------------------------------------------------------------------
+/**
+\brief    Initialize all objects with a unique payload
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static void initBatchObjects(void)
+{
+    BOOL fReturn;
+    UINT8 i;
+    tConfChanObject* pObject;
+
+    ccobject_init(stb_dummyCriticalSection);
+
+    fReturn = stb_initAllObjects(DUMMY_OBJECT_IDX, DUMMY_OBJECT_SIZE, 0x0);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    {
+        pObject = ccobject_readObjectById(i);
+
+        CU_ASSERT_NOT_EQUAL( pObject, NULL );
+
+        pObject->objPayloadLow_m = DUMMY_DATA + i;
+    }
+}
+
+/// \}
@@ -0,0 +1,391 @@
+/**
+********************************************************************************
+\file   TSTccobjectConcurrent.c
+
+\brief  Test drivers for concurrent access to the ccobject module
+
+\ingroup module_unittests
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2014 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+
+//------------------------------------------------------------------------------
+// includes
+//------------------------------------------------------------------------------
+#include <cunit/CUnit.h>
+
+#include <Driver/TSTccobjectConfig.h>
+#include <Stubs/STBinitObjects.h>
+#include <Stubs/STBcritSec.h>
+
+#include <libpsicommon/ccobject.h>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <pthread.h>
+#endif
+
+//============================================================================//
+//            G L O B A L   D E F I N I T I O N S                             //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// module global vars
+//------------------------------------------------------------------------------
+
+
+//------------------------------------------------------------------------------
+// global function prototypes
+//------------------------------------------------------------------------------
+
+//============================================================================//
+//            P R I V A T E   D E F I N I T I O N S                           //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+#define DUMMY_OBJECT_IDX              0x6000
+#define DUMMY_OBJECT_SIZE             sizeof(UINT64)
+
+#define WRITE_COUNT                   200000U     ///< Number of writes of the writer thread
+
+//------------------------------------------------------------------------------
+// local types
+//------------------------------------------------------------------------------
+#if defined(_WIN32)
+typedef HANDLE tTestThread;
+#else
+typedef pthread_t tTestThread;
+#endif
+
+//------------------------------------------------------------------------------
+// local vars
+//------------------------------------------------------------------------------
+static volatile BOOL fWriterDone_l = FALSE;
+
+//------------------------------------------------------------------------------
+// local function prototypes
+//------------------------------------------------------------------------------
+static void writeObjects(void);
+static BOOL startWriter(tTestThread* pThread_p);
+static void joinWriter(tTestThread thread_p);
+static BOOL isPayloadValid(UINT32 low_p, UINT32 high_p);
+
+//============================================================================//
+//            P U B L I C   F U N C T I O N S                                 //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test reading and packing an object while another thread writes it
+
+The writer thread always writes the low word and its complement to the high
+word of the object. A reader which gets a torn copy sees a mismatch.
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_ccobjectConcurrentAccess(void)
+{
+    BOOL fReturn;
+    tTestThread writer;
+    tConfChanObject object;
+    UINT8 objData[CC_OBJDATA_SIZE];
+    UINT8 objCount;
+    UINT8 offset;
+    UINT8 i;
+    UINT32 lastPacked = 0;
+    UINT32 tornCount = 0;
+
+    ccobject_init(stb_dummyCriticalSection);
+
+    fReturn = stb_initAllObjects(DUMMY_OBJECT_IDX, DUMMY_OBJECT_SIZE, 0x0);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    // Start with a valid payload
+    ccobject_readObjectById(0)->objPayloadHigh_m = ~0U;
+
+    fWriterDone_l = FALSE;
+
+    fReturn = startWriter(&writer);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    while(fReturn != FALSE && fWriterDone_l == FALSE)
+    {
+        // Read a copy of the object
+        if(ccobject_copyObject(0, &object) != FALSE)
+        {
+            if(isPayloadValid(object.objPayloadLow_m, object.objPayloadHigh_m) == FALSE)
+            {
+                tornCount++;
+            }
+        }
+
+        // Pack the changed objects
+        ccobject_packDirtyObjects(&objData[0], sizeof(objData), &objCount);
+
+        offset = 0;
+        for(i=0; i < objCount; i++)
+        {
+            if(CC_ENTRY_GET_ID(objData[offset]) == 0)
+            {
+                lastPacked = ami_getUint32Le(&objData[offset + CC_ENTRY_HEADER_SIZE]);
+                if(isPayloadValid(lastPacked,
+                        ami_getUint32Le(&objData[offset + CC_ENTRY_HEADER_SIZE + 4])) == FALSE)
+                {
+                    tornCount++;
+                }
+            }
+
+            offset += CC_ENTRY_HEADER_SIZE + CC_ENTRY_GET_SIZE(objData[offset]);
+        }
+    }
+
+    if(fReturn != FALSE)
+    {
+        joinWriter(writer);
+    }
+
+    CU_ASSERT_EQUAL( tornCount, 0 );
+
+    // Without a writer the copy always succeeds
+    fReturn = ccobject_copyObject(0, &object);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( object.objPayloadLow_m, WRITE_COUNT );
+    CU_ASSERT_EQUAL( object.objPayloadHigh_m, ~WRITE_COUNT );
+
+    // The last write is not lost for the transfer
+    for(i=0; i < CONF_CHAN_NUM_OBJECTS; i++)
+    {
+        ccobject_packDirtyObjects(&objData[0], sizeof(objData), &objCount);
+
+        offset = 0;
+        while(objCount > 0)
+        {
+            if(CC_ENTRY_GET_ID(objData[offset]) == 0)
+            {
+                lastPacked = ami_getUint32Le(&objData[offset + CC_ENTRY_HEADER_SIZE]);
+            }
+
+            offset += CC_ENTRY_HEADER_SIZE + CC_ENTRY_GET_SIZE(objData[offset]);
+            objCount--;
+        }
+    }
+
+    CU_ASSERT_EQUAL( lastPacked, WRITE_COUNT );
+}
+
+//============================================================================//
+//            P R I V A T E   F U N C T I O N S                               //
+//============================================================================//
+/// \name Private Functions
+/// \{
+
+//------------------------------------------------------------------------------
+/**
+\brief    Write the first object of the list with consistent payloads
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static void writeObjects(void)
+{
+    tConfChanObject object;
+    UINT8 objData[CC_ENTRY_HEADER_SIZE + DUMMY_OBJECT_SIZE];
+    UINT32 i;
+
+    object.objIdx_m = DUMMY_OBJECT_IDX;
+    object.objSubIdx_m = 0;
+    object.objSize_m = DUMMY_OBJECT_SIZE;
+
+    objData[0] = CC_ENTRY_HEADER(0, 3);
+
+    for(i=1; i <= WRITE_COUNT; i++)
+    {
+        // Batches write the payload word by word
+        ami_setUint32Le(&objData[CC_ENTRY_HEADER_SIZE], i);
+        ami_setUint32Le(&objData[CC_ENTRY_HEADER_SIZE + 4], ~i);
+
+        ccobject_writeObjectBatch(&objData[0], sizeof(objData), 1, NULL);
+
+        // Single object writes mark the object for the transfer
+        object.objPayloadLow_m = i;
+        object.objPayloadHigh_m = ~i;
+
+        ccobject_writeObject(&object);
+    }
+
+    fWriterDone_l = TRUE;
+}
+
+#if defined(_WIN32)
+
+//------------------------------------------------------------------------------
+/**
+\brief    Entry point of the writer thread
+
+\param[in] pArg_p       Unused thread argument
+
+\return DWORD Always 0
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static DWORD WINAPI writerThread(LPVOID pArg_p)
+{
+    UNUSED_PARAMETER(pArg_p);
+
+    writeObjects();
+
+    return 0;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Start the writer thread
+
+\param[out] pThread_p   Handle of the started thread
+
+\retval TRUE     Thread started
+\retval FALSE    Unable to start the thread
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL startWriter(tTestThread* pThread_p)
+{
+    *pThread_p = CreateThread(NULL, 0, writerThread, NULL, 0, NULL);
+
+    return (*pThread_p != NULL) ? TRUE : FALSE;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Wait for the writer thread to finish
+
+\param[in] thread_p     Handle of the thread
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static void joinWriter(tTestThread thread_p)
+{
+    WaitForSingleObject(thread_p, INFINITE);
+    CloseHandle(thread_p);
+}
+
+#else
+
+//------------------------------------------------------------------------------
+/**
+\brief    Entry point of the writer thread
+
+\param[in] pArg_p       Unused thread argument
+
+\return void* Always NULL
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static void* writerThread(void* pArg_p)
+{
+    UNUSED_PARAMETER(pArg_p);
+
+    writeObjects();
+
+    return NULL;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Start the writer thread
+
+\param[out] pThread_p   Handle of the started thread
+
+\retval TRUE     Thread started
+\retval FALSE    Unable to start the thread
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL startWriter(tTestThread* pThread_p)
+{
+    return (pthread_create(pThread_p, NULL, writerThread, NULL) == 0) ? TRUE : FALSE;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Wait for the writer thread to finish
+
+\param[in] thread_p     Handle of the thread
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static void joinWriter(tTestThread thread_p)
+{
+    pthread_join(thread_p, NULL);
+}
+
+#endif
+
+//------------------------------------------------------------------------------
+/**
+\brief    Check the payload written by the writer thread
+
+\param[in] low_p        Low word of the payload
+\param[in] high_p       High word of the payload
+
+\retval TRUE     High word is the complement of the low word
+\retval FALSE    Torn payload
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL isPayloadValid(UINT32 low_p, UINT32 high_p)
+{
+    return (high_p == ~low_p) ? TRUE : FALSE;
+}
+
+/// \}
@@ -67,6 +67,7 @@ void TST_initObject(void);
 void TST_writeObject(void);
 void TST_readObject(void);
 void TST_getObjectSize(void);
+void TST_lookupObject(void);
 
 // Tests for the current objects suite
 void TST_ccobjectCurrInt8(void);
@@ -74,3 +75,12 @@ void TST_ccobjectCurrInt16(void);
 void TST_ccobjectCurrInt32(void);
 void TST_ccobjectCurrInt64(void);
 void TST_writeCurrObjectError(void);
+
+// Tests for the object batch suite
+void TST_ccobjectBatchPackWrite(void);
+void TST_ccobjectBatchInvalid(void);
+void TST_ccobjectDirtyPack(void);
+void TST_ccobjectRefresh(void);
+
+// Tests for the concurrent access suite
+void TST_ccobjectConcurrentAccess(void);
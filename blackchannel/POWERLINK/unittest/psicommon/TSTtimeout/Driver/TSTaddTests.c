@@ -108,6 +108,9 @@ static CU_TestInfo timeout[] = {
     { "Timeout module start test", TST_timeoutStartTimer },
     { "Timer increment test", TST_timeoutIncrement },
     { "Timeout module stop test", TST_timeoutStopTimer },
+    { "Adaptive round trip time test", TST_timeoutAdaptive },
+    { "Timing wheel expiry test", TST_timeoutWheel },
+    { "Timing wheel restart and stop test", TST_timeoutRestart },
     { "Timeout module close test", TST_timeoutDestroy },
     CU_TEST_INFO_NULL,
 };
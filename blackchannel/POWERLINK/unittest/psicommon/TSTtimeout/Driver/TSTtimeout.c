@@ -78,19 +78,44 @@ This driver tests the whole timeout module of the slim interface.
 #define DUMMY_CYCLE_LIMIT       1000    ///< Timeout module cycle limit
 
 #define TEST_INSTANCE_0         0       ///< The first instance to test
+#define TEST_INSTANCE_1         1       ///< The second instance to test
+
+#define DUMMY_RTT_SAMPLE        2       ///< Round trip time of the adaptive timeout test
+#define DUMMY_RTT_COUNT         20      ///< Number of round trip time samples
+
+#define TEST_WHEEL_FIRST        2       ///< First instance of the timing wheel tests
+#define TEST_WHEEL_COUNT        3       ///< Number of instances of the timing wheel tests
+#define TEST_RESTART_CYCLES     2       ///< Cycles until the timer under test is restarted (Below the shortest limit)
 
 //------------------------------------------------------------------------------
 // local types
 //------------------------------------------------------------------------------
 
+/**
+ * \brief Expiry record of a timer under test
+ */
+typedef struct {
+    UINT16              expireCount_m;      ///< Number of expiry callbacks
+    UINT32              expireCycle_m;      ///< Test cycle of the last expiry callback
+    tTimeoutInstance    pInstance_m;        ///< Instance passed to the last callback
+} tTestExpiry;
+
 //------------------------------------------------------------------------------
 // local vars
 //------------------------------------------------------------------------------
 static tTimeoutInstance  pInstances_l[TIMEOUT_MAX_INSTANCES];
 
+static UINT32            testCycle_l;
+static tTestExpiry       testExpiry_l[TEST_WHEEL_COUNT];
+
+/// Cycle limits of the timing wheel tests (One for each wheel level range)
+static const UINT16      testCycleLimit_l[TEST_WHEEL_COUNT] = { 3, 300, 0xFFFF };
+
 //------------------------------------------------------------------------------
 // local function prototypes
 //------------------------------------------------------------------------------
+static void processCycle(void);
+static void expireCb(tTimeoutInstance pInstance_p, void* pArg_p);
 
 //============================================================================//
 //            P U B L I C   F U N C T I O N S                                 //
@@ -145,8 +170,12 @@ void TST_timeoutNotRunning(void)
 
     CU_ASSERT_EQUAL(timerState, kTimerStateStopped);
 
-    // Test increment counter function when timer is stopped
-    timeout_incrementCounter(pInstances_l[TEST_INSTANCE_0]);
+    // Process a cycle when timer is stopped
+    timeout_processSync();
+
+    timerState = timeout_checkExpire(pInstances_l[TEST_INSTANCE_0]);
+
+    CU_ASSERT_EQUAL(timerState, kTimerStateStopped);
 }
 
 //------------------------------------------------------------------------------
@@ -186,14 +215,14 @@ void TST_timeoutIncrement(void)
 
     for(i=0; i < DUMMY_CYCLE_LIMIT; i++)
     {
-        timeout_incrementCounter(pInstances_l[TEST_INSTANCE_0]);
+        timeout_processSync();
         timerState = timeout_checkExpire(pInstances_l[TEST_INSTANCE_0]);
 
         CU_ASSERT_EQUAL(timerState, kTimerStateRunning);
     }
 
     // Check if timer is expired
-    timeout_incrementCounter(pInstances_l[TEST_INSTANCE_0]);
+    timeout_processSync();
     timerState = timeout_checkExpire(pInstances_l[TEST_INSTANCE_0]);
 
     CU_ASSERT_EQUAL(timerState, kTimerStateExpired);
@@ -211,6 +240,237 @@ void TST_timeoutStopTimer(void)
     timeout_stopTimer(pInstances_l[TEST_INSTANCE_0]);
 }
 
+//------------------------------------------------------------------------------
+/**
+\brief    Adapt the cycle limit to the round trip time and back off on expiry
+
+Answers of retried transmissions are no round trip time samples.
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_timeoutAdaptive(void)
+{
+    UINT16 i, j;
+    UINT16 cycleLimit;
+    tTimerStatus timerState;
+    tTimeoutInstance pInstance = pInstances_l[TEST_INSTANCE_1];
+
+    CU_ASSERT_EQUAL(timeout_getCycleLimit(pInstance), DUMMY_CYCLE_LIMIT);
+
+    // Update without running timer is ignored
+    timeout_updateRtt(pInstance);
+
+    CU_ASSERT_EQUAL(timeout_getCycleLimit(pInstance), DUMMY_CYCLE_LIMIT);
+
+    // Without a lower bound the fixed limit is kept
+    timeout_startTimer(pInstance);
+    timeout_processSync();
+    timeout_updateRtt(pInstance);
+    timeout_stopTimer(pInstance);
+
+    CU_ASSERT_EQUAL(timeout_getCycleLimit(pInstance), DUMMY_CYCLE_LIMIT);
+
+    // Allow the shortest limit
+    timeout_setMinCycleLimit(pInstance, 0);
+
+    // Acknowledge a series of transmissions with a short round trip time
+    for(i=0; i < DUMMY_RTT_COUNT; i++)
+    {
+        timeout_startTimer(pInstance);
+
+        for(j=0; j < DUMMY_RTT_SAMPLE; j++)
+        {
+            timeout_processSync();
+        }
+
+        timeout_updateRtt(pInstance);
+        timeout_stopTimer(pInstance);
+    }
+
+    cycleLimit = timeout_getCycleLimit(pInstance);
+
+    CU_ASSERT(cycleLimit < DUMMY_CYCLE_LIMIT);
+    CU_ASSERT(cycleLimit > DUMMY_RTT_SAMPLE);
+    CU_ASSERT(cycleLimit >= TIMEOUT_MIN_CYCLE_LIMIT);
+
+    // Immediate acknowledges never undercut the minimum limit
+    for(i=0; i < DUMMY_RTT_COUNT; i++)
+    {
+        timeout_startTimer(pInstance);
+        timeout_updateRtt(pInstance);
+        timeout_stopTimer(pInstance);
+
+        CU_ASSERT(timeout_getCycleLimit(pInstance) >= TIMEOUT_MIN_CYCLE_LIMIT);
+    }
+
+    // Let the timer expire -> Limit is doubled
+    cycleLimit = timeout_getCycleLimit(pInstance);
+    timeout_startTimer(pInstance);
+
+    for(i=0; i < cycleLimit; i++)
+    {
+        timeout_processSync();
+        timerState = timeout_checkExpire(pInstance);
+
+        CU_ASSERT_EQUAL(timerState, kTimerStateRunning);
+    }
+
+    timeout_processSync();
+    timerState = timeout_checkExpire(pInstance);
+
+    CU_ASSERT_EQUAL(timerState, kTimerStateExpired);
+    CU_ASSERT_EQUAL(timeout_getCycleLimit(pInstance), cycleLimit * 2);
+
+    // Repeated expiry never exceeds the initial limit
+    for(i=0; i < DUMMY_RTT_COUNT; i++)
+    {
+        timeout_startTimer(pInstance);
+
+        do
+        {
+            timeout_processSync();
+            timerState = timeout_checkExpire(pInstance);
+        } while(timerState == kTimerStateRunning);
+
+        CU_ASSERT_EQUAL(timerState, kTimerStateExpired);
+    }
+
+    CU_ASSERT_EQUAL(timeout_getCycleLimit(pInstance), DUMMY_CYCLE_LIMIT);
+
+    // First answer after an expiry gives no sample
+    timeout_startTimer(pInstance);
+    timeout_processSync();
+    timeout_updateRtt(pInstance);
+    timeout_stopTimer(pInstance);
+
+    CU_ASSERT_EQUAL(timeout_getCycleLimit(pInstance), DUMMY_CYCLE_LIMIT);
+
+    // Answer of a retried transmission gives no sample
+    timeout_startTimer(pInstance);
+    timeout_processSync();
+    timeout_startTimer(pInstance);
+    timeout_processSync();
+    timeout_updateRtt(pInstance);
+    timeout_stopTimer(pInstance);
+
+    CU_ASSERT_EQUAL(timeout_getCycleLimit(pInstance), DUMMY_CYCLE_LIMIT);
+
+    // Next answer is taken as sample again
+    timeout_startTimer(pInstance);
+    timeout_processSync();
+    timeout_updateRtt(pInstance);
+    timeout_stopTimer(pInstance);
+
+    CU_ASSERT(timeout_getCycleLimit(pInstance) < DUMMY_CYCLE_LIMIT);
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Let several timers with different cycle limits expire in the wheel
+
+Each timer needs to expire exactly after its cycle limit and the expiry
+callback is called once.
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_timeoutWheel(void)
+{
+    UINT8 i;
+    UINT32 lastCycle = 0;
+    tTimeoutInstance pInstance;
+
+    PSI_MEMSET(&testExpiry_l, 0, sizeof(testExpiry_l));
+    testCycle_l = 0;
+
+    for(i=0; i < TEST_WHEEL_COUNT; i++)
+    {
+        // Recreate the instances with the test cycle limit
+        timeout_destroy(pInstances_l[TEST_WHEEL_FIRST + i]);
+        pInstance = timeout_create(testCycleLimit_l[i]);
+
+        CU_ASSERT_NOT_EQUAL(pInstance, NULL);
+
+        pInstances_l[TEST_WHEEL_FIRST + i] = pInstance;
+        timeout_setExpireCb(pInstance, expireCb, &testExpiry_l[i]);
+
+        timeout_startTimer(pInstance);
+
+        if(testCycleLimit_l[i] > lastCycle)
+        {
+            lastCycle = testCycleLimit_l[i];
+        }
+    }
+
+    // Process until the longest timer is expired
+    while(testCycle_l <= lastCycle)
+    {
+        processCycle();
+    }
+
+    for(i=0; i < TEST_WHEEL_COUNT; i++)
+    {
+        pInstance = pInstances_l[TEST_WHEEL_FIRST + i];
+
+        CU_ASSERT_EQUAL(testExpiry_l[i].expireCount_m, 1);
+        CU_ASSERT_EQUAL(testExpiry_l[i].expireCycle_m, (UINT32)testCycleLimit_l[i] + 1);
+        CU_ASSERT_EQUAL(testExpiry_l[i].pInstance_m, pInstance);
+
+        CU_ASSERT_EQUAL(timeout_checkExpire(pInstance), kTimerStateExpired);
+        CU_ASSERT_EQUAL(timeout_checkExpire(pInstance), kTimerStateStopped);
+    }
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Restart and stop timers in the wheel
+
+A restarted timer expires relative to the restart. A stopped timer never
+expires.
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_timeoutRestart(void)
+{
+    UINT16 i;
+    UINT16 cycleLimit;
+    tTimeoutInstance pRestart = pInstances_l[TEST_WHEEL_FIRST];
+    tTimeoutInstance pStopped = pInstances_l[TEST_WHEEL_FIRST + 1];
+
+    PSI_MEMSET(&testExpiry_l, 0, sizeof(testExpiry_l));
+    testCycle_l = 0;
+
+    cycleLimit = timeout_getCycleLimit(pRestart);
+
+    timeout_startTimer(pRestart);
+    timeout_startTimer(pStopped);
+
+    for(i=0; i < TEST_RESTART_CYCLES; i++)
+    {
+        processCycle();
+    }
+
+    // Restart the first timer before it expires and stop the second one
+    timeout_startTimer(pRestart);
+    timeout_stopTimer(pStopped);
+
+    while(testCycle_l <= ((UINT32)timeout_getCycleLimit(pStopped) + TEST_RESTART_CYCLES))
+    {
+        processCycle();
+
+        CU_ASSERT_EQUAL(timeout_isRunning(pStopped), kTimerStateStopped);
+    }
+
+    CU_ASSERT_EQUAL(testExpiry_l[0].expireCount_m, 1);
+    CU_ASSERT_EQUAL(testExpiry_l[0].expireCycle_m, (UINT32)cycleLimit + TEST_RESTART_CYCLES + 1);
+    CU_ASSERT_EQUAL(testExpiry_l[1].expireCount_m, 0);
+
+    CU_ASSERT_EQUAL(timeout_checkExpire(pRestart), kTimerStateExpired);
+    CU_ASSERT_EQUAL(timeout_checkExpire(pStopped), kTimerStateStopped);
+}
+
 //------------------------------------------------------------------------------
 /**
 \brief    Destroy all allocated timer instances
@@ -238,4 +498,33 @@ void TST_timeoutDestroy(void)
 /// \name Private Functions
 /// \{
 
+//------------------------------------------------------------------------------
+/**
+\brief    Process one cycle of the timing wheel and count the test cycles
+*/
+//------------------------------------------------------------------------------
+static void processCycle(void)
+{
+    testCycle_l++;
+
+    timeout_processSync();
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Expiry callback of the timing wheel tests
+
+\param[in] pInstance_p      The expired timer
+\param[in] pArg_p           Expiry record of the timer
+*/
+//------------------------------------------------------------------------------
+static void expireCb(tTimeoutInstance pInstance_p, void* pArg_p)
+{
+    tTestExpiry* pExpiry = (tTestExpiry*)pArg_p;
+
+    pExpiry->expireCount_m++;
+    pExpiry->expireCycle_m = testCycle_l;
+    pExpiry->pInstance_m = pInstance_p;
+}
+
 /// \}
\ No newline at end of file
@@ -66,4 +66,7 @@ void TST_timeoutNotRunning(void);
 void TST_timeoutStartTimer(void);
 void TST_timeoutIncrement(void);
 void TST_timeoutStopTimer(void);
+void TST_timeoutAdaptive(void);
+void TST_timeoutWheel(void);
+void TST_timeoutRestart(void);
 void TST_timeoutDestroy(void);
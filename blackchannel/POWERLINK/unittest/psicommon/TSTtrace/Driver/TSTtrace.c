@@ -0,0 +1,307 @@
+/**
+********************************************************************************
+\file   TSTtrace.c
+
+\brief  Test the binary trace module
+
+This driver tests recording and host side decoding of binary traces.
+
+\ingroup module_unittests
+*******************************************************************************/
+
+/*------------------------------------------------------------------------------
+* License Agreement
+*
+* Copyright 2013 BERNECKER + RAINER, AUSTRIA, 5142 EGGELSBERG, B&R STRASSE 1
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms,
+* with or without modification,
+* are permitted provided that the following conditions are met:
+*
+*   * Redistributions of source code must retain the above copyright notice,
+*     this list of conditions and the following disclaimer.
+*   * Redistributions in binary form must reproduce the above copyright notice,
+*     this list of conditions and the following disclaimer
+*     in the documentation and/or other materials provided with the
+*     distribution.
+*   * Neither the name of the B&R nor the names of its contributors
+*     may be used to endorse or promote products derived from this software
+*     without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+* AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO,
+* THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+* A PARTICULAR PURPOSE ARE DISCLAIMED.
+* IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+* ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+* LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+* ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+* (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF
+* THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+------------------------------------------------------------------------------*/
+
+//------------------------------------------------------------------------------
+// includes
+//------------------------------------------------------------------------------
+#include <cunit/CUnit.h>
+
+#include <Driver/TSTtraceConfig.h>
+
+#include <libpsicommon/trace.h>
+
+#include <string.h>
+
+//============================================================================//
+//            G L O B A L   D E F I N I T I O N S                             //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// module global vars
+//------------------------------------------------------------------------------
+extern const char __stop_psitrace_fmt[];
+
+//------------------------------------------------------------------------------
+// global function prototypes
+//------------------------------------------------------------------------------
+
+//============================================================================//
+//            P R I V A T E   D E F I N I T I O N S                           //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+// const defines
+//------------------------------------------------------------------------------
+#define TRACE_TEXT_SIZE         128     ///< Size of the decoded text buffer
+
+//------------------------------------------------------------------------------
+// local types
+//------------------------------------------------------------------------------
+
+//------------------------------------------------------------------------------
+// local vars
+//------------------------------------------------------------------------------
+static UINT32 timeStamp_l = 0;
+
+//------------------------------------------------------------------------------
+// local function prototypes
+//------------------------------------------------------------------------------
+static UINT32 getTimeStamp(void);
+static BOOL decodeRecord(tTraceRecord* pRecord_p, char* pText_p, UINT32 textSize_p);
+
+//============================================================================//
+//            P U B L I C   F U N C T I O N S                                 //
+//============================================================================//
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test recording and decoding of a trace with arguments
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_traceRecord(void)
+{
+    BOOL fReturn;
+    tTraceRecord record;
+    char text[TRACE_TEXT_SIZE];
+
+    timeStamp_l = 1000;
+    trace_init(getTimeStamp);
+
+    TRACE_BINARY("Value %d of %u: 0x%04X %c\n", -5, 7U, 0xBEEF, 'A');
+
+    fReturn = trace_getRecord(&record);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( record.argCount_m, 4 );
+    CU_ASSERT_EQUAL( record.timeStamp_m, 1001 );
+
+    fReturn = decodeRecord(&record, text, sizeof(text));
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_STRING_EQUAL( text, "Value -5 of 7: 0xBEEF A\n" );
+
+    // Length modifiers, flags and strings
+    TRACE_BINARY("%-4lu|%5hd|%s|100%%", 12U, 42, 0x1234);
+
+    fReturn = trace_getRecord(&record);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( record.timeStamp_m, 1002 );
+
+    fReturn = decodeRecord(&record, text, sizeof(text));
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_STRING_EQUAL( text, "12  |   42|<0x00001234>|100%" );
+
+    // Ring is empty
+    fReturn = trace_getRecord(&record);
+
+    CU_ASSERT_FALSE( fReturn );
+
+    fReturn = trace_getRecord(NULL);
+
+    CU_ASSERT_FALSE( fReturn );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test a trace which only consists of the format string
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_traceNoArgs(void)
+{
+    BOOL fReturn;
+    tTraceRecord record;
+    char text[TRACE_TEXT_SIZE];
+
+    // Without time stamp source
+    trace_init(NULL);
+
+    TRACE_BINARY("Initialize the SAPL -> ");
+
+    fReturn = trace_getRecord(&record);
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_EQUAL( record.argCount_m, 0 );
+    CU_ASSERT_EQUAL( record.timeStamp_m, 0 );
+
+    fReturn = decodeRecord(&record, text, sizeof(text));
+
+    CU_ASSERT_TRUE( fReturn );
+    CU_ASSERT_STRING_EQUAL( text, "Initialize the SAPL -> " );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test writing more records than the ring can hold
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_traceOverflow(void)
+{
+    BOOL fReturn;
+    tTraceRecord record;
+    UINT32 i;
+
+    trace_init(NULL);
+
+    for(i=0; i < TRACE_RING_SIZE + 3; i++)
+    {
+        TRACE_BINARY("Record %u\n", i);
+    }
+
+    // The three oldest records are overwritten
+    for(i=3; i < TRACE_RING_SIZE + 3; i++)
+    {
+        fReturn = trace_getRecord(&record);
+
+        CU_ASSERT_TRUE( fReturn );
+        CU_ASSERT_EQUAL( record.arg_m[0], i );
+    }
+
+    CU_ASSERT_EQUAL( trace_getLostCount(), 3 );
+
+    fReturn = trace_getRecord(&record);
+
+    CU_ASSERT_FALSE( fReturn );
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief    Test decoding of invalid records
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+void TST_traceDecodeInvalid(void)
+{
+    BOOL fReturn;
+    tTraceRecord record;
+    char text[TRACE_TEXT_SIZE];
+
+    trace_init(NULL);
+
+    TRACE_BINARY("Node %d is in state %d\n", 1, 2);
+
+    fReturn = trace_getRecord(&record);
+
+    CU_ASSERT_TRUE( fReturn );
+
+    // Text buffer too small
+    fReturn = decodeRecord(&record, text, 8);
+
+    CU_ASSERT_FALSE( fReturn );
+    CU_ASSERT_STRING_EQUAL( text, "" );
+
+    // Missing argument
+    record.argCount_m = 1;
+    fReturn = decodeRecord(&record, text, sizeof(text));
+
+    CU_ASSERT_FALSE( fReturn );
+
+    // Format id outside of the table
+    record.argCount_m = 2;
+    record.fmtId_m = (UINT32)(__stop_psitrace_fmt - __start_psitrace_fmt);
+    fReturn = decodeRecord(&record, text, sizeof(text));
+
+    CU_ASSERT_FALSE( fReturn );
+
+    fReturn = trace_decodeRecord(NULL, __start_psitrace_fmt, 1, text, sizeof(text));
+
+    CU_ASSERT_FALSE( fReturn );
+}
+
+//============================================================================//
+//            P R I V A T E   F U N C T I O N S                               //
+//============================================================================//
+/// \name Private Functions
+/// \{
+
+//------------------------------------------------------------------------------
+/**
+\brief Time stamp source of the tests
+
+\return UINT32
+\retval Value       Incremented time stamp
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static UINT32 getTimeStamp(void)
+{
+    return ++timeStamp_l;
+}
+
+//------------------------------------------------------------------------------
+/**
+\brief Decode a record with the format table of the test executable
+
+\param pRecord_p        The trace record
+\param pText_p          Buffer for the text
+\param textSize_p       Size of the text buffer
+
+\return BOOL
+\retval TRUE    Decoding successful
+\retval FALSE   Error on decoding
+
+\ingroup module_unittests
+*/
+//------------------------------------------------------------------------------
+static BOOL decodeRecord(tTraceRecord* pRecord_p, char* pText_p, UINT32 textSize_p)
+{
+    return trace_decodeRecord(pRecord_p, __start_psitrace_fmt,
+            (UINT32)(__stop_psitrace_fmt - __start_psitrace_fmt),
+            pText_p, textSize_p);
+}
+
+/// \}
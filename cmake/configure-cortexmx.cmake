@@ -51,6 +51,10 @@ ENDIF()
 
 OPTION(CFG_BENCHMARK_ENABLED "Enable application benchmark module" ON)
 
+OPTION(CFG_STREAM_TIMING_ENABLED "Enable timing statistics of the slim interface stream actions" OFF)
+
+OPTION(CFG_TRACE_BINARY_ENABLED "Record debug traces in binary form and print them in the background loop (Expand with the host tool psitracedec)" OFF)
+
 OPTION(CFG_PROG_FLASH_ENABLE "Enable the program to flash target" OFF)
 
 ################################################################################
@@ -65,4 +69,16 @@ SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -mthumb -ffunction-sections -fdata-sections
 # Enable benchmarking
 IF(CFG_BENCHMARK_ENABLED)
     SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -DBENCHMARK_ENABLED -DBENCHMARK_MODULES=0xEE800043L")
+ENDIF()
+
+################################################################################
+# Enable timing statistics of the stream actions
+IF(CFG_STREAM_TIMING_ENABLED)
+    SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -DSTREAM_TIMING_ENABLED")
+ENDIF()
+
+################################################################################
+# Enable binary debug traces
+IF(CFG_TRACE_BINARY_ENABLED)
+    SET(CMAKE_C_FLAGS "${CMAKE_C_FLAGS} -DTRACE_BINARY_ENABLED")
 ENDIF()
\ No newline at end of file